@@ -0,0 +1,753 @@
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+
+#define BATCH_EVENTS   256   // Events per timed batch, well below the ring size
+#define BATCH_ROUNDS   64    // Batches per measurement
+#define DRAIN_CHUNK    32    // Records moved out of the recorder per read
+#define WORKLOAD_MS    200   // How long the traced workload runs
+#define OBM_LINE_BYTES 32    // Export bytes per OBM: line
+#define SWITCH_TASKS   32    // Equal priority tasks yielding to each other
+#define SWITCH_ROUNDS  256   // Yields per task
+#define BOOT_TASKS     40    // Tasks created per task creation measurement
+#define LIST_MAX_ITEMS 128   // Longest sorted list timed
+
+static TraceEvent_t xScratch[DRAIN_CHUNK];
+
+/* ── Measurement helpers ─────────────────────────────────────── */
+
+// Discard everything currently held by the recorder.
+static void prvDrainAndDiscard(void) {
+    for (BaseType_t core = 0; core < configNUMBER_OF_CORES; core++) {
+        while (xTraceRecorderRead(core, xScratch, DRAIN_CHUNK) > 0) {
+        }
+    }
+}
+
+// Time one batch with interrupts masked so the tick does not add noise.
+static uint32_t prvTimeBatch(bool record) {
+    volatile uint32_t sink = 0;
+    uint32_t start, end;
+
+    taskENTER_CRITICAL();
+    start = time_us_32();
+    if (record) {
+        for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+            vTraceRecorderUserEvent(1, i);
+        }
+    } else {
+        for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+            sink += i;
+        }
+    }
+    end = time_us_32();
+    taskEXIT_CRITICAL();
+
+    return end - start;
+}
+
+// Print the average cost of one unit of work, in CPU cycles with two decimals.
+static void prvReportPer(const char *name, const char *unit, uint64_t us, uint64_t loop_us) {
+    uint64_t events = (uint64_t)BATCH_EVENTS * BATCH_ROUNDS;
+    uint64_t mhz = clock_get_hz(clk_sys) / 1000000;
+    uint64_t net = (us > loop_us) ? (us - loop_us) : 0;
+    uint64_t centi_cycles = (net * mhz * 100) / events;
+
+    printf("  %-22s %4lu.%02lu cycles/%s  (%llu us for %llu %ss)\n", name,
+           (unsigned long)(centi_cycles / 100), (unsigned long)(centi_cycles % 100), unit,
+           (unsigned long long)us, (unsigned long long)events, unit);
+}
+
+static void prvReport(const char *name, uint64_t us, uint64_t loop_us) {
+    prvReportPer(name, "event", us, loop_us);
+}
+
+/* ── Benchmarks ──────────────────────────────────────────────── */
+
+static void prvBenchmarkTraceRecorder(void) {
+    uint64_t loop_us = 0, record_us = 0, drop_us = 0, off_us = 0;
+
+    printf("Trace recorder overhead (%d x %d events, clk_sys %lu MHz)\n",
+           BATCH_ROUNDS, BATCH_EVENTS, (unsigned long)(clock_get_hz(clk_sys) / 1000000));
+
+    // Empty loop, subtracted from everything below.
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        loop_us += prvTimeBatch(false);
+    }
+
+    // Normal path: the record is stored.
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        prvDrainAndDiscard();
+        record_us += prvTimeBatch(true);
+    }
+    prvDrainAndDiscard();
+
+    // Full buffer: the record is counted as dropped.
+    for (uint32_t i = 0; i < configTRACE_RECORDER_BUFFER_LENGTH; i++) {
+        vTraceRecorderUserEvent(1, i);
+    }
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        drop_us += prvTimeBatch(true);
+    }
+    prvDrainAndDiscard();
+
+    // Recorder stopped: only the enabled check runs.
+    vTraceRecorderStop();
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        off_us += prvTimeBatch(true);
+    }
+    vTraceRecorderStart();
+
+    prvReport("recorded", record_us, loop_us);
+    prvReport("dropped (buffer full)", drop_us, loop_us);
+    prvReport("recorder stopped", off_us, loop_us);
+    printf("  dropped so far: %lu\n\n", (unsigned long)ulTraceRecorderGetDropped(0));
+}
+
+static volatile uint32_t ulYieldTasksDone;
+
+static void vYieldTask(void *pvParameters) {
+    (void)pvParameters;
+
+    for (uint32_t i = 0; i < SWITCH_ROUNDS; i++) {
+        taskYIELD();
+    }
+    taskENTER_CRITICAL();
+    ulYieldTasksDone++;
+    taskEXIT_CRITICAL();
+    vTaskDelete(NULL);
+}
+
+// Round robin between many equal priority tasks, so every switch walks a
+// ready list whose TCBs are spread over the heap. Compare the result with
+// configUSE_TCB_COLD_BLOCK and configTCB_POOL_LENGTH set and unset.
+static void prvBenchmarkContextSwitch(void) {
+    uint64_t start, us;
+    uint64_t switches = (uint64_t)SWITCH_TASKS * SWITCH_ROUNDS;
+    uint64_t mhz = clock_get_hz(clk_sys) / 1000000;
+
+    vTraceRecorderStop();
+    ulYieldTasksDone = 0;
+
+    // Create the tasks with the scheduler suspended so they all start together.
+    vTaskSuspendAll();
+    for (int t = 0; t < SWITCH_TASKS; t++) {
+        xTaskCreate(vYieldTask, "Yield", configMINIMAL_STACK_SIZE, NULL,
+                    uxTaskPriorityGet(NULL) + 1, NULL);
+    }
+    start = time_us_64();
+    (void)xTaskResumeAll();
+
+    // The yield tasks run above this one, so this only runs again once they
+    // are all done, or while another core runs some of them.
+    while (ulYieldTasksDone < SWITCH_TASKS) {
+        taskYIELD();
+    }
+    us = time_us_64() - start;
+
+    // Let the idle task free the deleted tasks.
+    vTaskDelay(pdMS_TO_TICKS(10));
+    prvDrainAndDiscard();
+    vTraceRecorderStart();
+
+    // Every core switches in parallel, so count the time of each.
+    uint64_t centi_cycles = (us * configNUMBER_OF_CORES * mhz * 100) / switches;
+    printf("Context switch (%d tasks x %d yields, cold block %s, TCB pool %d)\n", SWITCH_TASKS,
+           SWITCH_ROUNDS, configUSE_TCB_COLD_BLOCK ? "on" : "off", configTCB_POOL_LENGTH);
+    printf("  %-22s %4lu.%02lu cycles/switch  (%llu us for %llu switches)\n\n", "yield",
+           (unsigned long)(centi_cycles / 100), (unsigned long)(centi_cycles % 100),
+           (unsigned long long)us, (unsigned long long)switches);
+}
+
+#if ( configUSE_QUEUE_FAST_PATHS == 1 )
+
+static SemaphoreHandle_t xBenchSemaphore, xBenchMutex;
+static QueueHandle_t xBenchPointerQueue;
+
+// One operation pair per iteration, each batch run with interrupts masked.
+static void prvSemaphoreGeneric(void) {
+    for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+        xQueueGenericSend(xBenchSemaphore, NULL, 0, queueSEND_TO_BACK);
+        xSemaphoreTake(xBenchSemaphore, 0);
+    }
+}
+
+static void prvSemaphoreFast(void) {
+    for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+        xSemaphoreGive(xBenchSemaphore);
+        xSemaphoreTake(xBenchSemaphore, 0);
+    }
+}
+
+static void prvMutexGeneric(void) {
+    for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+        xSemaphoreTake(xBenchMutex, 0);
+        xQueueGenericSend(xBenchMutex, NULL, 0, queueSEND_TO_BACK);
+    }
+}
+
+static void prvMutexFast(void) {
+    for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+        xSemaphoreTake(xBenchMutex, 0);
+        xSemaphoreGive(xBenchMutex);
+    }
+}
+
+static void prvPointerGeneric(void) {
+    void *item = &xBenchPointerQueue;
+    for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+        xQueueSend(xBenchPointerQueue, &item, 0);
+        xQueueReceive(xBenchPointerQueue, &item, 0);
+    }
+}
+
+static void prvPointerFast(void) {
+    void *item = &xBenchPointerQueue;
+    for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+        xQueueSendPointer(xBenchPointerQueue, item, 0);
+        xQueueReceivePointer(xBenchPointerQueue, &item, 0);
+    }
+}
+
+static void prvEmptyLoop(void) {
+    volatile uint32_t sink = 0;
+    for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+        sink += i;
+    }
+}
+
+static uint64_t prvTimeRounds(void (*batch)(void)) {
+    uint64_t us = 0;
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        taskENTER_CRITICAL();
+        uint32_t start = time_us_32();
+        batch();
+        us += time_us_32() - start;
+        taskEXIT_CRITICAL();
+    }
+    return us;
+}
+
+// Generic queue functions against the specialised fast paths.
+static void prvBenchmarkQueueFastPaths(void) {
+    xBenchSemaphore = xSemaphoreCreateBinary();
+    xBenchMutex = xSemaphoreCreateMutex();
+    xBenchPointerQueue = xQueueCreate(4, sizeof(void *));
+    vTraceRecorderStop();
+
+    uint64_t loop_us = prvTimeRounds(prvEmptyLoop);
+    printf("Queue fast paths (%d x %d pairs)\n", BATCH_ROUNDS, BATCH_EVENTS);
+    prvReportPer("semaphore generic", "pair", prvTimeRounds(prvSemaphoreGeneric), loop_us);
+    prvReportPer("semaphore fast", "pair", prvTimeRounds(prvSemaphoreFast), loop_us);
+    prvReportPer("mutex generic", "pair", prvTimeRounds(prvMutexGeneric), loop_us);
+    prvReportPer("mutex fast", "pair", prvTimeRounds(prvMutexFast), loop_us);
+    prvReportPer("pointer queue generic", "pair", prvTimeRounds(prvPointerGeneric), loop_us);
+    prvReportPer("pointer queue fast", "pair", prvTimeRounds(prvPointerFast), loop_us);
+    printf("\n");
+
+    prvDrainAndDiscard();
+    vTraceRecorderStart();
+    vSemaphoreDelete(xBenchSemaphore);
+    vSemaphoreDelete(xBenchMutex);
+    vQueueDelete(xBenchPointerQueue);
+}
+
+#endif /* configUSE_QUEUE_FAST_PATHS */
+
+// Send and receive one item per iteration, from task or ISR API.
+static uint64_t prvTimeCopyRounds(QueueHandle_t queue, bool from_isr) {
+    uint64_t item[2] = {0};
+    BaseType_t woken = pdFALSE;
+    uint64_t us = 0;
+
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        taskENTER_CRITICAL();
+        uint32_t start = time_us_32();
+        if (from_isr) {
+            for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+                xQueueSendFromISR(queue, item, &woken);
+                xQueueReceiveFromISR(queue, item, &woken);
+            }
+        } else {
+            for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+                xQueueSend(queue, item, 0);
+                xQueueReceive(queue, item, 0);
+            }
+        }
+        us += time_us_32() - start;
+        taskEXIT_CRITICAL();
+    }
+    return us;
+}
+
+// Send/receive cost by item size. 12 bytes always goes through memcpy(), so
+// compare the other sizes against it, and against a build with
+// configUSE_QUEUE_SCALAR_COPY set to 0.
+static void prvBenchmarkQueueCopy(void) {
+    static const UBaseType_t sizes[] = {1, 2, 4, 8, 12};
+    uint64_t loop_us = 0;
+    char name[24];
+
+    vTraceRecorderStop();
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        loop_us += prvTimeBatch(false);
+    }
+
+    printf("Queue item copy (%d x %d pairs, scalar copy %s)\n", BATCH_ROUNDS, BATCH_EVENTS,
+           configUSE_QUEUE_SCALAR_COPY ? "on" : "off");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        QueueHandle_t queue = xQueueCreate(4, sizes[s]);
+        snprintf(name, sizeof(name), "%u byte", (unsigned)sizes[s]);
+        prvReportPer(name, "pair", prvTimeCopyRounds(queue, false), loop_us);
+        snprintf(name, sizeof(name), "%u byte FromISR", (unsigned)sizes[s]);
+        prvReportPer(name, "pair", prvTimeCopyRounds(queue, true), loop_us);
+        vQueueDelete(queue);
+    }
+    printf("\n");
+
+    prvDrainAndDiscard();
+    vTraceRecorderStart();
+}
+
+// Only runs on a core with nothing else to do; the tasks are deleted once created.
+static void vBootTask(void *pvParameters) {
+    (void)pvParameters;
+    for (;;) {
+        vTaskSuspend(NULL);
+    }
+}
+
+// Create BOOT_TASKS idle priority tasks one by one, or with one
+// xTaskCreateMultiple() call, and return how long that took.
+static uint64_t prvTimeTaskCreation(bool multiple, eTaskStackFill fill) {
+    static TaskHandle_t handles[BOOT_TASKS];
+    static TaskCreateParameters_t tasks[BOOT_TASKS];
+    uint64_t start, us;
+
+    for (int t = 0; t < BOOT_TASKS; t++) {
+        handles[t] = NULL;
+        tasks[t] = (TaskCreateParameters_t){vBootTask, "Boot", configMINIMAL_STACK_SIZE, NULL,
+                                            tskIDLE_PRIORITY, fill, &handles[t]};
+    }
+
+    start = time_us_64();
+    if (multiple) {
+#if ( configUSE_TASK_CREATE_MULTIPLE == 1 )
+        (void)xTaskCreateMultiple(tasks, BOOT_TASKS);
+#endif
+    } else {
+        for (int t = 0; t < BOOT_TASKS; t++) {
+            (void)xTaskCreate(vBootTask, "Boot", configMINIMAL_STACK_SIZE, NULL,
+                              tskIDLE_PRIORITY, &handles[t]);
+        }
+    }
+    us = time_us_64() - start;
+
+    // Let the idle task free the tasks again.
+    for (int t = 0; t < BOOT_TASKS; t++) {
+        if (handles[t] != NULL) {
+            vTaskDelete(handles[t]);
+        }
+    }
+    vTaskDelay(pdMS_TO_TICKS(10));
+
+    return us;
+}
+
+static void prvReportCreation(const char *name, uint64_t us) {
+    uint64_t centi_us = (us * 100) / BOOT_TASKS;
+
+    printf("  %-22s %4lu.%02lu us/task  (%llu us for %d tasks)\n", name,
+           (unsigned long)(centi_us / 100), (unsigned long)(centi_us % 100),
+           (unsigned long long)us, BOOT_TASKS);
+}
+
+// Boot style creation of many tasks with configMINIMAL_STACK_SIZE words of
+// stack. The stack fill dominates, so compare the fill modes as well as the
+// cost of taking the critical section per task.
+static void prvBenchmarkTaskCreation(void) {
+    vTraceRecorderStop();
+
+    printf("Task creation (%d tasks of %d words)\n", BOOT_TASKS, (int)configMINIMAL_STACK_SIZE);
+    prvReportCreation("xTaskCreate", prvTimeTaskCreation(false, eTaskStackFillFull));
+#if ( configUSE_TASK_CREATE_MULTIPLE == 1 )
+    prvReportCreation("multiple, full fill", prvTimeTaskCreation(true, eTaskStackFillFull));
+#if ( configUSE_STACK_FILL_ELISION == 1 )
+    prvReportCreation("multiple, idle fill", prvTimeTaskCreation(true, eTaskStackFillIdle));
+    prvReportCreation("multiple, guard fill", prvTimeTaskCreation(true, eTaskStackFillGuard));
+#endif
+#endif
+    printf("\n");
+
+    prvDrainAndDiscard();
+    vTraceRecorderStart();
+}
+
+#if ( configUSE_LIST_TREE_INDEX == 1 )
+
+static ListItem_t xListItems[LIST_MAX_ITEMS + 1];
+static TickType_t xProbeValues[BATCH_EVENTS];
+
+static uint32_t prvRandom(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// Sort n items with random values into a plain or an indexed list, then time
+// inserting and removing one more item, as a task blocking with a timeout
+// does with the delayed list.
+static uint64_t prvTimeListInserts(bool indexed, int n) {
+    List_t list;
+    ListItem_t *probe = &xListItems[n];
+    uint32_t seed = 1;
+    uint64_t us = 0;
+
+    if (indexed) {
+        vListInitialiseIndexed(&list);
+    } else {
+        vListInitialise(&list);
+    }
+    for (int i = 0; i < n; i++) {
+        vListInitialiseItem(&xListItems[i]);
+        listSET_LIST_ITEM_VALUE(&xListItems[i], prvRandom(&seed) % 10000);
+        vListInsert(&list, &xListItems[i]);
+    }
+    for (int i = 0; i < BATCH_EVENTS; i++) {
+        xProbeValues[i] = prvRandom(&seed) % 10000;
+    }
+    vListInitialiseItem(probe);
+
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        taskENTER_CRITICAL();
+        uint32_t start = time_us_32();
+        for (uint32_t i = 0; i < BATCH_EVENTS; i++) {
+            listSET_LIST_ITEM_VALUE(probe, xProbeValues[i]);
+            vListInsert(&list, probe);
+            (void)uxListRemove(probe);
+        }
+        us += time_us_32() - start;
+        taskEXIT_CRITICAL();
+    }
+
+    for (int i = 0; i < n; i++) {
+        (void)uxListRemove(&xListItems[i]);
+    }
+    return us;
+}
+
+// Sorted insertion cost by list length, through the linear walk and through
+// the red-black tree. The tree wins from the reported crossover length on.
+static void prvBenchmarkListIndex(void) {
+    uint64_t loop_us = 0;
+    int crossover = 0;
+    char name[24];
+
+    vTraceRecorderStop();
+    for (int r = 0; r < BATCH_ROUNDS; r++) {
+        loop_us += prvTimeBatch(false);
+    }
+
+    printf("Sorted list insert/remove (%d x %d pairs)\n", BATCH_ROUNDS, BATCH_EVENTS);
+    for (int n = 2; n <= LIST_MAX_ITEMS; n *= 2) {
+        uint64_t linear_us = prvTimeListInserts(false, n);
+        uint64_t indexed_us = prvTimeListInserts(true, n);
+
+        snprintf(name, sizeof(name), "%d items linear", n);
+        prvReportPer(name, "pair", linear_us, loop_us);
+        snprintf(name, sizeof(name), "%d items indexed", n);
+        prvReportPer(name, "pair", indexed_us, loop_us);
+        if ((crossover == 0) && (indexed_us < linear_us)) {
+            crossover = n;
+        }
+    }
+    if (crossover != 0) {
+        printf("  indexed lists are faster from %d items\n\n", crossover);
+    } else {
+        printf("  indexed lists are slower up to %d items\n\n", LIST_MAX_ITEMS);
+    }
+
+    prvDrainAndDiscard();
+    vTraceRecorderStart();
+}
+
+#endif /* configUSE_LIST_TREE_INDEX */
+
+/* ── Traced workload ─────────────────────────────────────────── */
+
+static QueueHandle_t xWorkQueue;
+static TaskHandle_t xProducer, xConsumer;
+static JobMonitor_t xProducerJobs;
+
+static void vProducerTask(void *pvParameters) {
+    (void)pvParameters;
+    TickType_t xLastWake = xTaskGetTickCount();
+    uint32_t n = 0;
+
+    // Every xTaskDelayUntil() call completes a job; the deadline is the period.
+    vTaskSetJobMonitor(NULL, &xProducerJobs, 0);
+
+    for (;;) {
+        xQueueSend(xWorkQueue, &n, portMAX_DELAY);
+        n++;
+        xTaskDelayUntil(&xLastWake, pdMS_TO_TICKS(10));
+    }
+}
+
+static void vConsumerTask(void *pvParameters) {
+    (void)pvParameters;
+    uint32_t n;
+
+    // Each item must be handled within 5 ms; trace_gantt.py flags late jobs.
+    vTraceRecorderSetDeadline(NULL, pdMS_TO_TICKS(5));
+
+    for (;;) {
+        xQueueReceive(xWorkQueue, &n, portMAX_DELAY);
+        busy_wait_us_32(500);
+    }
+}
+
+// Per-core load over the workload window and per-task run time, in us.
+static void prvReportRunTime(CoreRunTimeStats_t *samples) {
+    CoreRunTimeStats_t stats;
+
+    printf("Run time over the last %d ms\n", WORKLOAD_MS);
+    for (BaseType_t core = 0; core < configNUMBER_OF_CORES; core++) {
+        unsigned long load = (unsigned long)ulTaskGetCoreLoadPercent(core, &samples[core]);
+        vTaskGetCoreRunTimeStats(core, &stats);
+        printf("  core %ld: %3lu%% busy, idle %lu%% since start, %llu us in ISRs\n", (long)core, load,
+               (unsigned long)ulTaskGetCoreIdleRunTimePercent(core), (unsigned long long)stats.ulISRTime);
+    }
+    printf("  Producer %llu us, Consumer %llu us\n\n",
+           (unsigned long long)ulTaskGetRunTimeCounter(xProducer),
+           (unsigned long long)ulTaskGetRunTimeCounter(xConsumer));
+}
+
+// Response time, jitter and execution time of the producer's periodic jobs, in us.
+static void prvReportJobs(void) {
+    JobStats_t stats;
+
+    vTaskGetJobStats(xProducer, &stats);
+    printf("Producer jobs: %lu completed, %lu missed (worst %lu ticks late)\n",
+           (unsigned long)stats.ulCompletedJobs, (unsigned long)stats.ulDeadlineMisses,
+           (unsigned long)stats.xMaxLateness);
+    printf("  response min %llu max %llu us, jitter max %llu us, execution max %llu us\n\n",
+           (unsigned long long)stats.ulMinResponseTime, (unsigned long long)stats.ulMaxResponseTime,
+           (unsigned long long)stats.ulMaxReleaseJitter, (unsigned long long)stats.ulMaxExecutionTime);
+}
+
+// Sampled stack high water mark of every task, read without suspending the scheduler.
+static void prvReportStacks(void) {
+    static TaskStackStatus_t status[8];
+    UBaseType_t count = uxTaskGetStackReport(status, 8);
+
+    printf("Free stack (words, sampled at context switches)\n");
+    for (UBaseType_t i = 0; i < count; i++) {
+        printf("  %-12s %5lu\n", status[i].pcTaskName, (unsigned long)status[i].usStackHighWaterMark);
+    }
+    printf("\n");
+}
+
+// State, priority and run time of every task, read without suspending the scheduler.
+static void prvReportTasks(void) {
+    static const char states[] = "RrBSDX";
+    static TaskSnapshot_t snap[8];
+    UBaseType_t count = uxTaskGetSystemSnapshot(snap, 8);
+
+    printf("Tasks (state, priority/base, run time us)\n");
+    for (UBaseType_t i = 0; i < count; i++) {
+        printf("  %-12s %c %2lu/%-2lu %10llu\n", snap[i].pcTaskName, states[snap[i].eCurrentState],
+               (unsigned long)snap[i].uxCurrentPriority, (unsigned long)snap[i].uxBasePriority,
+               (unsigned long long)snap[i].ulRunTimeCounter);
+    }
+    printf("\n");
+}
+
+// Print every non-empty latency histogram, with the worst sample and its source.
+static void prvReportLatency(void) {
+    static const char *const names[] = {"interrupts masked", "scheduler suspended",
+                                        "ISR duration", "ISR to task"};
+    LatencyHistogram_t hist;
+
+    printf("Latency histograms (us, bucket n holds [2^(n-1), 2^n))\n");
+    for (BaseType_t core = 0; core < configNUMBER_OF_CORES; core++) {
+        for (int type = 0; type < (int)latencyNUM_HISTOGRAM_TYPES; type++) {
+            vLatencyHistogramGet(core, (eLatencyHistogramType)type, &hist);
+            if (hist.ulSamples == 0) {
+                continue;
+            }
+            printf("  core %ld %-20s n=%lu max=%lu source=0x%08lx\n    ", (long)core, names[type],
+                   (unsigned long)hist.ulSamples, (unsigned long)hist.ulMax, (unsigned long)hist.ulMaxSource);
+            for (int b = 0; b < (int)configLATENCY_HISTOGRAM_BUCKETS; b++) {
+                if (hist.ulBuckets[b] != 0) {
+                    printf(" [%d]=%lu", b, (unsigned long)hist.ulBuckets[b]);
+                }
+            }
+            printf("\n");
+        }
+    }
+    printf("\n");
+}
+
+// Export the metrics of every kernel object as OBM:<hex> lines for object_metrics_decode.py.
+static void prvReportObjects(void) {
+    static uint8_t buffer[1024];
+    size_t length = xObjectMetricsExport(buffer, sizeof(buffer));
+
+    printf("=== OBJECT METRICS (%u bytes) ===\n", (unsigned)length);
+    for (size_t off = 0; off < length; off += OBM_LINE_BYTES) {
+        printf("OBM:");
+        for (size_t b = off; (b < length) && (b < off + OBM_LINE_BYTES); b++) {
+            printf("%02x", buffer[b]);
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
+
+// Profiler overhead, then task names as PRT: lines and the samples as PRF:<hex> lines for sampling_profile.py.
+static void prvReportProfile(void) {
+    static ProfilerSample_t samples[DRAIN_CHUNK];
+    static TaskSnapshot_t snap[8];
+    uint64_t cycles = (uint64_t)clock_get_hz(clk_sys) * WORKLOAD_MS / 1000;
+    ProfilerStats_t stats;
+    size_t count;
+
+    printf("=== PROFILE BEGIN ===\n");
+    for (BaseType_t core = 0; core < configNUMBER_OF_CORES; core++) {
+        vSamplingProfilerGetStats(core, &stats);
+        uint32_t milli = (uint32_t)((uint64_t)stats.ulTotalCycles * 100000ULL / cycles);
+        printf("core %ld: %lu samples, %lu dropped, handler max %lu cycles, overhead %lu.%03lu%%\n", (long)core,
+               (unsigned long)stats.ulSamples, (unsigned long)stats.ulDropped, (unsigned long)stats.ulMaxCycles,
+               (unsigned long)(milli / 1000), (unsigned long)(milli % 1000));
+    }
+
+    UBaseType_t tasks = uxTaskGetSystemSnapshot(snap, 8);
+    for (UBaseType_t i = 0; i < tasks; i++) {
+        printf("PRT:%08lx %s\n", (unsigned long)(uintptr_t)snap[i].xHandle, snap[i].pcTaskName);
+    }
+
+    for (BaseType_t core = 0; core < configNUMBER_OF_CORES; core++) {
+        while ((count = xSamplingProfilerRead(core, samples, DRAIN_CHUNK)) > 0) {
+            for (size_t i = 0; i < count; i++) {
+                const uint8_t *p = (const uint8_t *)&samples[i];
+                printf("PRF:");
+                for (size_t b = 0; b < sizeof(ProfilerSample_t); b++) {
+                    printf("%02x", p[b]);
+                }
+                printf("\n");
+            }
+        }
+    }
+    printf("=== PROFILE END ===\n\n");
+}
+
+// Stream the recorder contents as TRC:<hex> lines for trace_decode.py.
+static void prvStreamTrace(void) {
+    size_t count;
+
+    for (BaseType_t core = 0; core < configNUMBER_OF_CORES; core++) {
+        while ((count = xTraceRecorderRead(core, xScratch, DRAIN_CHUNK)) > 0) {
+            for (size_t i = 0; i < count; i++) {
+                const uint8_t *p = (const uint8_t *)&xScratch[i];
+                printf("TRC:");
+                for (size_t b = 0; b < sizeof(TraceEvent_t); b++) {
+                    printf("%02x", p[b]);
+                }
+                printf("\n");
+            }
+        }
+    }
+}
+
+static void vBenchmarkTask(void *pvParameters) {
+    (void)pvParameters;
+
+    prvBenchmarkTraceRecorder();
+    prvBenchmarkContextSwitch();
+#if ( configUSE_QUEUE_FAST_PATHS == 1 )
+    prvBenchmarkQueueFastPaths();
+#endif
+    prvBenchmarkQueueCopy();
+    prvBenchmarkTaskCreation();
+#if ( configUSE_LIST_TREE_INDEX == 1 )
+    prvBenchmarkListIndex();
+#endif
+
+    // Trace a short producer/consumer run, then dump it.
+    prvDrainAndDiscard();
+    vTraceRecorderStart();
+    xWorkQueue = xQueueCreate(4, sizeof(uint32_t));
+    vQueueAddToRegistry(xWorkQueue, "WorkQ");
+    xTaskCreate(vProducerTask, "Producer", 256, NULL, 3, &xProducer);
+    xTaskCreate(vConsumerTask, "Consumer", 256, NULL, 2, &xConsumer);
+
+    // Sample the core counters around the workload to get its utilisation.
+    vLatencyHistogramReset();
+    vObjectMetricsReset();
+    vSamplingProfilerReset();
+    vSamplingProfilerStart();
+    CoreRunTimeStats_t samples[configNUMBER_OF_CORES] = {0};
+    for (BaseType_t core = 0; core < configNUMBER_OF_CORES; core++) {
+        (void)ulTaskGetCoreLoadPercent(core, &samples[core]);
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(WORKLOAD_MS));
+    vTraceRecorderStop();
+    vSamplingProfilerStop();
+
+    prvReportRunTime(samples);
+    prvReportLatency();
+    prvReportJobs();
+    prvReportStacks();
+    prvReportTasks();
+    prvReportObjects();
+    prvReportProfile();
+
+    printf("=== TRACE BEGIN ===\n");
+    prvStreamTrace();
+    printf("=== TRACE END (dropped %lu) ===\n", (unsigned long)ulTraceRecorderGetDropped(0));
+
+    for (;;) {
+        vTaskDelay(portMAX_DELAY);
+    }
+}
+
+int main(void) {
+    stdio_init_all();
+    sleep_ms(2000);  // Give serial monitor time to connect
+
+    printf("\n\n=== FreeRTOS Benchmark ===\n");
+
+    vTraceRecorderStart();
+    xTaskCreate(vBenchmarkTask, "Bench", 1024, NULL, configMAX_PRIORITIES - 2, NULL);
+
+    vTaskStartScheduler();
+
+    printf("ERROR: Scheduler exited!\n");
+    for (;;);
+}
+
+/* FreeRTOS hook functions required by the config */
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName) {
+    (void)xTask;
+    printf("STACK OVERFLOW: %s\n", pcTaskName);
+    for (;;);
+}
+
+void vApplicationDeadlineMissHook(TaskHandle_t xTask, TickType_t xTicksLate) {
+    (void)xTask;
+    (void)xTicksLate;
+    // Counted in the job statistics; printing here would disturb the schedule.
+}
+
+void vApplicationTickHook(void) {
+}
+
+void vApplicationMallocFailedHook(void) {
+    printf("MALLOC FAILED!\n");
+    for (;;);
+}
@@ -0,0 +1,603 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "admission_control.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include admission control. */
+#if ( configUSE_ADMISSION_CONTROL == 1 )
+
+    #if ( configADMISSION_PRIORITY_ASSIGNMENT != 0 )
+        #if ( ( configADMISSION_LOWEST_PRIORITY > configADMISSION_HIGHEST_PRIORITY ) || ( configADMISSION_HIGHEST_PRIORITY >= configMAX_PRIORITIES ) )
+            #error configADMISSION_LOWEST_PRIORITY and configADMISSION_HIGHEST_PRIORITY must be valid priorities, lowest first.
+        #endif
+    #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        #define admissionSAME_CORE( pxA, pxB )    ( ( pxA )->xCoreID == ( pxB )->xCoreID )
+    #else
+        #define admissionSAME_CORE( pxA, pxB )    ( pdTRUE )
+    #endif
+
+/* The admitted tasks, highest priority first. */
+    PRIVILEGED_DATA static AdmissionTask_t * pxAdmittedTasks = NULL;
+
+/*
+ * The value the admitted tasks are ordered by: the period or deadline when
+ * priorities are assigned automatically, otherwise the inverse of the
+ * priority.
+ */
+    static configRUN_TIME_COUNTER_TYPE prvOrderKey( const AdmissionTask_t * pxAdmission );
+
+/*
+ * Insert pxAdmission into, or remove it from, the list of admitted tasks.
+ */
+    static void prvLink( AdmissionTask_t * pxAdmission );
+    static void prvUnlink( const AdmissionTask_t * pxAdmission );
+
+/*
+ * Assign rate or deadline monotonic priorities in list order.  Does nothing
+ * when the application chooses the priorities.
+ */
+    static void prvAssignPriorities( void );
+
+/*
+ * Set the priority of every created task to the priority assigned to it.
+ */
+    static void prvApplyPriorities( void );
+
+/*
+ * Worst case interference pxAdmission suffers from the tasks of equal or
+ * higher priority on its core in a window of ulWindow.  Stops adding once the
+ * total exceeds ulLimit, and then returns a value greater than ulLimit.
+ */
+    static configRUN_TIME_COUNTER_TYPE prvInterference( const AdmissionTask_t * pxAdmission,
+                                                        configRUN_TIME_COUNTER_TYPE ulWindow,
+                                                        configRUN_TIME_COUNTER_TYPE ulLimit );
+
+/*
+ * Run the response time analysis over all admitted tasks, writing the result
+ * into ulCandidateTime.  Each iteration starts from the last committed
+ * response time, which must not be larger than the new one.  Returns pdPASS if
+ * every task meets its deadline.  Unless xAnalyseAll is pdTRUE the analysis
+ * stops at the first task that misses its deadline.
+ */
+    static BaseType_t prvAnalyse( BaseType_t xAnalyseAll );
+
+/*
+ * Make the candidate response times the committed ones.
+ */
+    static void prvCommit( void );
+
+/*
+ * Remove pxAdmission from the task set and analyse what is left from scratch,
+ * as the remaining response times can only get shorter.
+ */
+    static void prvRemove( const AdmissionTask_t * pxAdmission );
+
+/*-----------------------------------------------------------*/
+
+    static configRUN_TIME_COUNTER_TYPE prvOrderKey( const AdmissionTask_t * pxAdmission )
+    {
+        configRUN_TIME_COUNTER_TYPE ulKey;
+
+        #if ( configADMISSION_PRIORITY_ASSIGNMENT == 1 )
+        {
+            ulKey = pxAdmission->ulPeriod;
+        }
+        #elif ( configADMISSION_PRIORITY_ASSIGNMENT == 2 )
+        {
+            ulKey = pxAdmission->ulDeadline;
+        }
+        #else
+        {
+            ulKey = ( configRUN_TIME_COUNTER_TYPE ) ( ( UBaseType_t ) configMAX_PRIORITIES - pxAdmission->uxPriority );
+        }
+        #endif
+
+        return ulKey;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvLink( AdmissionTask_t * pxAdmission )
+    {
+        AdmissionTask_t ** ppxLink = &pxAdmittedTasks;
+        const configRUN_TIME_COUNTER_TYPE ulKey = prvOrderKey( pxAdmission );
+
+        /* After any task with the same key, so earlier tasks keep their
+         * place. */
+        while( ( *ppxLink != NULL ) && ( prvOrderKey( *ppxLink ) <= ulKey ) )
+        {
+            ppxLink = &( ( *ppxLink )->pxNext );
+        }
+
+        pxAdmission->pxNext = *ppxLink;
+        *ppxLink = pxAdmission;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvUnlink( const AdmissionTask_t * pxAdmission )
+    {
+        AdmissionTask_t ** ppxLink;
+
+        for( ppxLink = &pxAdmittedTasks; *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxNext ) )
+        {
+            if( *ppxLink == pxAdmission )
+            {
+                *ppxLink = pxAdmission->pxNext;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAssignPriorities( void )
+    {
+        #if ( configADMISSION_PRIORITY_ASSIGNMENT != 0 )
+        {
+            AdmissionTask_t * pxAdmission;
+            UBaseType_t uxPriority = ( UBaseType_t ) configADMISSION_HIGHEST_PRIORITY;
+            configRUN_TIME_COUNTER_TYPE ulPreviousKey = 0U;
+
+            for( pxAdmission = pxAdmittedTasks; pxAdmission != NULL; pxAdmission = pxAdmission->pxNext )
+            {
+                /* Equal keys share a priority, and once the priorities run
+                 * out the remaining tasks share the lowest one. */
+                if( ( pxAdmission != pxAdmittedTasks ) &&
+                    ( prvOrderKey( pxAdmission ) != ulPreviousKey ) &&
+                    ( uxPriority > ( UBaseType_t ) configADMISSION_LOWEST_PRIORITY ) )
+                {
+                    uxPriority--;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxAdmission->uxPriority = uxPriority;
+                ulPreviousKey = prvOrderKey( pxAdmission );
+            }
+        }
+        #endif /* if ( configADMISSION_PRIORITY_ASSIGNMENT != 0 ) */
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvApplyPriorities( void )
+    {
+        #if ( configADMISSION_PRIORITY_ASSIGNMENT != 0 )
+        {
+            const AdmissionTask_t * pxAdmission;
+
+            for( pxAdmission = pxAdmittedTasks; pxAdmission != NULL; pxAdmission = pxAdmission->pxNext )
+            {
+                /* A task that is still being created has no handle yet. */
+                if( pxAdmission->xTask != NULL )
+                {
+                    vTaskPrioritySet( pxAdmission->xTask, pxAdmission->uxPriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        #endif /* if ( configADMISSION_PRIORITY_ASSIGNMENT != 0 ) */
+    }
+/*-----------------------------------------------------------*/
+
+    static configRUN_TIME_COUNTER_TYPE prvInterference( const AdmissionTask_t * pxAdmission,
+                                                        configRUN_TIME_COUNTER_TYPE ulWindow,
+                                                        configRUN_TIME_COUNTER_TYPE ulLimit )
+    {
+        const AdmissionTask_t * pxOther;
+        configRUN_TIME_COUNTER_TYPE ulJobs;
+        configRUN_TIME_COUNTER_TYPE ulExecutionTime;
+        configRUN_TIME_COUNTER_TYPE ulTotal = 0U;
+
+        for( pxOther = pxAdmittedTasks; pxOther != NULL; pxOther = pxOther->pxNext )
+        {
+            if( ( pxOther != pxAdmission ) &&
+                ( pxOther->uxPriority >= pxAdmission->uxPriority ) &&
+                ( admissionSAME_CORE( pxOther, pxAdmission ) != pdFALSE ) )
+            {
+                /* Releases of the other task within the window, rounded up.
+                 * Written so that none of the terms can overflow. */
+                ulJobs = ulWindow / pxOther->ulPeriod;
+
+                if( ( ulWindow % pxOther->ulPeriod ) != 0U )
+                {
+                    ulJobs++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                ulExecutionTime = ( pxOther->ulObservedTime > pxOther->ulExecutionTime ) ? pxOther->ulObservedTime : pxOther->ulExecutionTime;
+
+                if( ( ulJobs > ( ulLimit / ulExecutionTime ) ) ||
+                    ( ( ulJobs * ulExecutionTime ) > ( ulLimit - ulTotal ) ) )
+                {
+                    ulTotal = ulLimit + 1U;
+                    break;
+                }
+                else
+                {
+                    ulTotal += ulJobs * ulExecutionTime;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return ulTotal;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvAnalyse( BaseType_t xAnalyseAll )
+    {
+        AdmissionTask_t * pxAdmission;
+        configRUN_TIME_COUNTER_TYPE ulOwnTime;
+        configRUN_TIME_COUNTER_TYPE ulResponseTime;
+        configRUN_TIME_COUNTER_TYPE ulNextResponseTime;
+        configRUN_TIME_COUNTER_TYPE ulInterference;
+        BaseType_t xReturn = pdPASS;
+
+        for( pxAdmission = pxAdmittedTasks; pxAdmission != NULL; pxAdmission = pxAdmission->pxNext )
+        {
+            ulOwnTime = ( pxAdmission->ulObservedTime > pxAdmission->ulExecutionTime ) ? pxAdmission->ulObservedTime : pxAdmission->ulExecutionTime;
+
+            if( ( ulOwnTime > pxAdmission->ulDeadline ) ||
+                ( pxAdmission->ulBlockingTime > ( pxAdmission->ulDeadline - ulOwnTime ) ) )
+            {
+                ulResponseTime = pxAdmission->ulDeadline + 1U;
+            }
+            else
+            {
+                ulOwnTime += pxAdmission->ulBlockingTime;
+                ulResponseTime = ( pxAdmission->ulResponseTime > ulOwnTime ) ? pxAdmission->ulResponseTime : ulOwnTime;
+
+                /* R(n+1) = C + B + sum over hp of ceil( R(n) / T ) * C,
+                 * until it stops growing or passes the deadline. */
+                while( ulResponseTime <= pxAdmission->ulDeadline )
+                {
+                    ulInterference = prvInterference( pxAdmission, ulResponseTime, pxAdmission->ulDeadline - ulOwnTime );
+
+                    if( ulInterference > ( pxAdmission->ulDeadline - ulOwnTime ) )
+                    {
+                        ulResponseTime = pxAdmission->ulDeadline + 1U;
+                    }
+                    else
+                    {
+                        ulNextResponseTime = ulOwnTime + ulInterference;
+
+                        if( ulNextResponseTime <= ulResponseTime )
+                        {
+                            break;
+                        }
+                        else
+                        {
+                            ulResponseTime = ulNextResponseTime;
+                        }
+                    }
+                }
+            }
+
+            pxAdmission->ulCandidateTime = ulResponseTime;
+
+            if( ulResponseTime > pxAdmission->ulDeadline )
+            {
+                xReturn = pdFAIL;
+
+                if( xAnalyseAll == pdFALSE )
+                {
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCommit( void )
+    {
+        AdmissionTask_t * pxAdmission;
+
+        for( pxAdmission = pxAdmittedTasks; pxAdmission != NULL; pxAdmission = pxAdmission->pxNext )
+        {
+            pxAdmission->ulResponseTime = pxAdmission->ulCandidateTime;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRemove( const AdmissionTask_t * pxAdmission )
+    {
+        AdmissionTask_t * pxIterator;
+
+        prvUnlink( pxAdmission );
+        prvAssignPriorities();
+
+        for( pxIterator = pxAdmittedTasks; pxIterator != NULL; pxIterator = pxIterator->pxNext )
+        {
+            pxIterator->ulResponseTime = 0U;
+        }
+
+        ( void ) prvAnalyse( pdTRUE );
+        prvCommit();
+    }
+/*-----------------------------------------------------------*/
+
+    void vAdmissionParametersInit( AdmissionTask_t * pxAdmission,
+                                   configRUN_TIME_COUNTER_TYPE ulPeriod,
+                                   configRUN_TIME_COUNTER_TYPE ulDeadline,
+                                   configRUN_TIME_COUNTER_TYPE ulExecutionTime,
+                                   configRUN_TIME_COUNTER_TYPE ulBlockingTime,
+                                   BaseType_t xCoreID )
+    {
+        configASSERT( pxAdmission != NULL );
+        configASSERT( ( ulExecutionTime != 0U ) && ( ulExecutionTime <= ulDeadline ) );
+        configASSERT( ulDeadline <= ulPeriod );
+
+        ( void ) memset( ( void * ) pxAdmission, 0x00, sizeof( AdmissionTask_t ) );
+        pxAdmission->ulPeriod = ulPeriod;
+        pxAdmission->ulDeadline = ulDeadline;
+        pxAdmission->ulExecutionTime = ulExecutionTime;
+        pxAdmission->ulBlockingTime = ulBlockingTime;
+
+        #if ( configNUMBER_OF_CORES > 1 )
+        {
+            configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+            pxAdmission->xCoreID = xCoreID;
+        }
+        #else
+        {
+            ( void ) xCoreID;
+        }
+        #endif
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        BaseType_t xAdmissionTaskCreate( TaskFunction_t pxTaskCode,
+                                         const char * const pcName,
+                                         const configSTACK_DEPTH_TYPE uxStackDepth,
+                                         void * const pvParameters,
+                                         UBaseType_t uxPriority,
+                                         AdmissionTask_t * pxAdmission,
+                                         TaskHandle_t * const pxCreatedTask )
+        {
+            TaskHandle_t xTask = NULL;
+            BaseType_t xReturn;
+
+            configASSERT( pxAdmission != NULL );
+            configASSERT( pxAdmission->ulPeriod != 0U );
+            configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+            pxAdmission->uxPriority = uxPriority;
+            pxAdmission->xTask = NULL;
+
+            /* The scheduler is suspended rather than interrupts disabled, as
+             * the analysis can take a while. */
+            vTaskSuspendAll();
+            {
+                prvLink( pxAdmission );
+                prvAssignPriorities();
+
+                xReturn = prvAnalyse( pdFALSE );
+
+                if( xReturn == pdPASS )
+                {
+                    /* Reserve the place of the task while it is created. */
+                    prvCommit();
+                }
+                else
+                {
+                    prvUnlink( pxAdmission );
+                    prvAssignPriorities();
+                }
+            }
+            ( void ) xTaskResumeAll();
+
+            if( xReturn == pdPASS )
+            {
+                #if ( configNUMBER_OF_CORES > 1 )
+                {
+                    xReturn = xTaskCreateAffinitySet( pxTaskCode, pcName, uxStackDepth, pvParameters, pxAdmission->uxPriority, ( ( UBaseType_t ) 1U ) << pxAdmission->xCoreID, &xTask );
+                }
+                #else
+                {
+                    xReturn = xTaskCreate( pxTaskCode, pcName, uxStackDepth, pvParameters, pxAdmission->uxPriority, &xTask );
+                }
+                #endif
+
+                vTaskSuspendAll();
+                {
+                    if( xReturn == pdPASS )
+                    {
+                        pxAdmission->xTask = xTask;
+                        prvApplyPriorities();
+
+                        #if ( ( configUSE_JOB_MONITOR == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+                        {
+                            vTaskSetJobMonitor( xTask, &( pxAdmission->xMonitor ), ( TickType_t ) 0U );
+                        }
+                        #endif
+                    }
+                    else
+                    {
+                        prvRemove( pxAdmission );
+                        prvApplyPriorities();
+                    }
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxCreatedTask != NULL )
+            {
+                *pxCreatedTask = xTask;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xReturn;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vAdmissionRemove( AdmissionTask_t * pxAdmission )
+    {
+        configASSERT( pxAdmission != NULL );
+
+        vTaskSuspendAll();
+        {
+            #if ( ( configUSE_JOB_MONITOR == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+            {
+                if( pxAdmission->xTask != NULL )
+                {
+                    vTaskSetJobMonitor( pxAdmission->xTask, NULL, ( TickType_t ) 0U );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            prvRemove( pxAdmission );
+            prvApplyPriorities();
+            pxAdmission->xTask = NULL;
+        }
+        ( void ) xTaskResumeAll();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xAdmissionUpdate( void )
+    {
+        BaseType_t xReturn;
+
+        #if ( ( configUSE_JOB_MONITOR == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+            AdmissionTask_t * pxAdmission;
+            JobStats_t xStats;
+        #endif
+
+        vTaskSuspendAll();
+        {
+            #if ( ( configUSE_JOB_MONITOR == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+            {
+                for( pxAdmission = pxAdmittedTasks; pxAdmission != NULL; pxAdmission = pxAdmission->pxNext )
+                {
+                    if( pxAdmission->xTask != NULL )
+                    {
+                        vTaskGetJobStats( pxAdmission->xTask, &xStats );
+
+                        /* Only ever grows, so the committed response times
+                         * are still valid starting points. */
+                        if( xStats.ulMaxExecutionTime > pxAdmission->ulObservedTime )
+                        {
+                            pxAdmission->ulObservedTime = xStats.ulMaxExecutionTime;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            #endif /* if ( ( configUSE_JOB_MONITOR == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) ) */
+
+            xReturn = prvAnalyse( pdTRUE );
+            prvCommit();
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    configRUN_TIME_COUNTER_TYPE ulAdmissionGetSlack( const AdmissionTask_t * pxAdmission )
+    {
+        configRUN_TIME_COUNTER_TYPE ulSlack = 0U;
+
+        configASSERT( pxAdmission != NULL );
+
+        if( pxAdmission->ulResponseTime <= pxAdmission->ulDeadline )
+        {
+            ulSlack = pxAdmission->ulDeadline - pxAdmission->ulResponseTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ulSlack;
+    }
+
+#endif /* configUSE_ADMISSION_CONTROL */
@@ -63,6 +63,10 @@
         #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
             uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the event group is statically allocated to ensure no attempt is made to free the memory. */
         #endif
+
+        #if ( configUSE_OBJECT_METRICS == 1 )
+            ObjectMetrics_t xMetrics;
+        #endif
     } EventGroup_t;
 
 /*-----------------------------------------------------------*/
@@ -122,6 +126,7 @@
                 }
                 #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 
+                objmetricsREGISTER( &( pxEventBits->xMetrics ), pxEventBits, eObjectMetricsEventGroup, NULL );
                 traceEVENT_GROUP_CREATE( pxEventBits );
             }
             else
@@ -167,6 +172,7 @@
                 }
                 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+                objmetricsREGISTER( &( pxEventBits->xMetrics ), pxEventBits, eObjectMetricsEventGroup, NULL );
                 traceEVENT_GROUP_CREATE( pxEventBits );
             }
             else
@@ -192,6 +198,10 @@
         BaseType_t xAlreadyYielded;
         BaseType_t xTimeoutOccurred = pdFALSE;
 
+        #if ( configUSE_OBJECT_METRICS == 1 )
+            uint32_t ulWaitStart = 0U;
+        #endif
+
         traceENTER_xEventGroupSync( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTicksToWait );
 
         configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
@@ -216,6 +226,15 @@
                 /* Rendezvous always clear the bits.  They will have been cleared
                  * already unless this is the only task in the rendezvous. */
                 pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+                #if ( configUSE_OBJECT_METRICS == 1 )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        objmetricsRECEIVE( &( pxEventBits->xMetrics ) );
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                #endif
 
                 xTicksToWait = 0;
             }
@@ -224,6 +243,7 @@
                 if( xTicksToWait != ( TickType_t ) 0 )
                 {
                     traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor );
+                    objmetricsWAIT_START( ulWaitStart );
 
                     /* Store the bits that the calling task is waiting for in the
                      * task's event list item so the kernel knows when a match is
@@ -241,6 +261,15 @@
                     /* The rendezvous bits were not set, but no block time was
                      * specified - just return the current event bit value. */
                     uxReturn = pxEventBits->uxEventBits;
+                    #if ( configUSE_OBJECT_METRICS == 1 )
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            objmetricsRECEIVE_FAILED( &( pxEventBits->xMetrics ) );
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                    #endif
                     xTimeoutOccurred = pdTRUE;
                 }
             }
@@ -286,11 +315,22 @@
                 }
                 taskEXIT_CRITICAL();
 
+                objmetricsWAIT_END( &( pxEventBits->xMetrics ), ulWaitStart, eObjectMetricsReceiveTimedOut );
                 xTimeoutOccurred = pdTRUE;
             }
             else
             {
                 /* The task unblocked because the bits were set. */
+                #if ( configUSE_OBJECT_METRICS == 1 )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        objmetricsRECEIVE( &( pxEventBits->xMetrics ) );
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                #endif
+                objmetricsWAIT_END( &( pxEventBits->xMetrics ), ulWaitStart, eObjectMetricsWaitSatisfied );
             }
 
             /* Control bits might be set as the task had blocked should not be
@@ -320,6 +360,10 @@
         BaseType_t xWaitConditionMet, xAlreadyYielded;
         BaseType_t xTimeoutOccurred = pdFALSE;
 
+        #if ( configUSE_OBJECT_METRICS == 1 )
+            uint32_t ulWaitStart = 0U;
+        #endif
+
         traceENTER_xEventGroupWaitBits( xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait );
 
         /* Check the user is not attempting to wait on the bits used by the kernel
@@ -346,6 +390,15 @@
                  * block. */
                 uxReturn = uxCurrentEventBits;
                 xTicksToWait = ( TickType_t ) 0;
+                #if ( configUSE_OBJECT_METRICS == 1 )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        objmetricsRECEIVE( &( pxEventBits->xMetrics ) );
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                #endif
 
                 /* Clear the wait bits if requested to do so. */
                 if( xClearOnExit != pdFALSE )
@@ -362,6 +415,15 @@
                 /* The wait condition has not been met, but no block time was
                  * specified, so just return the current value. */
                 uxReturn = uxCurrentEventBits;
+                #if ( configUSE_OBJECT_METRICS == 1 )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        objmetricsRECEIVE_FAILED( &( pxEventBits->xMetrics ) );
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                #endif
                 xTimeoutOccurred = pdTRUE;
             }
             else
@@ -391,6 +453,7 @@
                 /* Store the bits that the calling task is waiting for in the
                  * task's event list item so the kernel knows when a match is
                  * found.  Then enter the blocked state. */
+                objmetricsWAIT_START( ulWaitStart );
                 vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
 
                 /* This is obsolete as it will get set after the task unblocks, but
@@ -448,10 +511,22 @@
                     xTimeoutOccurred = pdTRUE;
                 }
                 taskEXIT_CRITICAL();
+
+                objmetricsWAIT_END( &( pxEventBits->xMetrics ), ulWaitStart, eObjectMetricsReceiveTimedOut );
             }
             else
             {
                 /* The task unblocked because the bits were set. */
+                #if ( configUSE_OBJECT_METRICS == 1 )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        objmetricsRECEIVE( &( pxEventBits->xMetrics ) );
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                #endif
+                objmetricsWAIT_END( &( pxEventBits->xMetrics ), ulWaitStart, eObjectMetricsWaitSatisfied );
             }
 
             /* The task blocked so control bits may have been set. */
@@ -568,6 +643,19 @@
         {
             traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
+            /* The metrics are read and updated from critical sections, as
+             * for the queues, which the scheduler being suspended does not
+             * exclude. */
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                taskENTER_CRITICAL();
+                {
+                    objmetricsSEND( &( pxEventBits->xMetrics ), listCURRENT_LIST_LENGTH( pxList ) );
+                }
+                taskEXIT_CRITICAL();
+            }
+            #endif
+
             pxListItem = listGET_HEAD_ENTRY( pxList );
 
             /* Set the bits. */
@@ -661,6 +749,7 @@
         vTaskSuspendAll();
         {
             traceEVENT_GROUP_DELETE( xEventGroup );
+            objmetricsUNREGISTER( &( pxEventBits->xMetrics ) );
 
             while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
             {
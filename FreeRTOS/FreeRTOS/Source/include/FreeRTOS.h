@@ -289,6 +289,10 @@
     #define INCLUDE_uxTaskGetStackHighWaterMark2    0
 #endif
 
+#ifndef INCLUDE_pxTaskGetStackStart
+    #define INCLUDE_pxTaskGetStackStart    0
+#endif
+
 #ifndef INCLUDE_eTaskGetState
     #define INCLUDE_eTaskGetState    0
 #endif
@@ -361,6 +365,10 @@
     #define configUSE_TASK_PREEMPTION_DISABLE    0
 #endif
 
+#ifndef configUSE_PREEMPTION_THRESHOLD
+    #define configUSE_PREEMPTION_THRESHOLD    0
+#endif
+
 #ifndef configUSE_ALTERNATIVE_API
     #define configUSE_ALTERNATIVE_API    0
 #endif
@@ -609,6 +617,58 @@
     #define portPOINTER_SIZE_TYPE    uint32_t
 #endif
 
+#ifndef configUSE_TRACE_RECORDER
+    #define configUSE_TRACE_RECORDER    0
+#endif
+
+/* The trace recorder maps the trace macros below onto its own functions, so
+ * must be included before the unused macros are removed. */
+#if ( configUSE_TRACE_RECORDER == 1 )
+    #include "trace_recorder.h"
+#endif
+
+#ifndef configUSE_LATENCY_HISTOGRAMS
+    #define configUSE_LATENCY_HISTOGRAMS    0
+#endif
+
+#if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+    #include "latency_histogram.h"
+#endif
+
+#ifndef configUSE_OBJECT_METRICS
+    #define configUSE_OBJECT_METRICS    0
+#endif
+
+#if ( configUSE_OBJECT_METRICS == 1 )
+    #include "object_metrics.h"
+#else
+
+/* The object metrics hooks used by the kernel objects compile to nothing. */
+    #define objmetricsREGISTER( pxMetrics, pvObject, eType, pcName )
+    #define objmetricsUNREGISTER( pxMetrics )
+    #define objmetricsSEND( pxMetrics, uxLevel )
+    #define objmetricsRECEIVE( pxMetrics )
+    #define objmetricsSEND_FAILED( pxMetrics )
+    #define objmetricsRECEIVE_FAILED( pxMetrics )
+    #define objmetricsCONTENTION( pxMetrics )
+    #define objmetricsMUTEX_TAKEN( pxMetrics )
+    #define objmetricsMUTEX_GIVEN( pxMetrics )
+    #define objmetricsWAIT_START( ulWaitStart )
+    #define objmetricsWAIT_END( pxMetrics, ulWaitStart, eResult )
+#endif
+
+#ifndef configUSE_SAMPLING_PROFILER
+    #define configUSE_SAMPLING_PROFILER    0
+#endif
+
+#if ( configUSE_SAMPLING_PROFILER == 1 )
+    #include "sampling_profiler.h"
+#endif
+
+#ifndef configUSE_JOB_DISPATCHER
+    #define configUSE_JOB_DISPATCHER    0
+#endif
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 
@@ -662,6 +722,29 @@
     #define traceTASK_SWITCHED_OUT()
 #endif
 
+#ifndef traceYIELD_CORE_REQUESTED
+
+/* SMP only.  Called when the kernel interrupts core xCoreID to make it
+ * reschedule, with the kernel locks held. */
+    #define traceYIELD_CORE_REQUESTED( xCoreID )
+#endif
+
+#ifndef traceYIELD_CORE_RECEIVED
+
+/* SMP with configUSE_SMP_STATS only.  Called after a core has rescheduled in
+ * response to a request from the other core.  xWasted is pdTRUE if the same
+ * task kept running, and ulLatency is the time since the request was sent, in
+ * portSMP_STATS_TIMESTAMP() units. */
+    #define traceYIELD_CORE_RECEIVED( xWasted, ulLatency )
+#endif
+
+#ifndef traceTASK_MIGRATED
+
+/* SMP with configUSE_SMP_STATS only.  Called after pxTCB has been switched in
+ * on a different core than the one it last ran on, xFromCoreID. */
+    #define traceTASK_MIGRATED( pxTCB, xFromCoreID )
+#endif
+
 #ifndef traceTASK_PRIORITY_INHERIT
 
 /* Called when a task attempts to take a mutex that is already held by a
@@ -712,6 +795,22 @@
     #define configCHECK_FOR_STACK_OVERFLOW    0
 #endif
 
+#ifndef configUSE_SAMPLED_STACK_HIGH_WATER_MARK
+    #define configUSE_SAMPLED_STACK_HIGH_WATER_MARK    0
+#endif
+
+#ifndef configUSE_TASK_SNAPSHOT
+    #define configUSE_TASK_SNAPSHOT    0
+#endif
+
+/* The kernel keeps a list of all tasks that can be walked without suspending
+ * the scheduler when a feature that reports on every task needs it. */
+#if ( ( configUSE_SAMPLED_STACK_HIGH_WATER_MARK == 1 ) || ( configUSE_TASK_SNAPSHOT == 1 ) )
+    #define tskUSE_TASK_REGISTRY    1
+#else
+    #define tskUSE_TASK_REGISTRY    0
+#endif
+
 #ifndef configRECORD_STACK_HIGH_ADDRESS
     #define configRECORD_STACK_HIGH_ADDRESS    0
 #endif
@@ -858,6 +957,30 @@
     #define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
 #endif
 
+#ifndef traceCRITICALITY_MODE_SWITCH
+    #define traceCRITICALITY_MODE_SWITCH( eNewMode )
+#endif
+
+#ifndef traceTASK_GROUP_DEPLETED
+    #define traceTASK_GROUP_DEPLETED( pxGroup )
+#endif
+
+#ifndef traceTASK_GROUP_REPLENISHED
+    #define traceTASK_GROUP_REPLENISHED( pxGroup )
+#endif
+
+#ifndef traceTIME_TRIGGERED_RELEASE
+    #define traceTIME_TRIGGERED_RELEASE( pxTask )
+#endif
+
+#ifndef traceIDLE_STATE_ENTER
+    #define traceIDLE_STATE_ENTER( uxState, xExpectedIdleTime )
+#endif
+
+#ifndef traceIDLE_STATE_EXIT
+    #define traceIDLE_STATE_EXIT( uxState )
+#endif
+
 #ifndef traceTASK_SUSPEND
     #define traceTASK_SUSPEND( pxTaskToSuspend )
 #endif
@@ -1310,6 +1433,30 @@
     #define traceRETURN_xQueueSemaphoreTake( xReturn )
 #endif
 
+#ifndef traceENTER_xQueueSemaphoreGive
+    #define traceENTER_xQueueSemaphoreGive( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueSemaphoreGive
+    #define traceRETURN_xQueueSemaphoreGive( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueSendPointer
+    #define traceENTER_xQueueSendPointer( xQueue, pvItem, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueSendPointer
+    #define traceRETURN_xQueueSendPointer( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueReceivePointer
+    #define traceENTER_xQueueReceivePointer( xQueue, ppvItem, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueReceivePointer
+    #define traceRETURN_xQueueReceivePointer( xReturn )
+#endif
+
 #ifndef traceENTER_xQueuePeek
     #define traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait )
 #endif
@@ -1758,6 +1905,14 @@
     #define traceRETURN_xTaskCreateAffinitySet( xReturn )
 #endif
 
+#ifndef traceENTER_xTaskCreateMultiple
+    #define traceENTER_xTaskCreateMultiple( pxTasks, uxTasks )
+#endif
+
+#ifndef traceRETURN_xTaskCreateMultiple
+    #define traceRETURN_xTaskCreateMultiple( xReturn )
+#endif
+
 #ifndef traceENTER_vTaskDelete
     #define traceENTER_vTaskDelete( xTaskToDelete )
 #endif
@@ -2618,6 +2773,14 @@
     #define traceRETURN_vListInitialise()
 #endif
 
+#ifndef traceENTER_vListInitialiseIndexed
+    #define traceENTER_vListInitialiseIndexed( pxList )
+#endif
+
+#ifndef traceRETURN_vListInitialiseIndexed
+    #define traceRETURN_vListInitialiseIndexed()
+#endif
+
 #ifndef traceENTER_vListInitialiseItem
     #define traceENTER_vListInitialiseItem( pxItem )
 #endif
@@ -2700,6 +2863,225 @@
 
 #endif /* configGENERATE_RUN_TIME_STATS */
 
+#ifndef configUSE_CORE_RUN_TIME_STATS
+    #define configUSE_CORE_RUN_TIME_STATS    0
+#endif
+
+#if ( ( configUSE_CORE_RUN_TIME_STATS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_CORE_RUN_TIME_STATS requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
+#if ( ( configUSE_CORE_RUN_TIME_STATS == 1 ) && defined( portALT_GET_RUN_TIME_COUNTER_VALUE ) )
+    #error configUSE_CORE_RUN_TIME_STATS requires the port to define portGET_RUN_TIME_COUNTER_VALUE.
+#endif
+
+#ifndef configUSE_JOB_MONITOR
+    #define configUSE_JOB_MONITOR    0
+#endif
+
+#ifndef configUSE_DEADLINE_MISS_HOOK
+    #define configUSE_DEADLINE_MISS_HOOK    0
+#endif
+
+#if ( ( configUSE_DEADLINE_MISS_HOOK == 1 ) && ( configUSE_JOB_MONITOR != 1 ) )
+    #error configUSE_DEADLINE_MISS_HOOK requires configUSE_JOB_MONITOR to be set to 1.
+#endif
+
+#ifndef configUSE_APERIODIC_SERVERS
+    #define configUSE_APERIODIC_SERVERS    0
+#endif
+
+#if ( ( configUSE_APERIODIC_SERVERS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_APERIODIC_SERVERS requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
+/* Replenishments a sporadic server can have pending at once.  Further
+ * replenishments are merged into the last one, which delays them. */
+#ifndef configAPERIODIC_SERVER_MAX_REPLENISHMENTS
+    #define configAPERIODIC_SERVER_MAX_REPLENISHMENTS    4
+#endif
+
+#ifndef configUSE_MIXED_CRITICALITY
+    #define configUSE_MIXED_CRITICALITY    0
+#endif
+
+#if ( ( configUSE_MIXED_CRITICALITY == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_MIXED_CRITICALITY requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
+#ifndef configUSE_EXECUTION_BUDGETS
+    #define configUSE_EXECUTION_BUDGETS    0
+#endif
+
+#if ( ( configUSE_EXECUTION_BUDGETS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_EXECUTION_BUDGETS requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
+#ifndef configUSE_TASK_GROUPS
+    #define configUSE_TASK_GROUPS    0
+#endif
+
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_TASK_GROUPS requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
+#ifndef configUSE_TIME_TRIGGERED
+    #define configUSE_TIME_TRIGGERED    0
+#endif
+
+#if ( ( configUSE_TIME_TRIGGERED == 1 ) && ( INCLUDE_vTaskSuspend != 1 ) )
+    #error configUSE_TIME_TRIGGERED requires INCLUDE_vTaskSuspend to be set to 1.
+#endif
+
+#ifndef configUSE_IDLE_GOVERNOR
+    #define configUSE_IDLE_GOVERNOR    0
+#endif
+
+#if ( ( configUSE_IDLE_GOVERNOR == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_IDLE_GOVERNOR requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
+/* The most idle states that can be passed to vTaskSetIdleStates(). */
+#ifndef configIDLE_GOVERNOR_MAX_STATES
+    #define configIDLE_GOVERNOR_MAX_STATES    4
+#endif
+
+/* Called when the scheduler starts if the application has not set any idle
+ * states, to let the port set its own. */
+#ifndef portIDLE_STATES_INIT
+    #define portIDLE_STATES_INIT()
+#endif
+
+/* Set configUSE_TCB_COLD_BLOCK to 1 to move the TCB fields that are not used
+ * for scheduling (the task name, thread local storage, notifications, trace
+ * numbers and errno) into a block allocated apart from the TCB.  The default
+ * keeps the single structure expected by kernel aware debuggers. */
+#ifndef configUSE_TCB_COLD_BLOCK
+    #define configUSE_TCB_COLD_BLOCK    0
+#endif
+
+/* The number of TCBs of dynamically created tasks kept in one static array,
+ * placed with configTCB_POOL_ATTRIBUTE.  Further TCBs come from the heap. */
+#ifndef configTCB_POOL_LENGTH
+    #define configTCB_POOL_LENGTH    0
+#endif
+
+#ifndef configTCB_POOL_ATTRIBUTE
+    #define configTCB_POOL_ATTRIBUTE
+#endif
+
+#if ( ( configTCB_POOL_LENGTH > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) )
+    #error configTCB_POOL_LENGTH requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1.
+#endif
+
+/* Set configUSE_QUEUE_FAST_PATHS to 1 to build the queue functions specialised
+ * for semaphores, mutexes and pointer queues, and to have xSemaphoreGive() use
+ * them. */
+#ifndef configUSE_QUEUE_FAST_PATHS
+    #define configUSE_QUEUE_FAST_PATHS    0
+#endif
+
+#if ( ( configUSE_QUEUE_FAST_PATHS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_QUEUE_FAST_PATHS is not supported by the MPU wrappers.
+#endif
+
+/* Set configUSE_QUEUE_SCALAR_COPY to 1 to copy queue items of 1, 2, 4 and 8
+ * bytes with a single load and store instead of memcpy(), and to align the
+ * storage area of dynamically allocated queues to 8 bytes. */
+#ifndef configUSE_QUEUE_SCALAR_COPY
+    #define configUSE_QUEUE_SCALAR_COPY    0
+#endif
+
+/* Set configUSE_STACK_FILL_ELISION to 1 to let new task stacks be left
+ * unfilled, or be filled by the idle task, see eTaskStackFill.  Tasks not
+ * created by xTaskCreateMultiple() use configTASK_STACK_FILL_DEFAULT. */
+#ifndef configUSE_STACK_FILL_ELISION
+    #define configUSE_STACK_FILL_ELISION    0
+#endif
+
+#ifndef configTASK_STACK_FILL_DEFAULT
+    #define configTASK_STACK_FILL_DEFAULT    eTaskStackFillFull
+#endif
+
+#if ( ( configUSE_STACK_FILL_ELISION == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_STACK_FILL_ELISION is not supported by the MPU wrappers.
+#endif
+
+/* Set configUSE_TASK_CREATE_MULTIPLE to 1 to build xTaskCreateMultiple(). */
+#ifndef configUSE_TASK_CREATE_MULTIPLE
+    #define configUSE_TASK_CREATE_MULTIPLE    0
+#endif
+
+#if ( ( configUSE_TASK_CREATE_MULTIPLE == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) )
+    #error configUSE_TASK_CREATE_MULTIPLE requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1.
+#endif
+
+/* Set configUSE_LIST_TREE_INDEX to 1 to let lists initialised with
+ * vListInitialiseIndexed() keep their items in a red-black tree as well, so
+ * vListInsert() takes logarithmic rather than linear time.  The delayed task
+ * lists and the active timer lists are then indexed. */
+#ifndef configUSE_LIST_TREE_INDEX
+    #define configUSE_LIST_TREE_INDEX    0
+#endif
+
+#ifndef configUSE_BUDGET_OVERRUN_HOOK
+    #define configUSE_BUDGET_OVERRUN_HOOK    0
+#endif
+
+#if ( ( configUSE_BUDGET_OVERRUN_HOOK == 1 ) && ( configUSE_EXECUTION_BUDGETS != 1 ) )
+    #error configUSE_BUDGET_OVERRUN_HOOK requires configUSE_EXECUTION_BUDGETS to be set to 1.
+#endif
+
+/* A port can provide a one shot timer, per core, that calls
+ * xTaskExecutionTimerExpired() once the task running on that core has run for
+ * ulTimeout run time counter units.  Without it budgets are only enforced from
+ * the tick. */
+#ifndef portEXECUTION_TIMER_START
+    #define portEXECUTION_TIMER_START( ulTimeout )
+#endif
+
+#ifndef portEXECUTION_TIMER_STOP
+    #define portEXECUTION_TIMER_STOP()
+#endif
+
+#ifndef configUSE_ADMISSION_CONTROL
+    #define configUSE_ADMISSION_CONTROL    0
+#endif
+
+#if ( ( configUSE_ADMISSION_CONTROL == 1 ) && ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY != 1 ) )
+    #error configUSE_ADMISSION_CONTROL requires configUSE_CORE_AFFINITY to be set to 1 when configNUMBER_OF_CORES is greater than 1.
+#endif
+
+/* How xAdmissionTaskCreate() sets priorities: 0 uses the priority passed by
+ * the application, 1 assigns rate monotonic and 2 deadline monotonic
+ * priorities between configADMISSION_LOWEST_PRIORITY and
+ * configADMISSION_HIGHEST_PRIORITY. */
+#ifndef configADMISSION_PRIORITY_ASSIGNMENT
+    #define configADMISSION_PRIORITY_ASSIGNMENT    0
+#endif
+
+#ifndef configADMISSION_HIGHEST_PRIORITY
+    #define configADMISSION_HIGHEST_PRIORITY    ( configMAX_PRIORITIES - 1 )
+#endif
+
+#ifndef configADMISSION_LOWEST_PRIORITY
+    #define configADMISSION_LOWEST_PRIORITY    1
+#endif
+
+#ifndef configUSE_SMP_STATS
+    #define configUSE_SMP_STATS    0
+#endif
+
+#if ( ( configUSE_SMP_STATS == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+    #error configUSE_SMP_STATS requires configNUMBER_OF_CORES to be greater than 1.
+#endif
+
+/* Time stamp used for the cross-core yield latency of configUSE_SMP_STATS.
+ * Ports with a free running timer should define a finer one. */
+#ifndef portSMP_STATS_TIMESTAMP
+    #define portSMP_STATS_TIMESTAMP()    ( ( uint32_t ) xTaskGetTickCountFromISR() )
+#endif
+
 #ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
     #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
 #endif
@@ -2898,6 +3280,14 @@
     #error configUSE_TASK_PREEMPTION_DISABLE is not supported in single core FreeRTOS
 #endif
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configRUN_MULTIPLE_PRIORITIES == 0 ) && ( configUSE_PREEMPTION_THRESHOLD != 0 ) )
+    #error configRUN_MULTIPLE_PRIORITIES must be set to 1 to use preemption thresholds
+#endif
+
+#if ( ( configUSE_PREEMPTION == 0 ) && ( configUSE_PREEMPTION_THRESHOLD != 0 ) )
+    #error configUSE_PREEMPTION must be set to 1 to use preemption thresholds
+#endif
+
 #if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_CORE_AFFINITY != 0 ) )
     #error configUSE_CORE_AFFINITY is not supported in single core FreeRTOS
 #endif
@@ -3113,6 +3503,10 @@ struct xSTATIC_LIST_ITEM
     #endif
     TickType_t xDummy2;
     void * pvDummy3[ 4 ];
+    #if ( configUSE_LIST_TREE_INDEX == 1 )
+        void * pvDummyTree[ 3 ];
+        BaseType_t xDummyTree;
+    #endif
     #if ( configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES == 1 )
         TickType_t xDummy4;
     #endif
@@ -3143,6 +3537,9 @@ typedef struct xSTATIC_LIST
     UBaseType_t uxDummy2;
     void * pvDummy3;
     StaticMiniListItem_t xDummy4;
+    #if ( configUSE_LIST_TREE_INDEX == 1 )
+        void * pvDummyTree;
+    #endif
     #if ( configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES == 1 )
         TickType_t xDummy5;
     #endif
@@ -3161,6 +3558,38 @@ typedef struct xSTATIC_LIST
  * are set.  Its contents are somewhat obfuscated in the hope users will
  * recognise that it would be unwise to make direct use of the structure members.
  */
+#if ( configUSE_TCB_COLD_BLOCK == 1 )
+
+/*
+ * The cold block of a task, kept at the end of StaticTask_t when
+ * configUSE_TCB_COLD_BLOCK is 1.  Its size matches the real structure in the
+ * same way as StaticTask_t.
+ */
+    typedef struct xSTATIC_TCB_COLD
+    {
+        #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+            void * pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+        #endif
+        #if ( configUSE_TRACE_FACILITY == 1 )
+            UBaseType_t uxDummy10[ 2 ];
+        #endif
+        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+            configTLS_BLOCK_TYPE xDummy17;
+        #endif
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            uint32_t ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            int iDummy22;
+        #endif
+        uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            uint8_t ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+    } StaticTaskCold_t;
+
+#endif /* configUSE_TCB_COLD_BLOCK */
+
 typedef struct xSTATIC_TCB
 {
     void * pxDummy1;
@@ -3177,17 +3606,25 @@ typedef struct xSTATIC_TCB
         BaseType_t xDummy23;
         UBaseType_t uxDummy24;
     #endif
-    uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
+    #if ( configUSE_TCB_COLD_BLOCK == 0 )
+        uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
+    #endif
     #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
         BaseType_t xDummy25;
     #endif
+    #if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+        UBaseType_t uxDummyPreemptionThreshold;
+        #if ( configNUMBER_OF_CORES == 1 )
+            void * pvDummyNextPreempted;
+        #endif
+    #endif
     #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
         void * pxDummy8;
     #endif
     #if ( portCRITICAL_NESTING_IN_TCB == 1 )
         UBaseType_t uxDummy9;
     #endif
-    #if ( configUSE_TRACE_FACILITY == 1 )
+    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         UBaseType_t uxDummy10[ 2 ];
     #endif
     #if ( configUSE_MUTEXES == 1 )
@@ -3196,16 +3633,55 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_APPLICATION_TASK_TAG == 1 )
         void * pxDummy14;
     #endif
-    #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+    #if ( ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         void * pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
     #endif
     #if ( configGENERATE_RUN_TIME_STATS == 1 )
         configRUN_TIME_COUNTER_TYPE ulDummy16;
     #endif
-    #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+    #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+        uint32_t ulDummyLatency;
+    #endif
+    #if ( configUSE_JOB_MONITOR == 1 )
+        void * pvDummyJobMonitor;
+    #endif
+    #if ( configUSE_APERIODIC_SERVERS == 1 )
+        void * pvDummyAperiodicServer;
+    #endif
+    #if ( configUSE_MIXED_CRITICALITY == 1 )
+        void * pvDummyCriticality;
+    #endif
+    #if ( configUSE_EXECUTION_BUDGETS == 1 )
+        void * pvDummyExecutionBudget;
+    #endif
+    #if ( configUSE_TASK_GROUPS == 1 )
+        void * pvDummyTaskGroup[ 2 ];
+        configRUN_TIME_COUNTER_TYPE ulDummyTaskGroupCharged;
+    #endif
+    #if ( configUSE_IDLE_GOVERNOR == 1 )
+        configRUN_TIME_COUNTER_TYPE ulDummyWakeLatency;
+        void * pvDummyNextWakeLatency;
+    #endif
+    #if ( configUSE_STACK_FILL_ELISION == 1 )
+        void * pvDummyNextStackFill;
+    #endif
+    #if ( configUSE_SAMPLED_STACK_HIGH_WATER_MARK == 1 )
+        void * pxDummyStackMark;
+    #endif
+    #if ( tskUSE_TASK_REGISTRY == 1 )
+        StaticListItem_t xDummyRegistry;
+    #endif
+    #if ( configUSE_TASK_SNAPSHOT == 1 )
+        UBaseType_t uxDummySnapshotSequence;
+    #endif
+    #if ( configUSE_SMP_STATS == 1 )
+        BaseType_t xDummyLastRunCore;
+        uint32_t ulDummySMPStats[ 2 ];
+    #endif
+    #if ( ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         configTLS_BLOCK_TYPE xDummy17;
     #endif
-    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+    #if ( ( configUSE_TASK_NOTIFICATIONS == 1 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         uint32_t ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
         uint8_t ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
     #endif
@@ -3216,9 +3692,16 @@ typedef struct xSTATIC_TCB
     #if ( INCLUDE_xTaskAbortDelay == 1 )
         uint8_t ucDummy21;
     #endif
-    #if ( configUSE_POSIX_ERRNO == 1 )
+    #if ( configUSE_TIME_TRIGGERED == 1 )
+        uint8_t ucDummyTimeTriggered;
+    #endif
+    #if ( ( configUSE_POSIX_ERRNO == 1 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         int iDummy22;
     #endif
+    #if ( configUSE_TCB_COLD_BLOCK == 1 )
+        void * pvDummyCold;
+        StaticTaskCold_t xDummyCold;
+    #endif
 } StaticTask_t;
 
 /*
@@ -3261,6 +3744,14 @@ typedef struct xSTATIC_QUEUE
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
     #endif
+
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        ObjectMetrics_t xDummyMetrics;
+    #endif
+
+    #if ( configUSE_JOB_DISPATCHER == 1 )
+        void * pvDummy10;
+    #endif
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
@@ -3290,6 +3781,10 @@ typedef struct xSTATIC_EVENT_GROUP
     #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
         uint8_t ucDummy4;
     #endif
+
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        ObjectMetrics_t xDummyMetrics;
+    #endif
 } StaticEventGroup_t;
 
 /*
@@ -3317,6 +3812,9 @@ typedef struct xSTATIC_TIMER
         UBaseType_t uxDummy7;
     #endif
     uint8_t ucDummy8;
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        ObjectMetrics_t xDummyMetrics;
+    #endif
 } StaticTimer_t;
 
 /*
@@ -3345,11 +3843,20 @@ typedef struct xSTATIC_STREAM_BUFFER
         void * pvDummy5[ 2 ];
     #endif
     UBaseType_t uxDummy6;
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        ObjectMetrics_t xDummyMetrics;
+    #endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/* Included last, as jobs are built on the configuration defaults and static
+ * types above. */
+#if ( configUSE_JOB_DISPATCHER == 1 )
+    #include "job_dispatcher.h"
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -0,0 +1,172 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Admission control for fixed priority task sets.
+ *
+ * When configUSE_ADMISSION_CONTROL is set to 1 a periodic or sporadic task can
+ * be created with xAdmissionTaskCreate(), which takes the timing parameters of
+ * the task as well as the usual task parameters.  The parameters are a minimum
+ * inter-arrival time (period), a relative deadline no longer than the period,
+ * a worst case execution time and a worst case blocking time, the longest a
+ * job can be held up by lower priority tasks through shared resources.
+ *
+ * Before the task is created an exact response time analysis is run over all
+ * the tasks admitted so far plus the new one.  If any task, new or old, would
+ * have a worst case response time longer than its deadline the new task is
+ * rejected and not created.  The analysis is incremental: adding a task can
+ * only lengthen the response times of tasks at or below its priority, so the
+ * previous response times are used as the starting point of each iteration.
+ *
+ * With configADMISSION_PRIORITY_ASSIGNMENT set to 1 or 2 the priorities of all
+ * admitted tasks are assigned in rate monotonic or deadline monotonic order,
+ * and the priorities of tasks already running are changed when a task is
+ * admitted or removed.  Tasks with the same period or deadline share a
+ * priority, as do all tasks beyond the number of priorities available.  The
+ * analysis treats tasks of equal priority as interfering with each other.
+ *
+ * All times are in run time counter units, so that the execution times
+ * measured by the job monitor can be fed back into the analysis with
+ * xAdmissionUpdate().  Without configGENERATE_RUN_TIME_STATS any unit can be
+ * used, as long as it is used for every task.
+ *
+ * On a multicore build each task is admitted to, and pinned to, one core, and
+ * each core is analysed on its own.  Tasks that are not created through this
+ * interface, and the time spent in interrupts, are not accounted for and
+ * should be allowed for in the execution or blocking times.
+ */
+
+#ifndef ADMISSION_CONTROL_H
+#define ADMISSION_CONTROL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include admission_control.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Pass as the priority to xAdmissionTaskCreate() when priorities are assigned
+ * automatically. */
+#define admissionAUTO_PRIORITY    ( ( UBaseType_t ) 0U )
+
+/*
+ * The timing parameters of one admitted task.  The storage is provided by the
+ * application, initialised with vAdmissionParametersInit() and must remain
+ * valid until the task is removed with vAdmissionRemove().  ulResponseTime and
+ * uxPriority can be read by the application, the other members are private.
+ */
+typedef struct xADMISSION_TASK
+{
+    configRUN_TIME_COUNTER_TYPE ulPeriod;           /* Minimum time between releases. */
+    configRUN_TIME_COUNTER_TYPE ulDeadline;         /* Deadline relative to the release. */
+    configRUN_TIME_COUNTER_TYPE ulExecutionTime;    /* Declared worst case execution time. */
+    configRUN_TIME_COUNTER_TYPE ulBlockingTime;     /* Worst case blocking by lower priority tasks. */
+    configRUN_TIME_COUNTER_TYPE ulObservedTime;     /* Longest execution time measured so far. */
+    configRUN_TIME_COUNTER_TYPE ulResponseTime;     /* Worst case response time from the last analysis. */
+    configRUN_TIME_COUNTER_TYPE ulCandidateTime;    /* Response time while an analysis is in progress. */
+    UBaseType_t uxPriority;                         /* Priority of the task. */
+    #if ( configNUMBER_OF_CORES > 1 )
+        BaseType_t xCoreID;                         /* Core the task is pinned to. */
+    #endif
+    TaskHandle_t xTask;
+    #if ( ( configUSE_JOB_MONITOR == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+        JobMonitor_t xMonitor;                      /* Measures the execution time of each job. */
+    #endif
+    struct xADMISSION_TASK * pxNext;
+} AdmissionTask_t;
+
+/*
+ * Initialise the parameters of a task before it is passed to
+ * xAdmissionTaskCreate().  ulDeadline must not be longer than ulPeriod.
+ * xCoreID is the core the task will be pinned to, and is ignored by single
+ * core builds.
+ */
+void vAdmissionParametersInit( AdmissionTask_t * pxAdmission,
+                               configRUN_TIME_COUNTER_TYPE ulPeriod,
+                               configRUN_TIME_COUNTER_TYPE ulDeadline,
+                               configRUN_TIME_COUNTER_TYPE ulExecutionTime,
+                               configRUN_TIME_COUNTER_TYPE ulBlockingTime,
+                               BaseType_t xCoreID );
+
+/*
+ * Admit and create a task.  The parameters are those of xTaskCreate(), plus
+ * the timing parameters in pxAdmission.  uxPriority is ignored, and should be
+ * admissionAUTO_PRIORITY, when configADMISSION_PRIORITY_ASSIGNMENT is not 0.
+ *
+ * Returns pdPASS if the task was admitted and created, pdFAIL if admitting it
+ * would make the task set unschedulable, or
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY if the task could not be created.
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    BaseType_t xAdmissionTaskCreate( TaskFunction_t pxTaskCode,
+                                     const char * const pcName,
+                                     const configSTACK_DEPTH_TYPE uxStackDepth,
+                                     void * const pvParameters,
+                                     UBaseType_t uxPriority,
+                                     AdmissionTask_t * pxAdmission,
+                                     TaskHandle_t * const pxCreatedTask );
+#endif
+
+/*
+ * Remove an admitted task from the task set, releasing the processor time it
+ * was granted.  Must be called before the task is deleted.  Does not delete
+ * the task.
+ */
+void vAdmissionRemove( AdmissionTask_t * pxAdmission );
+
+/*
+ * Feed the execution times measured by the job monitor back into the analysis
+ * and repeat it.  A task whose longest measured execution time exceeds the
+ * time it declared is analysed with the measured time from then on.  Returns
+ * pdPASS if every admitted task still meets its deadline, otherwise pdFAIL.
+ * Tasks are not removed when the analysis fails.  Intended to be called
+ * periodically from a low priority task.  Measurement requires
+ * configUSE_JOB_MONITOR and configGENERATE_RUN_TIME_STATS to be 1, without
+ * them only the analysis is repeated.
+ */
+BaseType_t xAdmissionUpdate( void );
+
+/*
+ * The slack of a task: how much its worst case response time is shorter than
+ * its deadline, as of the last analysis.
+ */
+configRUN_TIME_COUNTER_TYPE ulAdmissionGetSlack( const AdmissionTask_t * pxAdmission );
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ADMISSION_CONTROL_H */
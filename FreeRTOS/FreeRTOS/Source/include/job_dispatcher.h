@@ -0,0 +1,210 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Run-to-completion jobs.
+ *
+ * When configUSE_JOB_DISPATCHER is set to 1 small event handlers can be
+ * written as jobs instead of tasks.  A job is a function, a parameter and a
+ * few words of bookkeeping (Job_t).  It has no stack or TCB of its own: every
+ * job belongs to a dispatcher, which is an ordinary task that runs the jobs
+ * posted to it one at a time, in the order they were posted, on its own stack.
+ * Creating one dispatcher per priority level (or, with configUSE_CORE_AFFINITY,
+ * per core) lets any number of handlers share a handful of stacks.
+ *
+ * A job is posted with xJobPost() or xJobPostFromISR(), which work like direct
+ * to task notifications: the event bits passed in are ORed into the job, and a
+ * job that is posted again before it runs is run only once, with all the bits.
+ * A job can also be attached to a queue with vJobAttachQueue(), after which
+ * every item sent to the queue posts the job, and the job empties the queue
+ * with xQueueReceive() and a block time of zero.
+ *
+ * A job must run to completion: it must not block, delay or wait on any
+ * kernel object, as that would stall every other job of its dispatcher.  Work
+ * that has to wait is split into several jobs, with each job posting the next
+ * one (its continuation) before returning.  A job posted from within a job
+ * runs after the current job returns.
+ */
+
+#ifndef JOB_DISPATCHER_H
+#define JOB_DISPATCHER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include job_dispatcher.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Posting a job from a queue send has to tell whether it was called from an
+ * interrupt. */
+#ifndef portCHECK_IF_IN_ISR
+    #error portCHECK_IF_IN_ISR() must be defined in portmacro.h when configUSE_JOB_DISPATCHER is set to 1.
+#endif
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+    #error configUSE_JOB_DISPATCHER requires configUSE_TASK_NOTIFICATIONS to be set to 1.
+#endif
+
+/* ulEvents is the OR of the event bits passed to every post since the job last
+ * ran.  Posts made by an attached queue do not add any bits. */
+typedef void (* JobFunction_t)( void * pvParameter,
+                                uint32_t ulEvents );
+
+struct xJOB_DISPATCHER;
+struct tskTaskControlBlock;
+struct QueueDefinition;
+
+/*
+ * One job.  The storage is provided by the application and initialised with
+ * vJobInit(); the members are private.
+ */
+typedef struct xJOB
+{
+    JobFunction_t pxFunction;
+    void * pvParameter;
+    struct xJOB_DISPATCHER * pxDispatcher;
+    struct xJOB * pxNext;      /* Next job in the dispatcher's pending list. */
+    uint32_t ulEvents;         /* Event bits posted since the job last ran. */
+    BaseType_t xPending;       /* pdTRUE while the job is in the pending list. */
+} Job_t;
+
+/* Activity of one dispatcher. */
+typedef struct xJOB_DISPATCHER_STATS
+{
+    uint32_t ulRun;          /* Jobs run. */
+    uint32_t ulCoalesced;    /* Posts merged into a job that was already pending. */
+    uint32_t ulMaxPending;   /* Most jobs pending at once. */
+} JobDispatcherStats_t;
+
+/*
+ * One dispatcher.  The storage is provided by the application and initialised
+ * by xJobDispatcherCreate() or xJobDispatcherCreateStatic(); the members are
+ * private.
+ */
+typedef struct xJOB_DISPATCHER
+{
+    struct tskTaskControlBlock * xTask;
+    Job_t * pxHead;
+    Job_t * pxTail;
+    uint32_t ulPending;
+    JobDispatcherStats_t xStats;
+} JobDispatcher_t;
+
+/*
+ * Create the task of a dispatcher.  uxStackDepth must be enough for the
+ * deepest job that will be posted to it.  Returns pdPASS if the task was
+ * created.
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    BaseType_t xJobDispatcherCreate( JobDispatcher_t * pxDispatcher,
+                                     const char * pcName,
+                                     configSTACK_DEPTH_TYPE uxStackDepth,
+                                     UBaseType_t uxPriority );
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    BaseType_t xJobDispatcherCreateStatic( JobDispatcher_t * pxDispatcher,
+                                           const char * pcName,
+                                           configSTACK_DEPTH_TYPE uxStackDepth,
+                                           UBaseType_t uxPriority,
+                                           StackType_t * puxStackBuffer,
+                                           StaticTask_t * pxTaskBuffer );
+#endif
+
+/*
+ * The task of a dispatcher, for example to set its core affinity.
+ */
+struct tskTaskControlBlock * xJobDispatcherGetTaskHandle( const JobDispatcher_t * pxDispatcher );
+
+/*
+ * Copy the statistics of a dispatcher into *pxStats.
+ */
+void vJobDispatcherGetStats( JobDispatcher_t * pxDispatcher,
+                             JobDispatcherStats_t * pxStats );
+
+/*
+ * Initialise a job that will run pxFunction( pvParameter, ulEvents ) on
+ * pxDispatcher.  Must not be called while the job is pending.
+ */
+void vJobInit( Job_t * pxJob,
+               JobDispatcher_t * pxDispatcher,
+               JobFunction_t pxFunction,
+               void * pvParameter );
+
+/*
+ * Post a job with ulEvents.  Returns pdTRUE if the job was added to the
+ * pending list, or pdFALSE if it was already pending and the events were
+ * merged into the earlier post.  Never blocks, so can also be called from a
+ * job or from within a critical section.
+ */
+BaseType_t xJobPost( Job_t * pxJob,
+                     uint32_t ulEvents );
+
+/*
+ * xJobPost() for interrupt service routines.  *pxHigherPriorityTaskWoken is
+ * set to pdTRUE if the dispatcher has a higher priority than the interrupted
+ * task, in which case a context switch should be requested before the
+ * interrupt exits.
+ */
+BaseType_t xJobPostFromISR( Job_t * pxJob,
+                            uint32_t ulEvents,
+                            BaseType_t * pxHigherPriorityTaskWoken );
+
+/*
+ * Remove a job from the pending list of its dispatcher if it is pending.
+ * Returns pdTRUE if the job was pending.  A job that is already running is
+ * not affected.
+ */
+BaseType_t xJobCancel( Job_t * pxJob );
+
+/*
+ * Post pxJob each time an item is sent to xQueue, or stop doing so if pxJob
+ * is NULL.  A queue can have at most one job attached, and cannot also be a
+ * member of a queue set.
+ */
+void vJobAttachQueue( Job_t * pxJob,
+                      struct QueueDefinition * xQueue );
+
+/*
+ * Called by the queue implementation, from within a critical section, when an
+ * item has been sent to a queue that has a job attached.  Should not be called
+ * directly by the application.
+ */
+void vJobPostFromQueue( Job_t * pxJob );
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* JOB_DISPATCHER_H */
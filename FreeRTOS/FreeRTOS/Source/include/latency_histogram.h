@@ -0,0 +1,156 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Interrupt and scheduling latency histograms.
+ *
+ * When configUSE_LATENCY_HISTOGRAMS is set to 1 the kernel and the port time
+ * the following, separately on each core, and add every measurement to a log2
+ * histogram:
+ *
+ *  - eLatencyInterruptsMasked: how long taskENTER_CRITICAL() kept interrupts
+ *    masked, from the outermost enter to the matching exit.
+ *  - eLatencySchedulerSuspended: how long vTaskSuspendAll() kept the scheduler
+ *    suspended, from the outermost suspend to the matching resume.
+ *  - eLatencyISRDuration: how long an instrumented interrupt ran.
+ *  - eLatencyISRToTask: the time from an instrumented interrupt readying a task
+ *    to that task starting to run.
+ *
+ * Each histogram also keeps its largest sample and where it came from: the
+ * return address of the code that entered the critical section or suspended
+ * the scheduler (resolve it with addr2line), the exception number of the
+ * interrupt, or the handle of the task that was woken.
+ *
+ * The port instruments its own interrupt handlers.  Application interrupts are
+ * included by calling vLatencyHistogramISREnter() at the start and
+ * vLatencyHistogramISRExit() at the end of the handler.
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include latency_histogram.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* The port must provide a free running 32-bit time stamp. */
+#ifndef portLATENCY_TIMESTAMP
+    #error portLATENCY_TIMESTAMP() must be defined in portmacro.h when configUSE_LATENCY_HISTOGRAMS is set to 1.
+#endif
+
+#ifndef portLATENCY_TIMESTAMP_HZ
+    #error portLATENCY_TIMESTAMP_HZ must be defined in portmacro.h when configUSE_LATENCY_HISTOGRAMS is set to 1.
+#endif
+
+/* Used to identify the code that masked interrupts or suspended the
+ * scheduler.  Optional. */
+#ifndef portLATENCY_CALLER_ADDRESS
+    #define portLATENCY_CALLER_ADDRESS()    0U
+#endif
+
+/* Used to identify the interrupt with the longest duration.  Optional. */
+#ifndef portLATENCY_ISR_NUMBER
+    #define portLATENCY_ISR_NUMBER()    0U
+#endif
+
+/* Number of buckets in each histogram.  Bucket 0 counts samples of 0, bucket n
+ * counts samples from 2^(n-1) to 2^n - 1 time stamp ticks, and the last bucket
+ * also counts everything longer. */
+#ifndef configLATENCY_HISTOGRAM_BUCKETS
+    #define configLATENCY_HISTOGRAM_BUCKETS    16U
+#endif
+
+#if ( ( configLATENCY_HISTOGRAM_BUCKETS < 2 ) || ( configLATENCY_HISTOGRAM_BUCKETS > 33 ) )
+    #error configLATENCY_HISTOGRAM_BUCKETS must be between 2 and 33.
+#endif
+
+/* Histograms kept for each core. */
+typedef enum
+{
+    eLatencyInterruptsMasked = 0, /* Critical section length. */
+    eLatencySchedulerSuspended,   /* vTaskSuspendAll() to xTaskResumeAll(). */
+    eLatencyISRDuration,          /* Instrumented interrupt execution time. */
+    eLatencyISRToTask             /* Interrupt readying a task to the task running. */
+} eLatencyHistogramType;
+
+#define latencyNUM_HISTOGRAM_TYPES    4U
+
+typedef struct xLATENCY_HISTOGRAM
+{
+    uint32_t ulBuckets[ configLATENCY_HISTOGRAM_BUCKETS ]; /* Sample counts, see configLATENCY_HISTOGRAM_BUCKETS. */
+    uint32_t ulSamples;                                    /* Total number of samples. */
+    uint32_t ulMax;                                        /* Largest sample, in time stamp ticks. */
+    uint32_t ulMaxSource;                                  /* Caller address, exception number or task handle of ulMax. */
+} LatencyHistogram_t;
+
+/*
+ * Copy one histogram of one core into *pxHistogram.  The copy is made with
+ * interrupts masked on the calling core only, so a histogram of the other core
+ * may be updated while it is being copied.
+ */
+void vLatencyHistogramGet( BaseType_t xCoreID,
+                           eLatencyHistogramType eType,
+                           LatencyHistogram_t * pxHistogram );
+
+/*
+ * Clear all the histograms of all cores.
+ */
+void vLatencyHistogramReset( void );
+
+/*
+ * Bracket an interrupt handler to include it in the eLatencyISRDuration and
+ * eLatencyISRToTask histograms.  Nested interrupts are measured as part of
+ * the outermost one.
+ */
+void vLatencyHistogramISREnter( void );
+void vLatencyHistogramISRExit( void );
+
+/*
+ * The functions below are called by the kernel and should not be called
+ * directly by the application.
+ */
+void vLatencyHistogramSectionEnter( eLatencyHistogramType eType,
+                                    uint32_t ulSource );
+void vLatencyHistogramSectionExit( eLatencyHistogramType eType );
+void vLatencyHistogramTaskReady( uint32_t * pulWakeStamp );
+void vLatencyHistogramTaskSwitchedIn( uint32_t * pulWakeStamp,
+                                      uint32_t ulTask );
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* LATENCY_HISTOGRAM_H */
@@ -149,6 +149,12 @@ struct xLIST_ITEM
     struct xLIST_ITEM * configLIST_VOLATILE pxPrevious; /**< Pointer to the previous ListItem_t in the list. */
     void * pvOwner;                                     /**< Pointer to the object (normally a TCB) that contains the list item.  There is therefore a two way link between the object containing the list item and the list item itself. */
     struct xLIST * configLIST_VOLATILE pxContainer;     /**< Pointer to the list in which this list item is placed (if any). */
+    #if ( configUSE_LIST_TREE_INDEX == 1 )
+        struct xLIST_ITEM * pxTreeParent;               /**< Parent of the item in the tree of an indexed list. */
+        struct xLIST_ITEM * pxTreeLeft;                 /**< Subtree of items with a lower value. */
+        struct xLIST_ITEM * pxTreeRight;                /**< Subtree of items with an equal or higher value. */
+        BaseType_t xTreeRed;                            /**< pdTRUE if the item is red, pdFALSE if it is black. */
+    #endif
     listSECOND_LIST_ITEM_INTEGRITY_CHECK_VALUE          /**< Set to a known value if configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
 };
 typedef struct xLIST_ITEM ListItem_t;
@@ -175,9 +181,34 @@ typedef struct xLIST
     configLIST_VOLATILE UBaseType_t uxNumberOfItems;
     ListItem_t * configLIST_VOLATILE pxIndex; /**< Used to walk through the list.  Points to the last item returned by a call to listGET_OWNER_OF_NEXT_ENTRY (). */
     MiniListItem_t xListEnd;                  /**< List item that contains the maximum possible item value meaning it is always at the end of the list and is therefore used as a marker. */
+    #if ( configUSE_LIST_TREE_INDEX == 1 )
+        ListItem_t * pxTreeRoot;              /**< Root of the tree of an indexed list, listTREE_EMPTY() if it has no items, or NULL if the list is not indexed. */
+    #endif
     listSECOND_LIST_INTEGRITY_CHECK_VALUE     /**< Set to a known value if configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
 } List_t;
 
+/*
+ * The tree root of an indexed list with no items.  The end marker of the list
+ * is never part of the tree, so its address only has to differ from NULL.
+ */
+#define listTREE_EMPTY( pxList )    ( ( ListItem_t * ) &( ( pxList )->xListEnd ) )
+
+/*
+ * Remove an item from the tree of an indexed list, called by uxListRemove()
+ * and listREMOVE_ITEM() when the list of the item is indexed.
+ */
+#if ( configUSE_LIST_TREE_INDEX == 1 )
+    #define listTREE_REMOVE( pxList, pxItem )          \
+    do {                                               \
+        if( ( pxList )->pxTreeRoot != NULL )           \
+        {                                              \
+            vListTreeRemove( ( pxList ), ( pxItem ) ); \
+        }                                              \
+    } while( 0 )
+#else
+    #define listTREE_REMOVE( pxList, pxItem )
+#endif
+
 /*
  * Access macro to set the owner of a list item.  The owner of a list item
  * is the object (usually a TCB) that contains the list item.
@@ -327,6 +358,7 @@ typedef struct xLIST
                                                                                                     \
         ( pxItemToRemove )->pxNext->pxPrevious = ( pxItemToRemove )->pxPrevious;                    \
         ( pxItemToRemove )->pxPrevious->pxNext = ( pxItemToRemove )->pxNext;                        \
+        listTREE_REMOVE( pxList, ( pxItemToRemove ) );                                              \
         /* Make sure the index is left pointing to a valid item. */                                 \
         if( pxList->pxIndex == ( pxItemToRemove ) )                                                 \
         {                                                                                           \
@@ -440,6 +472,28 @@ typedef struct xLIST
  */
 void vListInitialise( List_t * const pxList ) PRIVILEGED_FUNCTION;
 
+/*
+ * Initialise a list as vListInitialise() does, but index it with a red-black
+ * tree kept alongside the linked list.  vListInsert() then finds the position
+ * of a new item in O(log n) instead of O(n) time, at the cost of rebalancing
+ * the tree on every insertion and removal, so only lists that are sorted and
+ * long are worth indexing.  Items must only be added to an indexed list with
+ * vListInsert(), and their value must not change while they are in it.
+ *
+ * configUSE_LIST_TREE_INDEX must be set to 1 for this function to be
+ * available.
+ *
+ * @param pxList Pointer to the list being initialised.
+ *
+ * \page vListInitialiseIndexed vListInitialiseIndexed
+ * \ingroup LinkedList
+ */
+#if ( configUSE_LIST_TREE_INDEX == 1 )
+    void vListInitialiseIndexed( List_t * const pxList ) PRIVILEGED_FUNCTION;
+    void vListTreeRemove( List_t * const pxList,
+                          ListItem_t * const pxItem ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Must be called before a list item is used.  This sets the list container to
  * null so the item does not think that it is already contained in a list.
@@ -0,0 +1,224 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+/*
+ * Kernel object metrics.
+ *
+ * When configUSE_OBJECT_METRICS is set to 1 every queue, semaphore, mutex,
+ * event group, stream buffer, message buffer and software timer carries an
+ * ObjectMetrics_t record, which is linked into a registry when the object is
+ * created and removed from it when the object is deleted.  The kernel counts:
+ *
+ *  - successful sends and receives, and the calls that gave up because the
+ *    object was full or empty, whether or not they blocked first;
+ *  - the highest fill level seen: items for queues and semaphores, bytes for
+ *    stream and message buffers;
+ *  - a log2 histogram of how long tasks blocked on the object;
+ *  - for mutexes, how often a task had to block because the mutex was held,
+ *    and the longest and total time it was held.
+ *
+ * Event groups count xEventGroupSetBits() calls as sends and satisfied
+ * xEventGroupWaitBits() calls as receives.  Timers count commands sent to the
+ * timer task as sends and callbacks as receives, and their histogram holds the
+ * execution time of the callback rather than a blocked time.
+ *
+ * Times are in units of portOBJECT_METRICS_TIMESTAMP(), which defaults to
+ * the tick count.  The registry can be read one object at a time with
+ * xObjectMetricsGet() and uxObjectMetricsGetAll(), or serialised with
+ * xObjectMetricsExport() and decoded on the host by object_metrics_decode.py.
+ */
+
+#ifndef OBJECT_METRICS_H
+#define OBJECT_METRICS_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include object_metrics.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Free running 32-bit time stamp used for blocked and hold times.  The tick
+ * count is used if the port does not provide a finer one. */
+#ifndef portOBJECT_METRICS_TIMESTAMP
+    #define portOBJECT_METRICS_TIMESTAMP()    ( ( uint32_t ) xTaskGetTickCount() )
+    #define portOBJECT_METRICS_TIMESTAMP_HZ    ( ( uint32_t ) configTICK_RATE_HZ )
+#endif
+
+#ifndef portOBJECT_METRICS_TIMESTAMP_HZ
+    #error portOBJECT_METRICS_TIMESTAMP_HZ must be defined in portmacro.h together with portOBJECT_METRICS_TIMESTAMP().
+#endif
+
+/* Number of buckets in the blocked time histogram of each object.  Bucket 0
+ * counts waits of less than one time stamp tick, bucket n waits from 2^(n-1)
+ * to 2^n - 1 ticks, and the last bucket also counts everything longer. */
+#ifndef configOBJECT_METRICS_BUCKETS
+    #define configOBJECT_METRICS_BUCKETS    16U
+#endif
+
+#if ( ( configOBJECT_METRICS_BUCKETS < 2 ) || ( configOBJECT_METRICS_BUCKETS > 33 ) )
+    #error configOBJECT_METRICS_BUCKETS must be between 2 and 33.
+#endif
+
+/* Version of the xObjectMetricsExport() format, checked by the decoder. */
+#define objmetricsFORMAT_VERSION    1U
+#define objmetricsEXPORT_MAGIC      0x54454D4FUL /* "OMET" little endian. */
+
+typedef enum
+{
+    eObjectMetricsQueue = 0,
+    eObjectMetricsSemaphore,
+    eObjectMetricsMutex,
+    eObjectMetricsEventGroup,
+    eObjectMetricsStreamBuffer,
+    eObjectMetricsMessageBuffer,
+    eObjectMetricsTimer
+} eObjectMetricsType;
+
+/* How a blocking call ended, passed to vObjectMetricsWaitEnd(). */
+typedef enum
+{
+    eObjectMetricsWaitSatisfied = 0,
+    eObjectMetricsSendTimedOut,
+    eObjectMetricsReceiveTimedOut
+} eObjectMetricsWaitResult;
+
+typedef struct xOBJECT_METRICS
+{
+    struct xOBJECT_METRICS * pxNext;                       /* Registry link.  NULL in the copies returned to the application. */
+    const void * pvObject;                                 /* Handle of the object. */
+    const char * pcName;                                   /* Name given with vQueueAddToRegistry(), xObjectMetricsSetName() or xTimerCreate(), or NULL. */
+    uint32_t ulObjectNumber;                               /* Unique, increasing number given at registration. */
+    uint8_t ucType;                                        /* One of eObjectMetricsType. */
+    uint32_t ulSends;                                      /* Successful sends, gives, set bits calls or processed timer commands. */
+    uint32_t ulReceives;                                   /* Successful receives, takes, waits or timer callbacks. */
+    uint32_t ulSendTimeouts;                               /* Sends that returned because the object stayed full. */
+    uint32_t ulReceiveTimeouts;                            /* Receives that returned because the object stayed empty. */
+    uint32_t ulPeakLevel;                                  /* Highest fill level seen: items, bytes, waiting tasks for event groups, pending commands for timers. */
+    uint32_t ulContentions;                                /* Mutex takes that had to block because the mutex was held. */
+    uint32_t ulHoldStart;                                  /* Time stamp of the last mutex take. */
+    uint32_t ulMaxHoldTime;                                /* Longest time the mutex was held. */
+    uint32_t ulTotalHoldTime;                              /* Sum of all mutex hold times. */
+    uint32_t ulBlockedTime[ configOBJECT_METRICS_BUCKETS ]; /* Blocked time histogram, callback execution time for timers. */
+} ObjectMetrics_t;
+
+/*
+ * Give the object pvObject a name for reports.  Queues and semaphores added
+ * to the queue registry, and timers, are named automatically.  pcName is not
+ * copied.  Returns pdFAIL if pvObject is not in the registry.
+ */
+BaseType_t xObjectMetricsSetName( const void * pvObject,
+                                  const char * pcName );
+
+/*
+ * Copy the metrics of the object pvObject into *pxMetrics.  Returns pdFAIL if
+ * pvObject is not in the registry.
+ */
+BaseType_t xObjectMetricsGet( const void * pvObject,
+                              ObjectMetrics_t * pxMetrics );
+
+/*
+ * Copy the metrics of up to uxArraySize objects, in the order they were
+ * created, and return the number copied.  Each object is copied in its own
+ * short critical section.
+ */
+UBaseType_t uxObjectMetricsGetAll( ObjectMetrics_t * const pxMetricsArray,
+                                   const UBaseType_t uxArraySize );
+
+/*
+ * Clear the counters and histograms of every object.
+ */
+void vObjectMetricsReset( void );
+
+/*
+ * Serialise the registry into pucBuffer: a 12 byte header followed by one
+ * variable length record per object, with every counter LEB128 encoded so
+ * idle objects take a few bytes.  Objects that do not fit are left out and
+ * the header counts only the records written.  Returns the number of bytes
+ * written, or 0 if the buffer cannot hold the header.
+ */
+size_t xObjectMetricsExport( uint8_t * pucBuffer,
+                             size_t xBufferSize );
+
+/*
+ * The functions below are called by the kernel and should not be called
+ * directly by the application.
+ */
+void vObjectMetricsRegister( ObjectMetrics_t * pxMetrics,
+                             const void * pvObject,
+                             eObjectMetricsType eType,
+                             const char * pcName );
+void vObjectMetricsUnregister( ObjectMetrics_t * pxMetrics );
+void vObjectMetricsWaitEnd( ObjectMetrics_t * pxMetrics,
+                            uint32_t ulWaitStart,
+                            eObjectMetricsWaitResult eResult );
+void vObjectMetricsMutexGiven( ObjectMetrics_t * pxMetrics );
+
+/*
+ * Hooks used by the kernel objects.  FreeRTOS.h defines them as empty when
+ * configUSE_OBJECT_METRICS is 0.  Unless noted, they must be used where the
+ * object is already protected from concurrent access: in a critical section,
+ * or with the scheduler suspended for event groups, or by the single writer or
+ * reader of a stream buffer.
+ */
+#define objmetricsREGISTER( pxMetrics, pvObject, eType, pcName )    vObjectMetricsRegister( ( pxMetrics ), ( pvObject ), ( eType ), ( pcName ) )
+#define objmetricsUNREGISTER( pxMetrics )                           vObjectMetricsUnregister( pxMetrics )
+
+#define objmetricsSEND( pxMetrics, uxLevel )                        \
+    do {                                                            \
+        ( pxMetrics )->ulSends++;                                   \
+                                                                    \
+        if( ( uint32_t ) ( uxLevel ) > ( pxMetrics )->ulPeakLevel ) \
+        {                                                           \
+            ( pxMetrics )->ulPeakLevel = ( uint32_t ) ( uxLevel );  \
+        }                                                           \
+    } while( 0 )
+
+#define objmetricsRECEIVE( pxMetrics )           ( ( pxMetrics )->ulReceives++ )
+#define objmetricsSEND_FAILED( pxMetrics )       ( ( pxMetrics )->ulSendTimeouts++ )
+#define objmetricsRECEIVE_FAILED( pxMetrics )    ( ( pxMetrics )->ulReceiveTimeouts++ )
+#define objmetricsCONTENTION( pxMetrics )        ( ( pxMetrics )->ulContentions++ )
+#define objmetricsMUTEX_TAKEN( pxMetrics )       ( ( pxMetrics )->ulHoldStart = portOBJECT_METRICS_TIMESTAMP() )
+#define objmetricsMUTEX_GIVEN( pxMetrics )       vObjectMetricsMutexGiven( pxMetrics )
+
+/* Bracket a blocking wait.  objmetricsWAIT_END() takes its own critical
+ * section, so can be used anywhere in task context. */
+#define objmetricsWAIT_START( ulWaitStart )                      ( ( ulWaitStart ) = portOBJECT_METRICS_TIMESTAMP() )
+#define objmetricsWAIT_END( pxMetrics, ulWaitStart, eResult )    vObjectMetricsWaitEnd( ( pxMetrics ), ( ulWaitStart ), ( eResult ) )
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* OBJECT_METRICS_H */
@@ -1528,6 +1528,58 @@ QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION
 BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Use xSemaphoreGive() instead of calling this
+ * function directly.
+ */
+#if ( configUSE_QUEUE_FAST_PATHS == 1 )
+    BaseType_t xQueueSemaphoreGive( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueSendPointer( QueueHandle_t xQueue,
+ *                               void * pvItem,
+ *                               TickType_t xTicksToWait );
+ * BaseType_t xQueueReceivePointer( QueueHandle_t xQueue,
+ *                                  void ** ppvItem,
+ *                                  TickType_t xTicksToWait );
+ * @endcode
+ *
+ * configUSE_QUEUE_FAST_PATHS must be set to 1 in FreeRTOSConfig.h for these
+ * functions to be available.
+ *
+ * Send a pointer to the back of a queue, or receive one from it, for queues
+ * created with an item size of sizeof( void * ).  They behave like
+ * xQueueSendToBack() and xQueueReceive(), but when the item can be sent or
+ * received straight away they copy it with a single store or load instead of
+ * going through the generic path.  The storage area of a statically created
+ * queue must be aligned to a pointer.
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * @param pvItem The pointer to send.
+ *
+ * @param ppvItem Where the received pointer is written.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space or for an item, if none is available straight away.
+ *
+ * @return pdPASS if the item was sent or received, otherwise errQUEUE_FULL or
+ * errQUEUE_EMPTY.
+ *
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_FAST_PATHS == 1 )
+    BaseType_t xQueueSendPointer( QueueHandle_t xQueue,
+                                  void * pvItem,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    BaseType_t xQueueReceivePointer( QueueHandle_t xQueue,
+                                     void ** ppvItem,
+                                     TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
     TaskHandle_t xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
     TaskHandle_t xQueueGetMutexHolderFromISR( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
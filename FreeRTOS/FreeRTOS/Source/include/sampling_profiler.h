@@ -0,0 +1,161 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Statistical sampling profiler.
+ *
+ * When configUSE_SAMPLING_PROFILER is set to 1 the port interrupts each core
+ * configSAMPLING_PROFILER_HZ times a second and passes the interrupted program
+ * counter and link register to vSamplingProfilerSample(), which appends them,
+ * together with the handle of the task running on that core, to a per-core
+ * ring buffer.  Samples are removed with xSamplingProfilerRead(), usually by a
+ * low priority task that forwards them to a host, where sampling_profile.py
+ * in the root of the repository resolves the addresses against the ELF symbol
+ * table and builds per-task flat profiles and flame graphs.
+ *
+ * The sampling interrupt should not be derived from the tick: code that runs
+ * in step with the tick (every periodic task) would then always, or never, be
+ * caught running.  The default rate of 997 Hz is prime for that reason.
+ *
+ * Interrupts are masked while a core is inside a critical section, so time
+ * spent there is charged to the instruction that re-enables interrupts.
+ *
+ * The port measures the cycles spent in its sampling handler and reports them
+ * with vSamplingProfilerAddOverhead(), so the cost of profiling is available
+ * from vSamplingProfilerGetStats() alongside the samples themselves.
+ */
+
+#ifndef SAMPLING_PROFILER_H
+#define SAMPLING_PROFILER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include sampling_profiler.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Number of samples held by the ring buffer of each core.  Must be a power of
+ * two. */
+#ifndef configSAMPLING_PROFILER_BUFFER_LENGTH
+    #define configSAMPLING_PROFILER_BUFFER_LENGTH    256U
+#endif
+
+#if ( ( configSAMPLING_PROFILER_BUFFER_LENGTH & ( configSAMPLING_PROFILER_BUFFER_LENGTH - 1U ) ) != 0U )
+    #error configSAMPLING_PROFILER_BUFFER_LENGTH must be a power of two.
+#endif
+
+/* Samples taken per second on each core. */
+#ifndef configSAMPLING_PROFILER_HZ
+    #define configSAMPLING_PROFILER_HZ    997U
+#endif
+
+#if ( configSAMPLING_PROFILER_HZ == 0U )
+    #error configSAMPLING_PROFILER_HZ must not be 0.
+#endif
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+    #error configUSE_SAMPLING_PROFILER requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1.
+#endif
+
+/* Set in ucFlags when the sampled code was itself an interrupt handler, in
+ * which case ulTask is the task that was interrupted. */
+#define sprofFLAG_INTERRUPT    0x01U
+
+/*
+ * One sample.  The layout is part of the format read by sampling_profile.py.
+ * ulLR is only a reliable return address while the interrupted function has
+ * not yet reused the link register, so the host tool treats it as a hint.
+ */
+typedef struct xPROFILER_SAMPLE
+{
+    uint32_t ulPC;      /* Interrupted program counter. */
+    uint32_t ulLR;      /* Interrupted link register. */
+    uint32_t ulTask;    /* Handle of the task running on the core. */
+    uint8_t ucCore;     /* Core the sample was taken on. */
+    uint8_t ucFlags;    /* sprofFLAG_ values. */
+    uint16_t usReserved;
+} ProfilerSample_t;
+
+/* Sampling activity of one core since the last vSamplingProfilerReset(). */
+typedef struct xPROFILER_STATS
+{
+    uint32_t ulSamples;        /* Samples written to the ring buffer. */
+    uint32_t ulDropped;        /* Samples lost because the ring buffer was full. */
+    uint32_t ulMaxCycles;      /* Longest sampling handler, in CPU cycles. */
+    uint32_t ulTotalCycles;    /* Cycles spent in the sampling handler. */
+} ProfilerStats_t;
+
+/*
+ * Start and stop recording samples.  The port keeps sampling while the
+ * profiler is stopped, but the samples are discarded without being counted.
+ */
+void vSamplingProfilerStart( void );
+void vSamplingProfilerStop( void );
+
+/*
+ * Move up to xMaxSamples of the oldest samples of core xCoreID into
+ * pxSamples.  Returns the number of samples copied.  Only one task may read
+ * the buffer of a given core at a time.
+ */
+size_t xSamplingProfilerRead( BaseType_t xCoreID,
+                              ProfilerSample_t * pxSamples,
+                              size_t xMaxSamples );
+
+/*
+ * Copy the statistics of core xCoreID into *pxStats.  Dividing ulTotalCycles
+ * by the CPU cycles in the measured period gives the profiling overhead.
+ */
+void vSamplingProfilerGetStats( BaseType_t xCoreID,
+                                ProfilerStats_t * pxStats );
+
+/*
+ * Clear the statistics of all cores.  Samples already in the ring buffers are
+ * kept.
+ */
+void vSamplingProfilerReset( void );
+
+/*
+ * The functions below are called by the port from its sampling interrupt and
+ * should not be called directly by the application.
+ */
+void vSamplingProfilerSample( uint32_t ulPC,
+                              uint32_t ulLR,
+                              uint8_t ucFlags );
+void vSamplingProfilerAddOverhead( uint32_t ulCycles );
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* SAMPLING_PROFILER_H */
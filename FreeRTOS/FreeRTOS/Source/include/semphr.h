@@ -457,7 +457,11 @@ typedef QueueHandle_t SemaphoreHandle_t;
  * \defgroup xSemaphoreGive xSemaphoreGive
  * \ingroup Semaphores
  */
-#define xSemaphoreGive( xSemaphore )    xQueueGenericSend( ( QueueHandle_t ) ( xSemaphore ), NULL, semGIVE_BLOCK_TIME, queueSEND_TO_BACK )
+#if ( configUSE_QUEUE_FAST_PATHS == 1 )
+    #define xSemaphoreGive( xSemaphore )    xQueueSemaphoreGive( ( QueueHandle_t ) ( xSemaphore ) )
+#else
+    #define xSemaphoreGive( xSemaphore )    xQueueGenericSend( ( QueueHandle_t ) ( xSemaphore ), NULL, semGIVE_BLOCK_TIME, queueSEND_TO_BACK )
+#endif
 
 /**
  * semphr. h
@@ -73,7 +73,7 @@
         /* Is the currently saved stack pointer within the stack limit? */                      \
         if( pxCurrentTCB->pxTopOfStack <= pxCurrentTCB->pxStack + portSTACK_LIMIT_PADDING )     \
         {                                                                                       \
-            char * pcOverflowTaskName = pxCurrentTCB->pcTaskName;                               \
+            char * pcOverflowTaskName = taskCOLD( pxCurrentTCB )->pcTaskName;                   \
             vApplicationStackOverflowHook( ( TaskHandle_t ) pxCurrentTCB, pcOverflowTaskName ); \
         }                                                                                       \
     } while( 0 )
@@ -90,7 +90,7 @@
         /* Is the currently saved stack pointer within the stack limit? */                       \
         if( pxCurrentTCB->pxTopOfStack >= pxCurrentTCB->pxEndOfStack - portSTACK_LIMIT_PADDING ) \
         {                                                                                        \
-            char * pcOverflowTaskName = pxCurrentTCB->pcTaskName;                                \
+            char * pcOverflowTaskName = taskCOLD( pxCurrentTCB )->pcTaskName;                    \
             vApplicationStackOverflowHook( ( TaskHandle_t ) pxCurrentTCB, pcOverflowTaskName );  \
         }                                                                                        \
     } while( 0 )
@@ -112,7 +112,7 @@
             ( pulStack[ 2 ] != ulCheckValue ) ||                                                 \
             ( pulStack[ 3 ] != ulCheckValue ) )                                                  \
         {                                                                                        \
-            char * pcOverflowTaskName = pxCurrentTCB->pcTaskName;                                \
+            char * pcOverflowTaskName = taskCOLD( pxCurrentTCB )->pcTaskName;                    \
             vApplicationStackOverflowHook( ( TaskHandle_t ) pxCurrentTCB, pcOverflowTaskName );  \
         }                                                                                        \
     } while( 0 )
@@ -137,7 +137,7 @@
         if( ( pxCurrentTCB->pxTopOfStack >= pxCurrentTCB->pxEndOfStack - portSTACK_LIMIT_PADDING ) ||                                     \
             ( memcmp( ( void * ) pcEndOfStack, ( void * ) ucExpectedStackBytes, sizeof( ucExpectedStackBytes ) ) != 0 ) )                 \
         {                                                                                                                                 \
-            char * pcOverflowTaskName = pxCurrentTCB->pcTaskName;                                                                         \
+            char * pcOverflowTaskName = taskCOLD( pxCurrentTCB )->pcTaskName;                                                             \
             vApplicationStackOverflowHook( ( TaskHandle_t ) pxCurrentTCB, pcOverflowTaskName );                                           \
         }                                                                                                                                 \
     } while( 0 )
@@ -149,6 +149,41 @@
 #ifndef taskCHECK_FOR_STACK_OVERFLOW
     #define taskCHECK_FOR_STACK_OVERFLOW()
 #endif
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SAMPLED_STACK_HIGH_WATER_MARK == 1 )
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_SAMPLED_STACK_HIGH_WATER_MARK is not supported by MPU ports, which save the context in the TCB.
+    #endif
+
+/* Record the saved stack pointer of the task being switched out if it is the
+ * deepest seen so far. */
+    #if ( portSTACK_GROWTH < 0 )
+        #define taskSAMPLE_STACK_HIGH_WATER_MARK( pxTCB )                  \
+    do                                                                     \
+    {                                                                      \
+        if( ( pxTCB )->pxTopOfStack < ( pxTCB )->pxStackHighWaterMark )    \
+        {                                                                  \
+            ( pxTCB )->pxStackHighWaterMark = ( pxTCB )->pxTopOfStack;     \
+        }                                                                  \
+    } while( 0 )
+    #else
+        #define taskSAMPLE_STACK_HIGH_WATER_MARK( pxTCB )                  \
+    do                                                                     \
+    {                                                                      \
+        if( ( pxTCB )->pxTopOfStack > ( pxTCB )->pxStackHighWaterMark )    \
+        {                                                                  \
+            ( pxTCB )->pxStackHighWaterMark = ( pxTCB )->pxTopOfStack;     \
+        }                                                                  \
+    } while( 0 )
+    #endif /* portSTACK_GROWTH */
+
+#else /* configUSE_SAMPLED_STACK_HIGH_WATER_MARK */
+
+    #define taskSAMPLE_STACK_HIGH_WATER_MARK( pxTCB )
+
+#endif /* configUSE_SAMPLED_STACK_HIGH_WATER_MARK */
 
 
 
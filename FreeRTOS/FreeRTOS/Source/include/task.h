@@ -122,6 +122,15 @@ typedef enum
     eSetValueWithoutOverwrite /* Set the task's notification value if the previous value has been read by the task. */
 } eNotifyAction;
 
+/* How the stack of a new task is filled, used when configUSE_STACK_FILL_ELISION
+ * is 1.  The fill is what uxTaskGetStackHighWaterMark() looks for. */
+typedef enum
+{
+    eTaskStackFillFull = 0, /* Fill the whole stack when the task is created. */
+    eTaskStackFillIdle,     /* Fill the words checked for overflow when the task is created, and the rest later from the idle task. */
+    eTaskStackFillGuard     /* Only fill the words checked for overflow.  The high water mark of the task is not meaningful. */
+} eTaskStackFill;
+
 /*
  * Used internally only.
  */
@@ -158,6 +167,20 @@ typedef struct xTASK_PARAMETERS
     #endif
 } TaskParameters_t;
 
+/*
+ * Parameters of one of the tasks created by xTaskCreateMultiple().
+ */
+typedef struct xTASK_CREATE_PARAMETERS
+{
+    TaskFunction_t pxTaskCode;
+    const char * pcName;
+    configSTACK_DEPTH_TYPE uxStackDepth;
+    void * pvParameters;
+    UBaseType_t uxPriority;
+    eTaskStackFill eStackFill;
+    TaskHandle_t * pxCreatedTask;
+} TaskCreateParameters_t;
+
 /* Used with the uxTaskGetSystemState() function to return the state of each task
  * in the system. */
 typedef struct xTASK_STATUS
@@ -180,6 +203,287 @@ typedef struct xTASK_STATUS
     #endif
 } TaskStatus_t;
 
+/* Used with vTaskGetCoreRunTimeStats() and ulTaskGetCoreLoadPercent(). */
+typedef struct xCORE_RUN_TIME_STATS
+{
+    configRUN_TIME_COUNTER_TYPE ulElapsedTime; /* Run time counter ticks since the scheduler started. */
+    configRUN_TIME_COUNTER_TYPE ulIdleTime;    /* Part of ulElapsedTime the core spent in an idle task. */
+    configRUN_TIME_COUNTER_TYPE ulISRTime;     /* Part of ulElapsedTime the core spent in instrumented interrupts. */
+} CoreRunTimeStats_t;
+
+/* Used with vTaskGetSnapshot() and uxTaskGetSystemSnapshot(). */
+typedef struct xTASK_SNAPSHOT
+{
+    TaskHandle_t xHandle;                         /* The handle of the task. */
+    const char * pcTaskName;                      /* A pointer to the task's name. */
+    eTaskState eCurrentState;                     /* The state in which the task existed when the snapshot was taken. */
+    UBaseType_t uxCurrentPriority;                /* The priority at which the task was running (may be inherited). */
+    UBaseType_t uxBasePriority;                   /* The priority to which the task will return if its priority has been inherited.  Only valid if configUSE_MUTEXES is 1. */
+    configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /* The total run time of the task, including the current slice if it is running.  Only valid if configGENERATE_RUN_TIME_STATS is 1. */
+    configSTACK_DEPTH_TYPE usStackHighWaterMark;  /* The sampled stack high water mark, in words.  Only valid if configUSE_SAMPLED_STACK_HIGH_WATER_MARK is 1. */
+} TaskSnapshot_t;
+
+/* Used with vTaskGetCoreSMPStats().  Times are in portSMP_STATS_TIMESTAMP() units. */
+typedef struct xCORE_SMP_STATS
+{
+    uint32_t ulYieldRequestsSent;     /* Yield requests this core sent to the other cores. */
+    uint32_t ulYieldRequestsReceived; /* Yield requests from other cores this core has acted on. */
+    uint32_t ulWastedYields;          /* Received requests after which the same task kept running. */
+    uint32_t ulMigrationsIn;          /* Tasks switched in here that last ran on another core. */
+    uint32_t ulMaxYieldLatency;       /* Longest time from a request being sent to this core rescheduling. */
+    uint32_t ulTotalYieldLatency;     /* Sum of the latencies, divide by ulYieldRequestsReceived for the mean. */
+} CoreSMPStats_t;
+
+/* Used with vTaskGetSMPStats(). */
+typedef struct xTASK_SMP_STATS
+{
+    BaseType_t xLastRunCore;  /* The core the task last ran on, or -1 if it has never run. */
+    uint32_t ulMigrations;    /* Times the task was switched in on a different core than the one it last ran on. */
+    uint32_t ulYieldRequests; /* Times another core asked the core running this task to reschedule. */
+} TaskSMPStats_t;
+
+/* Used with uxTaskGetStackReport(). */
+typedef struct xTASK_STACK_STATUS
+{
+    TaskHandle_t xHandle;                        /* The handle of the task. */
+    const char * pcTaskName;                     /* A pointer to the task's name. */
+    configSTACK_DEPTH_TYPE usStackHighWaterMark; /* The smallest amount of free stack, in words, seen at a context switch. */
+} TaskStackStatus_t;
+
+/* Statistics kept by a job monitor, see vTaskSetJobMonitor().  Times are in
+ * run time counter units when configGENERATE_RUN_TIME_STATS is 1, otherwise
+ * in ticks. */
+typedef struct xJOB_STATS
+{
+    configRUN_TIME_COUNTER_TYPE ulCompletedJobs;     /* Number of jobs that have completed. */
+    configRUN_TIME_COUNTER_TYPE ulDeadlineMisses;    /* Number of jobs that completed after their deadline. */
+    TickType_t xPeriod;                              /* Period passed to the last xTaskDelayUntil() call, or 0. */
+    TickType_t xMaxLateness;                         /* Largest number of whole ticks a job completed after its deadline. */
+    configRUN_TIME_COUNTER_TYPE ulLastResponseTime;  /* Release to completion time of the last job. */
+    configRUN_TIME_COUNTER_TYPE ulMinResponseTime;   /* Shortest release to completion time observed. */
+    configRUN_TIME_COUNTER_TYPE ulMaxResponseTime;   /* Longest release to completion time observed. */
+    configRUN_TIME_COUNTER_TYPE ulMaxReleaseJitter;  /* Longest release to start of execution time observed. */
+    configRUN_TIME_COUNTER_TYPE ulLastExecutionTime; /* Time the last job spent running.  Only kept when configGENERATE_RUN_TIME_STATS is 1. */
+    configRUN_TIME_COUNTER_TYPE ulMaxExecutionTime;  /* Worst case observed execution time.  Only kept when configGENERATE_RUN_TIME_STATS is 1. */
+} JobStats_t;
+
+/* Per task job monitor, owned by the application and attached to a task with
+ * vTaskSetJobMonitor().  Only xStats and xRelativeDeadline are meant to be
+ * read by the application, the other members are used by the kernel. */
+typedef struct xJOB_MONITOR
+{
+    JobStats_t xStats;
+    TickType_t xRelativeDeadline;                 /* Deadline relative to the release, or 0 to use the period. */
+    TickType_t xReleaseTick;                      /* Tick at which the current job was released. */
+    TickType_t xNextReleaseTick;                  /* Tick at which xTaskDelayUntil() will release the next job. */
+    configRUN_TIME_COUNTER_TYPE ulReleaseTime;    /* Time at which the current job was released. */
+    configRUN_TIME_COUNTER_TYPE ulRunTimeAtStart; /* Run time of the task when the current job started. */
+    UBaseType_t uxState;                          /* Waiting for a release, released or running. */
+} JobMonitor_t;
+
+/* Replenishment policies of an aperiodic server, see
+ * vTaskSetAperiodicServer(). */
+typedef enum
+{
+    eSporadicServer = 0, /* Consumed budget is returned one period after the task became active. */
+    eDeferrableServer    /* The full budget is restored at the start of every period. */
+} eAperiodicServerPolicy;
+
+/* Statistics kept by an aperiodic server.  Times are in run time counter
+ * units. */
+typedef struct xAPERIODIC_SERVER_STATS
+{
+    configRUN_TIME_COUNTER_TYPE ulBudget;        /* Budget left in the current period. */
+    configRUN_TIME_COUNTER_TYPE ulConsumed;      /* Budget consumed since the server was attached. */
+    uint32_t ulExhaustions;                      /* Times the task dropped to its background priority. */
+    uint32_t ulReplenishments;                   /* Replenishments applied. */
+} AperiodicServerStats_t;
+
+typedef struct xAPERIODIC_SERVER_REPLENISHMENT
+{
+    configRUN_TIME_COUNTER_TYPE ulTime;          /* When the budget is returned. */
+    configRUN_TIME_COUNTER_TYPE ulAmount;        /* How much budget is returned. */
+} AperiodicServerReplenishment_t;
+
+/* Per task aperiodic server, owned by the application and attached to a task
+ * with vTaskSetAperiodicServer().  The members are used by the kernel, read
+ * the statistics with vTaskGetAperiodicServerStats(). */
+typedef struct xAPERIODIC_SERVER
+{
+    AperiodicServerStats_t xStats;
+    struct xAPERIODIC_SERVER * pxNext;           /* Next attached server. */
+    void * pvTask;                               /* The task the server is attached to. */
+    eAperiodicServerPolicy ePolicy;
+    UBaseType_t uxHighPriority;                  /* Priority while the task has budget. */
+    UBaseType_t uxLowPriority;                   /* Priority once the budget is exhausted. */
+    configRUN_TIME_COUNTER_TYPE ulCapacity;      /* Budget available per period. */
+    configRUN_TIME_COUNTER_TYPE ulPeriod;
+    configRUN_TIME_COUNTER_TYPE ulLastCharged;   /* Time the running task was last charged for. */
+    configRUN_TIME_COUNTER_TYPE ulActivationTime;
+    configRUN_TIME_COUNTER_TYPE ulActivationUsed; /* Budget consumed since the activation time. */
+    configRUN_TIME_COUNTER_TYPE ulNextPeriod;    /* Start of the next period of a deferrable server. */
+    BaseType_t xHigh;                            /* pdTRUE while the task runs at uxHighPriority. */
+    BaseType_t xCharging;                        /* pdTRUE while the task is running at uxHighPriority. */
+    BaseType_t xActive;                          /* pdTRUE between a sporadic server's activation and its next block or exhaustion. */
+    UBaseType_t uxPending;                       /* Entries used in xReplenishments. */
+    AperiodicServerReplenishment_t xReplenishments[ configAPERIODIC_SERVER_MAX_REPLENISHMENTS ];
+} AperiodicServer_t;
+
+/* Criticality levels of tasks, and modes of the system, for mixed criticality
+ * scheduling, see vTaskSetCriticality(). */
+typedef enum
+{
+    eCriticalityLow = 0,
+    eCriticalityHigh
+} eCriticalityLevel;
+
+/* What happens to a low criticality task in high criticality mode. */
+typedef enum
+{
+    eCriticalityDegrade = 0, /* The task runs at a lower priority. */
+    eCriticalitySuspend      /* The task is held in the Suspended state. */
+} eCriticalityAction;
+
+/* Statistics of mixed criticality scheduling.  Times are in run time counter
+ * units. */
+typedef struct xCRITICALITY_STATS
+{
+    uint32_t ulModeSwitches;                     /* Switches to high criticality mode. */
+    uint32_t ulLowBudgetOverruns;                /* Jobs that ran past their low criticality budget. */
+    uint32_t ulHighBudgetOverruns;               /* Jobs of high criticality tasks that ran past their high criticality budget. */
+    configRUN_TIME_COUNTER_TYPE ulTimeInHighMode; /* Total time spent in high criticality mode. */
+} CriticalityStats_t;
+
+/* Per task criticality, owned by the application and set with
+ * vTaskSetCriticality().  The members are used by the kernel. */
+typedef struct xCRITICALITY
+{
+    struct xCRITICALITY * pxNext;                /* Next task with a criticality. */
+    void * pvTask;                               /* The task. */
+    eCriticalityLevel eLevel;
+    eCriticalityAction eAction;                  /* Only used by low criticality tasks. */
+    configRUN_TIME_COUNTER_TYPE ulLowBudget;     /* Execution time per job in low criticality mode. */
+    configRUN_TIME_COUNTER_TYPE ulHighBudget;    /* Execution time per job in high criticality mode. */
+    UBaseType_t uxDegradedPriority;              /* Priority in high criticality mode for eCriticalityDegrade. */
+    UBaseType_t uxNormalPriority;                /* Priority to restore in low criticality mode. */
+    configRUN_TIME_COUNTER_TYPE ulJobTime;       /* Execution time of the current job so far. */
+    configRUN_TIME_COUNTER_TYPE ulSwitchedInTime; /* Time the task was last charged for. */
+    BaseType_t xLowOverrun;                      /* pdTRUE once the current job has passed ulLowBudget. */
+    BaseType_t xHighOverrun;                     /* pdTRUE once the current job has passed ulHighBudget. */
+    BaseType_t xHeld;                            /* pdTRUE while degraded or suspended by high criticality mode. */
+} Criticality_t;
+
+/* What happens to a task that uses up its execution budget, see
+ * vTaskSetExecutionBudget(). */
+typedef enum
+{
+    eBudgetNotify = 0, /* The overrun is only counted and reported. */
+    eBudgetDemote,     /* The task runs at a lower priority. */
+    eBudgetSuspend     /* The task is held in the Suspended state. */
+} eBudgetAction;
+
+/* Statistics of an execution budget.  Times are in run time counter units. */
+typedef struct xEXECUTION_BUDGET_STATS
+{
+    configRUN_TIME_COUNTER_TYPE ulBudgetLeft; /* Budget left in the current period. */
+    configRUN_TIME_COUNTER_TYPE ulConsumed;   /* Total execution time charged to the task. */
+    uint32_t ulPeriods;                       /* Periods that have been replenished. */
+    uint32_t ulOverruns;                      /* Periods in which the task used up its budget. */
+} ExecutionBudgetStats_t;
+
+/* Per task execution budget, owned by the application and set with
+ * vTaskSetExecutionBudget().  The members are used by the kernel. */
+typedef struct xEXECUTION_BUDGET
+{
+    ExecutionBudgetStats_t xStats;
+    struct xEXECUTION_BUDGET * pxNext;        /* Next task with a budget. */
+    void * pvTask;                            /* The task. */
+    eBudgetAction eAction;
+    UBaseType_t uxDemotedPriority;            /* Priority once the budget is used up for eBudgetDemote. */
+    UBaseType_t uxNormalPriority;             /* Priority to restore when the budget is replenished. */
+    configRUN_TIME_COUNTER_TYPE ulBudget;     /* Execution time per period. */
+    configRUN_TIME_COUNTER_TYPE ulPeriod;     /* Replenishment period. */
+    configRUN_TIME_COUNTER_TYPE ulNextPeriod; /* Start of the next period. */
+    configRUN_TIME_COUNTER_TYPE ulLastCharged; /* Time the task was last charged for. */
+    BaseType_t xOverrun;                      /* pdTRUE once the budget of the current period is used up. */
+    BaseType_t xEnforced;                     /* pdTRUE while demoted or suspended by eAction. */
+} ExecutionBudget_t;
+
+/* Statistics of a task group.  Times are in run time counter units. */
+typedef struct xTASK_GROUP_STATS
+{
+    configRUN_TIME_COUNTER_TYPE ulBudgetLeft; /* Budget left in the current period. */
+    configRUN_TIME_COUNTER_TYPE ulConsumed;   /* Total execution time of all the members. */
+    uint32_t ulPeriods;                       /* Periods that have been replenished. */
+    uint32_t ulDepletions;                    /* Periods in which the group used up its budget. */
+    UBaseType_t uxMembers;                    /* Tasks in the group. */
+} TaskGroupStats_t;
+
+/* A group of tasks that share a CPU reservation, owned by the application and
+ * initialised with vTaskGroupInit().  The members are used by the kernel. */
+typedef struct xTASK_GROUP
+{
+    TaskGroupStats_t xStats;
+    struct xTASK_GROUP * pxNext;              /* Next group. */
+    void * pvMembers;                         /* First task in the group. */
+    List_t xHeldTasks;                        /* Members that are ready but held until the budget is replenished. */
+    configRUN_TIME_COUNTER_TYPE ulBudget;     /* Execution time per period. */
+    configRUN_TIME_COUNTER_TYPE ulPeriod;     /* Replenishment period. */
+    configRUN_TIME_COUNTER_TYPE ulNextPeriod; /* Start of the next period. */
+    BaseType_t xDepleted;                     /* pdTRUE once the budget of the current period is used up. */
+} TaskGroup_t;
+
+/* One release of a time triggered task in a static cyclic schedule. */
+typedef struct xTIME_TRIGGERED_ENTRY
+{
+    TickType_t xOffset; /* Ticks from the start of the hyperperiod. */
+    UBaseType_t uxTask; /* Index of the task in the array passed to xTaskStartTimeTriggered(). */
+} TimeTriggeredEntry_t;
+
+/* A static cyclic schedule, as generated by tt_table_gen.py.  The entries must
+ * be sorted by offset. */
+typedef struct xTIME_TRIGGERED_TABLE
+{
+    const TimeTriggeredEntry_t * pxEntries;
+    UBaseType_t uxEntries;
+    TickType_t xHyperperiod; /* Length of the table in ticks. */
+} TimeTriggeredTable_t;
+
+/* Statistics of the time triggered schedule. */
+typedef struct xTIME_TRIGGERED_STATS
+{
+    uint32_t ulHyperperiods;   /* Times the table has been dispatched in full. */
+    uint32_t ulReleases;       /* Jobs released. */
+    uint32_t ulMissedReleases; /* Releases of a task that was not waiting for one. */
+} TimeTriggeredStats_t;
+
+/* A low power state an idle core can enter, described by the port or the
+ * application.  pxEnter() is called with interrupts masked and returns once
+ * an interrupt is pending.  It returns the number of ticks that passed while
+ * the tick interrupt was stopped, which is 0 for states that leave it running. */
+typedef struct xIDLE_STATE
+{
+    const char * pcName;
+    TickType_t xTargetResidency;               /* Shortest expected idle time, in ticks, the state is worth entering for. */
+    configRUN_TIME_COUNTER_TYPE ulExitLatency; /* Time taken to wake from the state, in run time counter units. */
+    TickType_t ( * pxEnter )( TickType_t xExpectedIdleTime );
+} IdleState_t;
+
+/* Time one core spent in one idle state. */
+typedef struct xIDLE_STATE_STATS
+{
+    configRUN_TIME_COUNTER_TYPE ulResidency; /* In run time counter units. */
+    uint32_t ulEntries;                      /* Times the state was entered. */
+} IdleStateStats_t;
+
+/* Chooses the index of the state an idle core enters, given the states
+ * ordered from the shallowest to the deepest, the ticks until the next task
+ * is due to unblock, and the shortest wake latency set by a task. */
+typedef UBaseType_t ( * IdleGovernorFunction_t )( const IdleState_t * pxStates,
+                                                  UBaseType_t uxStates,
+                                                  TickType_t xExpectedIdleTime,
+                                                  configRUN_TIME_COUNTER_TYPE ulLatencyLimit );
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -400,6 +704,51 @@ typedef enum
                                        TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskCreateMultiple( const TaskCreateParameters_t * const pxTasks, UBaseType_t uxTasks );
+ * @endcode
+ *
+ * configUSE_TASK_CREATE_MULTIPLE must be defined as 1 for this function to be
+ * available.
+ *
+ * Create the uxTasks tasks described by pxTasks, as if by xTaskCreate(), but
+ * place them all under the control of the scheduler from one critical
+ * section.  If configUSE_STACK_FILL_ELISION is 1 the stack of each task is
+ * filled as its eStackFill member says, otherwise eStackFill is ignored.
+ *
+ * If the memory of a task cannot be allocated no further tasks are created,
+ * the handles of the tasks not created are set to NULL, and the tasks already
+ * created are still started.
+ *
+ * @param pxTasks The tasks to create.  The memory of a task is allocated, and
+ * its stack filled, in array order.
+ *
+ * @param uxTasks The number of entries in pxTasks.
+ *
+ * @return pdPASS if every task was created, otherwise
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY.
+ *
+ * Example usage:
+ * @code{c}
+ * static const TaskCreateParameters_t xBootTasks[] =
+ * {
+ *     { vControlTask, "Ctrl", 512, NULL, 4, eTaskStackFillFull, &xControlHandle },
+ *     { vLogTask,     "Log",  256, NULL, 1, eTaskStackFillIdle, NULL            },
+ *     { vLedTask,     "Led",  128, NULL, 1, eTaskStackFillGuard, NULL           }
+ * };
+ *
+ * configASSERT( xTaskCreateMultiple( xBootTasks, 3 ) == pdPASS );
+ * @endcode
+ * \defgroup xTaskCreateMultiple xTaskCreateMultiple
+ * \ingroup Tasks
+ */
+#if ( configUSE_TASK_CREATE_MULTIPLE == 1 )
+    BaseType_t xTaskCreateMultiple( const TaskCreateParameters_t * const pxTasks,
+                                    UBaseType_t uxTasks ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -1484,6 +1833,52 @@ BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume ) PRIVILEGED_FUNCTION;
     void vTaskPreemptionEnable( const TaskHandle_t xTask );
 #endif
 
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+/**
+ * @brief Sets the preemption threshold of a task.
+ *
+ * A task that is running can only be preempted by a task with a priority
+ * above its preemption threshold, while it is still selected to run by its
+ * own priority.  Tasks that do not preempt each other never have their stack
+ * frames nested, so a set of tasks sharing a threshold needs only the stack of
+ * its deepest member on top of the stacks of the tasks that can preempt them.
+ * A threshold at or below the priority of the task, the default, leaves the
+ * task preemptible as usual.
+ *
+ * On a single core, a task preempted by a task above its threshold is resumed
+ * before any other task at or below its threshold.  With more than one core
+ * the threshold only protects the running task from preemption, and any core
+ * it is not running on may run other tasks.
+ *
+ * @param xTask The handle of the task.  Passing NULL sets the threshold of
+ * the calling task.
+ *
+ * @param uxThreshold The new preemption threshold.  Must be less than
+ * configMAX_PRIORITIES.
+ *
+ * Example usage:
+ *
+ * // Tasks at priorities 1 to 3 do not preempt each other, and are all
+ * // preempted by the task at priority 4.
+ * vTaskPreemptionThresholdSet( xLoggerTask, 3 );
+ * vTaskPreemptionThresholdSet( xControlTask, 3 );
+ */
+    void vTaskPreemptionThresholdSet( TaskHandle_t xTask,
+                                      UBaseType_t uxThreshold );
+
+/**
+ * @brief Returns the preemption threshold of a task.
+ *
+ * @param xTask The handle of the task.  Passing NULL returns the threshold of
+ * the calling task.
+ *
+ * @return The priority a task must be above to preempt xTask, which is the
+ * priority of xTask if its threshold is not above it.
+ */
+    UBaseType_t uxTaskPreemptionThresholdGet( ConstTaskHandle_t xTask );
+#endif
+
 /*-----------------------------------------------------------
 * SCHEDULER CONTROL
 *----------------------------------------------------------*/
@@ -1864,6 +2259,56 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
     configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task.h
+ * @code{c}
+ * configSTACK_DEPTH_TYPE uxTaskGetSampledStackHighWaterMark( TaskHandle_t xTask );
+ * UBaseType_t uxTaskGetStackReport( TaskStackStatus_t * const pxStackStatusArray, const UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * configUSE_SAMPLED_STACK_HIGH_WATER_MARK must be set to 1 in FreeRTOSConfig.h
+ * for these functions to be available.  The kernel then records the deepest
+ * stack pointer each task has had when it was switched out, which costs one
+ * compare per context switch.
+ *
+ * uxTaskGetSampledStackHighWaterMark() returns the smallest amount of free
+ * stack space, in words, seen at a context switch.  Unlike
+ * uxTaskGetStackHighWaterMark() it does not scan the stack, so it takes the
+ * same time for any stack size.  Because it is only sampled, calls that
+ * return before the task is next switched out are not seen, so the value is
+ * an upper bound on the true high water mark.  Leave margin accordingly.
+ *
+ * uxTaskGetStackReport() fills pxStackStatusArray with the sampled high water
+ * mark of up to uxArraySize tasks and returns the number of entries written.
+ * It walks the tasks one at a time in short critical sections, so it never
+ * suspends the scheduler.  Tasks created during the call may be missed and
+ * tasks deleted during the call may be reported.
+ *
+ * @param xTask Handle of the task associated with the stack to be checked.
+ * Set xTask to NULL to check the stack of the calling task.
+ */
+#if ( configUSE_SAMPLED_STACK_HIGH_WATER_MARK == 1 )
+    configSTACK_DEPTH_TYPE uxTaskGetSampledStackHighWaterMark( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxTaskGetStackReport( TaskStackStatus_t * const pxStackStatusArray,
+                                      const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task.h
+ * @code{c}
+ * uint8_t * pxTaskGetStackStart( TaskHandle_t xTask );
+ * @endcode
+ *
+ * INCLUDE_pxTaskGetStackStart must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Returns the lowest address of the stack associated with xTask.  Set xTask
+ * to NULL to get the stack of the calling task.
+ */
+#if ( INCLUDE_pxTaskGetStackStart == 1 )
+    uint8_t * pxTaskGetStackStart( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /* When using trace macros it is sometimes necessary to include task.h before
  * FreeRTOS.h.  When this is done TaskHookFunction_t will not yet have been defined,
  * so the following two prototypes will cause a compilation error.  This can be
@@ -1949,6 +2394,50 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configUSE_DEADLINE_MISS_HOOK == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationDeadlineMissHook( TaskHandle_t xTask, TickType_t xTicksLate );
+ * @endcode
+ *
+ * Called by a task with a job monitor when one of its jobs completes after its
+ * deadline.  See vTaskSetJobMonitor().
+ *
+ * @param xTask the task that missed its deadline.
+ * @param xTicksLate The number of whole ticks by which the deadline was missed.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationDeadlineMissHook( TaskHandle_t xTask,
+                                       TickType_t xTicksLate );
+
+#endif
+
+#if ( configUSE_BUDGET_OVERRUN_HOOK == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationBudgetOverrunHook( TaskHandle_t xTask );
+ * @endcode
+ *
+ * Called when a task with an execution budget uses up its budget, before the
+ * budget action is applied.  It is called with the scheduler locked, from the
+ * tick, a context switch or the execution timer interrupt, so must not block
+ * and may only use the FromISR API.  See vTaskSetExecutionBudget().
+ *
+ * @param xTask the task that used up its budget.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationBudgetOverrunHook( TaskHandle_t xTask );
+
+#endif
+
 #if ( configUSE_IDLE_HOOK == 1 )
 
 /**
@@ -2184,6 +2673,47 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
                                       configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetSnapshot( TaskHandle_t xTask, TaskSnapshot_t * pxSnapshot );
+ * UBaseType_t uxTaskGetSystemSnapshot( TaskSnapshot_t * const pxSnapshotArray, const UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * configUSE_TASK_SNAPSHOT must be defined as 1 for these functions to be
+ * available.
+ *
+ * Lightweight alternatives to vTaskGetInfo() and uxTaskGetSystemState() for
+ * monitors that poll often.  Each task carries a sequence counter that the
+ * kernel increments before and after it changes the task's priority or run
+ * time, so vTaskGetSnapshot() reads a consistent snapshot without a critical
+ * section and without suspending the scheduler, retrying if the task changed
+ * while it was being read.  It may be called from an interrupt or from the
+ * other core, provided xTask cannot be deleted during the call.  If the task
+ * is still changing after a few attempts, for example because the interrupt
+ * preempted the kernel part way through moving it, eCurrentState is set to
+ * eInvalid and the other members may be inconsistent.
+ *
+ * uxTaskGetSystemSnapshot() fills pxSnapshotArray with a snapshot of up to
+ * uxArraySize tasks, in the order they were created, and returns the number
+ * of entries written.  It visits one task per short critical section, so the
+ * scheduler keeps running and interrupts are only masked briefly however many
+ * tasks there are.  Unlike uxTaskGetSystemState() the snapshots are not all
+ * taken at the same instant.
+ *
+ * @param xTask Handle of the task to read.  Set xTask to NULL to read the
+ * calling task.
+ *
+ * \defgroup vTaskGetSnapshot vTaskGetSnapshot
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+    void vTaskGetSnapshot( TaskHandle_t xTask,
+                           TaskSnapshot_t * pxSnapshot ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxTaskGetSystemSnapshot( TaskSnapshot_t * const pxSnapshotArray,
+                                         const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2515,6 +3045,458 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
     configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimePercent( void ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetCoreRunTimeStats( BaseType_t xCoreID, CoreRunTimeStats_t * pxStats );
+ * configRUN_TIME_COUNTER_TYPE ulTaskGetCoreIdleRunTimePercent( BaseType_t xCoreID );
+ * configRUN_TIME_COUNTER_TYPE ulTaskGetCoreLoadPercent( BaseType_t xCoreID, CoreRunTimeStats_t * pxPreviousSample );
+ * @endcode
+ *
+ * configUSE_CORE_RUN_TIME_STATS must be defined as 1 for these functions to be
+ * available.  The kernel then also keeps, for each core, the time spent in an
+ * idle task and in interrupts that call vTaskRunTimeStatsISREnter() and
+ * vTaskRunTimeStatsISRExit().  Interrupt time is charged to the core rather
+ * than to the task it interrupted, so ulRunTimeCounter only holds time the task
+ * itself executed.
+ *
+ * vTaskGetCoreRunTimeStats() returns the counters of one core, including the
+ * slice the core is currently executing, without entering a critical section
+ * or walking the task lists.
+ *
+ * ulTaskGetCoreIdleRunTimePercent() returns the percentage of the time since
+ * the scheduler started that the core spent idle.
+ *
+ * ulTaskGetCoreLoadPercent() returns the percentage of the time since
+ * *pxPreviousSample was taken that the core was not idle, then stores a new
+ * sample in *pxPreviousSample.  Calling it every N milliseconds with the same
+ * sample gives the utilisation of the core over the last N milliseconds.  The
+ * sample must be zero initialised before the first call.
+ *
+ * \defgroup vTaskGetCoreRunTimeStats vTaskGetCoreRunTimeStats
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+    void vTaskGetCoreRunTimeStats( BaseType_t xCoreID,
+                                   CoreRunTimeStats_t * pxStats ) PRIVILEGED_FUNCTION;
+    configRUN_TIME_COUNTER_TYPE ulTaskGetCoreIdleRunTimePercent( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+    configRUN_TIME_COUNTER_TYPE ulTaskGetCoreLoadPercent( BaseType_t xCoreID,
+                                                          CoreRunTimeStats_t * pxPreviousSample ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetCoreSMPStats( BaseType_t xCoreID, CoreSMPStats_t * pxStats );
+ * void vTaskGetSMPStats( TaskHandle_t xTask, TaskSMPStats_t * pxStats );
+ * void vTaskResetSMPStats( void );
+ * @endcode
+ *
+ * configUSE_SMP_STATS must be defined as 1, and configNUMBER_OF_CORES must be
+ * greater than 1, for these functions to be available.  The kernel then counts
+ * how often tasks move between cores and how often one core interrupts another
+ * to make it reschedule, including the requests that end with the interrupted
+ * core carrying on with the same task.  Tasks that migrate often, or cores that
+ * receive many wasted requests, are candidates for a core affinity.
+ *
+ * vTaskGetCoreSMPStats() returns the counters of core xCoreID.
+ *
+ * vTaskGetSMPStats() returns the counters of xTask.  Passing NULL returns the
+ * counters of the calling task.
+ *
+ * vTaskResetSMPStats() clears the counters of every core.  The counters of
+ * each task are left as they are.
+ *
+ * \defgroup vTaskGetCoreSMPStats vTaskGetCoreSMPStats
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_SMP_STATS == 1 )
+    void vTaskGetCoreSMPStats( BaseType_t xCoreID,
+                               CoreSMPStats_t * pxStats ) PRIVILEGED_FUNCTION;
+    void vTaskGetSMPStats( TaskHandle_t xTask,
+                           TaskSMPStats_t * pxStats ) PRIVILEGED_FUNCTION;
+    void vTaskResetSMPStats( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskRunTimeStatsISREnter( void );
+ * void vTaskRunTimeStatsISRExit( void );
+ * @endcode
+ *
+ * Bracket the body of an interrupt handler with these calls to charge the time
+ * it takes to the core instead of the interrupted task.  Nested interrupts are
+ * only counted once.  The port calls them from its own tick handler.  Only
+ * available when configUSE_CORE_RUN_TIME_STATS is 1.
+ *
+ * \defgroup vTaskRunTimeStatsISREnter vTaskRunTimeStatsISREnter
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+    void vTaskRunTimeStatsISREnter( void ) PRIVILEGED_FUNCTION;
+    void vTaskRunTimeStatsISRExit( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetAperiodicServer( TaskHandle_t xTask, AperiodicServer_t * pxServer, eAperiodicServerPolicy ePolicy, UBaseType_t uxHighPriority, UBaseType_t uxLowPriority, configRUN_TIME_COUNTER_TYPE ulBudget, configRUN_TIME_COUNTER_TYPE ulPeriod );
+ * void vTaskGetAperiodicServerStats( TaskHandle_t xTask, AperiodicServerStats_t * pxStats );
+ * @endcode
+ *
+ * configUSE_APERIODIC_SERVERS must be defined as 1 for these functions to be
+ * available.
+ *
+ * vTaskSetAperiodicServer() bounds the processor time xTask can use at
+ * uxHighPriority to ulBudget in every ulPeriod, both in run time counter
+ * units.  While the task has budget it runs at uxHighPriority; once the
+ * budget is exhausted it drops to uxLowPriority (which may be the idle
+ * priority) until the budget is replenished:
+ *
+ *  - eSporadicServer follows the POSIX SCHED_SPORADIC rules.  The task becomes
+ *    active when it starts running at uxHighPriority with budget left, and
+ *    the budget it consumes until it blocks or runs out is returned one period
+ *    after that activation.  A sporadic server with budget C and period T
+ *    never interferes with lower priority tasks more than a periodic task
+ *    with execution time C and period T, so it can be included in a rate
+ *    monotonic analysis as such a task.
+ *  - eDeferrableServer restores the full budget at the start of every period.
+ *    It is simpler, but a burst that straddles a period boundary can use up
+ *    to twice the budget back to back.
+ *
+ * The budget is charged at every context switch and checked on every tick,
+ * so a task may overrun its budget by up to one tick.  Replenishments are
+ * applied on the tick after they are due.  While a server is attached the
+ * server owns the priority of the task; vTaskPrioritySet() must not be used on
+ * it.  Passing NULL for pxServer detaches the server and leaves the task at
+ * the high priority of the detached server.  Passing NULL for xTask attaches
+ * the server to the calling task.  The server must remain valid while it is
+ * attached, and is detached automatically when the task is deleted.
+ *
+ * vTaskGetAperiodicServerStats() copies the statistics of xTask, or zeroes
+ * *pxStats if the task has no server.
+ *
+ * \defgroup vTaskSetAperiodicServer vTaskSetAperiodicServer
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_APERIODIC_SERVERS == 1 )
+    void vTaskSetAperiodicServer( TaskHandle_t xTask,
+                                  AperiodicServer_t * pxServer,
+                                  eAperiodicServerPolicy ePolicy,
+                                  UBaseType_t uxHighPriority,
+                                  UBaseType_t uxLowPriority,
+                                  configRUN_TIME_COUNTER_TYPE ulBudget,
+                                  configRUN_TIME_COUNTER_TYPE ulPeriod ) PRIVILEGED_FUNCTION;
+    void vTaskGetAperiodicServerStats( TaskHandle_t xTask,
+                                       AperiodicServerStats_t * pxStats ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetCriticality( TaskHandle_t xTask, Criticality_t * pxCriticality, eCriticalityLevel eLevel, configRUN_TIME_COUNTER_TYPE ulLowBudget, configRUN_TIME_COUNTER_TYPE ulHighBudget, eCriticalityAction eAction, UBaseType_t uxDegradedPriority );
+ * eCriticalityLevel eTaskGetCriticalityMode( void );
+ * void vTaskGetCriticalityStats( CriticalityStats_t * pxStats );
+ * @endcode
+ *
+ * configUSE_MIXED_CRITICALITY must be defined as 1 for these functions to be
+ * available.
+ *
+ * vTaskSetCriticality() gives xTask a criticality level and the execution
+ * time each of its jobs is expected to need, in run time counter units: a low
+ * criticality task has only ulLowBudget, while a high criticality task has a
+ * lower ulLowBudget, used when the system is provisioned for the typical case,
+ * and a pessimistic ulHighBudget.  A job ends when the task blocks.
+ *
+ * The system starts in low criticality mode.  When a high criticality task
+ * runs past its ulLowBudget the system switches to high criticality mode, and
+ * every low criticality task is held: it either drops to uxDegradedPriority
+ * (eCriticalityDegrade) or is suspended (eCriticalitySuspend, which needs
+ * INCLUDE_vTaskSuspend).  A low criticality task that is suspended while it was
+ * blocked returns from the blocking call as if it had timed out once it is
+ * released.  If the application suspends or resumes a held task itself, the
+ * release leaves it in that state.  The system returns to low criticality mode, and releases the low
+ * criticality tasks, at the first instant no high criticality task is ready or
+ * running.
+ *
+ * Budgets are checked at every context switch and on every tick, so the mode
+ * switch can happen up to one tick after the overrun.  Overruns of a high
+ * criticality task's ulHighBudget are counted but not enforced.  The priority
+ * of a held task must not be changed with vTaskPrioritySet().  A low
+ * criticality task given its criticality during high criticality mode is held
+ * straight away.  Passing NULL for
+ * pxCriticality removes the criticality of the task, releasing it if it is
+ * held.  Passing NULL for xTask sets the criticality of the calling task.  The
+ * structure must remain valid while it is set, and is removed automatically
+ * when the task is deleted.
+ *
+ * eTaskGetCriticalityMode() returns the current mode.
+ * vTaskGetCriticalityStats() copies the statistics of the system.
+ *
+ * \defgroup vTaskSetCriticality vTaskSetCriticality
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_MIXED_CRITICALITY == 1 )
+    void vTaskSetCriticality( TaskHandle_t xTask,
+                              Criticality_t * pxCriticality,
+                              eCriticalityLevel eLevel,
+                              configRUN_TIME_COUNTER_TYPE ulLowBudget,
+                              configRUN_TIME_COUNTER_TYPE ulHighBudget,
+                              eCriticalityAction eAction,
+                              UBaseType_t uxDegradedPriority ) PRIVILEGED_FUNCTION;
+    eCriticalityLevel eTaskGetCriticalityMode( void ) PRIVILEGED_FUNCTION;
+    void vTaskGetCriticalityStats( CriticalityStats_t * pxStats ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetExecutionBudget( TaskHandle_t xTask, ExecutionBudget_t * pxBudget, configRUN_TIME_COUNTER_TYPE ulBudget, configRUN_TIME_COUNTER_TYPE ulPeriod, eBudgetAction eAction, UBaseType_t uxDemotedPriority );
+ * void vTaskGetExecutionBudgetStats( TaskHandle_t xTask, ExecutionBudgetStats_t * pxStats );
+ * @endcode
+ *
+ * configUSE_EXECUTION_BUDGETS must be defined as 1 for these functions to be
+ * available.
+ *
+ * vTaskSetExecutionBudget() limits xTask to ulBudget of execution time in
+ * every ulPeriod, both in run time counter units.  The budget is replenished in
+ * full at the start of each period, and unused budget is not carried over.
+ * Once the task uses up its budget the overrun is counted, and
+ * vApplicationBudgetOverrunHook() is called if configUSE_BUDGET_OVERRUN_HOOK is
+ * 1.  Then the task either carries on (eBudgetNotify), drops to
+ * uxDemotedPriority (eBudgetDemote) or is suspended (eBudgetSuspend, which
+ * needs INCLUDE_vTaskSuspend) until the next replenishment.  A task suspended
+ * while it was blocked returns from the blocking call as if it had timed out
+ * once it is resumed.  If the application suspends or resumes the task itself
+ * in the meantime, the replenishment leaves it in that state.
+ *
+ * If the port provides an execution timer the budget is enforced as soon as it
+ * is used up, otherwise it is checked at every context switch and on every
+ * tick.  Replenishments are applied from the tick.  The priority of a demoted
+ * task must not be changed with vTaskPrioritySet().  Passing NULL for pxBudget
+ * removes the budget of the task, undoing its action if it was applied.
+ * Passing NULL for xTask sets the budget of the calling task.  The structure
+ * must remain valid while it is set, and is removed automatically when the
+ * task is deleted.
+ *
+ * vTaskGetExecutionBudgetStats() copies the statistics of xTask, or zeros if
+ * it has no budget.
+ *
+ * \defgroup vTaskSetExecutionBudget vTaskSetExecutionBudget
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+    void vTaskSetExecutionBudget( TaskHandle_t xTask,
+                                  ExecutionBudget_t * pxBudget,
+                                  configRUN_TIME_COUNTER_TYPE ulBudget,
+                                  configRUN_TIME_COUNTER_TYPE ulPeriod,
+                                  eBudgetAction eAction,
+                                  UBaseType_t uxDemotedPriority ) PRIVILEGED_FUNCTION;
+    void vTaskGetExecutionBudgetStats( TaskHandle_t xTask,
+                                       ExecutionBudgetStats_t * pxStats ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupInit( TaskGroup_t * pxGroup, configRUN_TIME_COUNTER_TYPE ulBudget, configRUN_TIME_COUNTER_TYPE ulPeriod );
+ * void vTaskSetTaskGroup( TaskHandle_t xTask, TaskGroup_t * pxGroup );
+ * void vTaskGetTaskGroupStats( const TaskGroup_t * pxGroup, TaskGroupStats_t * pxStats );
+ * @endcode
+ *
+ * configUSE_TASK_GROUPS must be defined as 1 for these functions to be
+ * available.
+ *
+ * A task group is a partition that gets a CPU reservation of ulBudget of
+ * execution time in every ulPeriod, both in run time counter units, shared by
+ * all its members.  The budget is replenished in full at the start of each
+ * period and unused budget is not carried over.  Once the members have used
+ * up the budget they are held, and do not run again until the next
+ * replenishment even if they become ready.  A held task is still reported as
+ * Ready.  Within a group tasks are scheduled by their priorities as usual, so
+ * giving each group its own band of priorities schedules the groups by fixed
+ * priority at the top level.  Budgets are checked at every context switch and
+ * on every tick, and replenishments are applied from the tick.
+ *
+ * A mutex held by a member of a group is not released while the group is
+ * held, so a mutex shared between groups can block a task of another group
+ * until the next replenishment.
+ *
+ * vTaskGroupInit() initialises pxGroup and starts its first period.  Groups
+ * cannot be removed, so pxGroup must remain valid for as long as the
+ * scheduler runs, and must not be initialised again.
+ *
+ * vTaskSetTaskGroup() moves xTask into pxGroup, or out of its group if pxGroup
+ * is NULL.  Passing NULL for xTask moves the calling task.  A task is removed
+ * from its group automatically when it is deleted.
+ *
+ * vTaskGetTaskGroupStats() copies the statistics of pxGroup.
+ *
+ * \defgroup vTaskGroupInit vTaskGroupInit
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_GROUPS == 1 )
+    void vTaskGroupInit( TaskGroup_t * pxGroup,
+                         configRUN_TIME_COUNTER_TYPE ulBudget,
+                         configRUN_TIME_COUNTER_TYPE ulPeriod ) PRIVILEGED_FUNCTION;
+    void vTaskSetTaskGroup( TaskHandle_t xTask,
+                            TaskGroup_t * pxGroup ) PRIVILEGED_FUNCTION;
+    void vTaskGetTaskGroupStats( const TaskGroup_t * pxGroup,
+                                 TaskGroupStats_t * pxStats ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskStartTimeTriggered( const TimeTriggeredTable_t * pxTable, TaskHandle_t const * pxTasks, UBaseType_t uxTasks );
+ * void vTaskStopTimeTriggered( void );
+ * void vTaskWaitForTableRelease( void );
+ * void vTaskGetTimeTriggeredStats( TimeTriggeredStats_t * pxStats );
+ * @endcode
+ *
+ * configUSE_TIME_TRIGGERED must be defined as 1 for these functions to be
+ * available.
+ *
+ * xTaskStartTimeTriggered() starts dispatching pxTable, a static cyclic
+ * schedule of releases, from the tick.  The first hyperperiod starts with the
+ * next tick, and the table repeats every xHyperperiod ticks.  Each entry
+ * releases pxTasks[ uxTask ], uxTasks being the length of pxTasks.  Returns
+ * pdFAIL, and changes nothing, if the table is not sorted or refers to a task
+ * that is not in pxTasks.  The table and the array must remain valid until
+ * vTaskStopTimeTriggered() is called, and the tasks must not be deleted.
+ *
+ * A time triggered task runs one job per release, and calls
+ * vTaskWaitForTableRelease() when the job is complete to wait in the Suspended
+ * state for its next release.  Dispatching only looks at the entries due on
+ * the current tick, so it takes constant time.  A release of a task that is
+ * not waiting, because its previous job overran or it is blocked on something
+ * else, is counted as missed and is not carried over.  A waiting task must not
+ * be suspended or resumed by the application.
+ *
+ * Time triggered tasks should have higher priorities than all the event
+ * triggered tasks, which then run in the slack left by the table, so that
+ * a released task starts running on the tick that released it.
+ *
+ * vTaskStopTimeTriggered() stops dispatching the table.  The tasks waiting in
+ * vTaskWaitForTableRelease() return from it, and later calls return at once,
+ * until a table is started again.
+ *
+ * vTaskGetTimeTriggeredStats() copies the statistics since the table was
+ * started.
+ *
+ * \defgroup xTaskStartTimeTriggered xTaskStartTimeTriggered
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TIME_TRIGGERED == 1 )
+    BaseType_t xTaskStartTimeTriggered( const TimeTriggeredTable_t * pxTable,
+                                        TaskHandle_t const * pxTasks,
+                                        UBaseType_t uxTasks ) PRIVILEGED_FUNCTION;
+    void vTaskStopTimeTriggered( void ) PRIVILEGED_FUNCTION;
+    void vTaskWaitForTableRelease( void ) PRIVILEGED_FUNCTION;
+    void vTaskGetTimeTriggeredStats( TimeTriggeredStats_t * pxStats ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetIdleStates( const IdleState_t * pxStates, UBaseType_t uxStates );
+ * void vTaskSetIdleGovernor( IdleGovernorFunction_t pxGovernor );
+ * void vTaskSetWakeLatency( TaskHandle_t xTask, configRUN_TIME_COUNTER_TYPE ulLatency );
+ * void vTaskGetIdleStateStats( BaseType_t xCoreID, UBaseType_t uxState, IdleStateStats_t * pxStats );
+ * @endcode
+ *
+ * configUSE_IDLE_GOVERNOR must be defined as 1 for these functions to be
+ * available.
+ *
+ * Each time round its loop the idle task of a core with nothing else to run
+ * asks the governor which idle state to enter, and stays in it until an
+ * interrupt is pending.  This includes the passive idle tasks, so a core with
+ * no work is parked in a low power state rather than spinning.
+ *
+ * vTaskSetIdleStates() sets the idle states, ordered from the shallowest to
+ * the deepest, and clears their statistics.  The first state must be cheap
+ * enough to enter every time, usually a plain wait for interrupt.  pxStates
+ * must remain valid while the scheduler runs, and must be set before the
+ * scheduler is started.  If it is not, the states of the port are used, if it
+ * provides any.
+ *
+ * vTaskSetIdleGovernor() replaces the governor, or restores the default one
+ * if pxGovernor is NULL.  The default governor picks the deepest state whose
+ * target residency is no longer than the expected idle time and whose exit
+ * latency is no longer than the latency limit.
+ *
+ * vTaskSetWakeLatency() declares the longest time, in run time counter units,
+ * that xTask can wait for a core to wake from an idle state, or removes the
+ * constraint if ulLatency is 0.  Passing NULL for xTask sets the latency of
+ * the calling task.  The latency limit passed to the governor is the shortest
+ * one set by any task.
+ *
+ * vTaskGetIdleStateStats() copies the residency of state uxState on core
+ * xCoreID.
+ *
+ * \defgroup vTaskSetIdleStates vTaskSetIdleStates
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_IDLE_GOVERNOR == 1 )
+    void vTaskSetIdleStates( const IdleState_t * pxStates,
+                             UBaseType_t uxStates ) PRIVILEGED_FUNCTION;
+    void vTaskSetIdleGovernor( IdleGovernorFunction_t pxGovernor ) PRIVILEGED_FUNCTION;
+    void vTaskSetWakeLatency( TaskHandle_t xTask,
+                              configRUN_TIME_COUNTER_TYPE ulLatency ) PRIVILEGED_FUNCTION;
+    void vTaskGetIdleStateStats( BaseType_t xCoreID,
+                                 UBaseType_t uxState,
+                                 IdleStateStats_t * pxStats ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetJobMonitor( TaskHandle_t xTask, JobMonitor_t * pxMonitor, TickType_t xRelativeDeadline );
+ * void vTaskJobBegin( void );
+ * void vTaskJobComplete( void );
+ * void vTaskGetJobStats( TaskHandle_t xTask, JobStats_t * pxStats );
+ * @endcode
+ *
+ * configUSE_JOB_MONITOR must be defined as 1 for these functions to be
+ * available.
+ *
+ * vTaskSetJobMonitor() attaches pxMonitor to xTask, or detaches the monitor if
+ * pxMonitor is NULL.  The monitor is cleared and must remain valid while it is
+ * attached.  Passing NULL for xTask attaches the monitor to the calling task.
+ * xRelativeDeadline is the time after its release by which a job must
+ * complete, or 0 to use the period of a task that calls xTaskDelayUntil().
+ *
+ * A periodic task needs no other calls: each call to xTaskDelayUntil()
+ * completes the current job, and the next job is released at the wake time
+ * passed to xTaskDelayUntil().  An event driven task calls vTaskJobBegin()
+ * after the event that starts a job has been received, and vTaskJobComplete()
+ * when the job is done.  Its job is released when the task is made ready, or
+ * by vTaskJobBegin() if the task did not block.
+ *
+ * For each task the monitor records the response time (release to
+ * completion), the release jitter (release to first execution), the worst case
+ * observed execution time and the number of deadline misses.  Deadlines are
+ * checked at tick resolution.  If configUSE_DEADLINE_MISS_HOOK is 1,
+ * vApplicationDeadlineMissHook() is called by the task that missed its
+ * deadline, from the call that completed the job.
+ *
+ * vTaskGetJobStats() copies the statistics of xTask, or zeroes *pxStats if the
+ * task has no monitor.
+ *
+ * \defgroup vTaskSetJobMonitor vTaskSetJobMonitor
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_JOB_MONITOR == 1 )
+    void vTaskSetJobMonitor( TaskHandle_t xTask,
+                             JobMonitor_t * pxMonitor,
+                             TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+    void vTaskJobBegin( void ) PRIVILEGED_FUNCTION;
+    void vTaskJobComplete( void ) PRIVILEGED_FUNCTION;
+    void vTaskGetJobStats( TaskHandle_t xTask,
+                           JobStats_t * pxStats ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -3595,6 +4577,20 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
     portDONT_DISCARD void vTaskSwitchContext( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
 #endif
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
+ * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
+ * AN INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Called from the interrupt of the execution timer started with
+ * portEXECUTION_TIMER_START().  Charges the task running on the calling core
+ * and enforces its execution budget if it has used it up.  Returns pdTRUE if
+ * a context switch is required.
+ */
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+    BaseType_t xTaskExecutionTimerExpired( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
  * THE EVENT BITS MODULE.
@@ -0,0 +1,464 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * In-kernel binary trace recorder.
+ *
+ * When configUSE_TRACE_RECORDER is set to 1 this header is included by
+ * FreeRTOS.h before the default (empty) trace macros are defined, and maps a
+ * subset of the trace macros onto calls that append fixed size 16 byte records
+ * to a per-core ring buffer.  Each core only ever writes to its own buffer, so
+ * the writer only has to mask interrupts on the local core for the few
+ * instructions it takes to fill in a record - no spin lock is needed even when
+ * configNUMBER_OF_CORES > 1.
+ *
+ * Records are removed from the ring buffers by xTraceRecorderRead(), which is
+ * intended to be called from a single low priority task that forwards the data
+ * over a UART, USB or any other channel.  The buffers can also be read directly
+ * over SWD.  trace_decode.py in the root of the repository converts the
+ * captured records into a timeline.
+ *
+ * Any trace macro that is already defined by the application (for example in
+ * FreeRTOSConfig.h) is left untouched.
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include trace_recorder.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* The port must provide a free running 32-bit time stamp. */
+#ifndef portTRACE_RECORDER_TIMESTAMP
+    #error portTRACE_RECORDER_TIMESTAMP() must be defined in portmacro.h when configUSE_TRACE_RECORDER is set to 1.
+#endif
+
+#ifndef portTRACE_RECORDER_TIMESTAMP_HZ
+    #error portTRACE_RECORDER_TIMESTAMP_HZ must be defined in portmacro.h when configUSE_TRACE_RECORDER is set to 1.
+#endif
+
+/* Used to identify the interrupt in ISR enter records.  Optional. */
+#ifndef portTRACE_RECORDER_ISR_NUMBER
+    #define portTRACE_RECORDER_ISR_NUMBER()    0U
+#endif
+
+/* Number of records held by the ring buffer of each core.  Must be a power of
+ * two. */
+#ifndef configTRACE_RECORDER_BUFFER_LENGTH
+    #define configTRACE_RECORDER_BUFFER_LENGTH    512U
+#endif
+
+#if ( ( configTRACE_RECORDER_BUFFER_LENGTH & ( configTRACE_RECORDER_BUFFER_LENGTH - 1U ) ) != 0U )
+    #error configTRACE_RECORDER_BUFFER_LENGTH must be a power of two.
+#endif
+
+/* Recording every tick interrupt quickly fills the buffers, so it is optional. */
+#ifndef configTRACE_RECORDER_TICK_EVENTS
+    #define configTRACE_RECORDER_TICK_EVENTS    0
+#endif
+
+/* The port traces every tick interrupt entry and exit as well, set to 0 to
+ * leave ISR records out when the buffers are drained over a slow link. */
+#ifndef configTRACE_RECORDER_ISR_EVENTS
+    #define configTRACE_RECORDER_ISR_EVENTS    1
+#endif
+
+/* Version of the record layout.  Bump if the layout or event numbering
+ * changes in a way the host decoder has to know about. */
+#define trcFORMAT_VERSION    1U
+
+/* Event identifiers.  These are part of the binary format, so existing values
+ * must never be reused. */
+#define trcEVENT_TRACE_START                   0x01U /* usParam = format version, ulValue = time stamp frequency in Hz. */
+#define trcEVENT_OBJECT_NAME                   0x02U /* usParam = chunk index, ulValue = four characters of the name. */
+#define trcEVENT_USER                          0x03U /* usParam = application channel, ulValue = application value. */
+#define trcEVENT_TICK_RATE                     0x04U /* ulValue = configTICK_RATE_HZ. */
+
+#define trcEVENT_TASK_SWITCHED_IN              0x10U /* usParam = priority. */
+#define trcEVENT_TASK_READY                    0x11U /* usParam = priority. */
+#define trcEVENT_TASK_CREATE                   0x12U /* usParam = priority. */
+#define trcEVENT_TASK_DELETE                   0x13U
+#define trcEVENT_TASK_DELAY                    0x14U /* ulValue = ticks to delay. */
+#define trcEVENT_TASK_DELAY_UNTIL              0x15U /* ulValue = wake time in ticks. */
+#define trcEVENT_TASK_PRIORITY_SET             0x16U /* usParam = new priority. */
+#define trcEVENT_TASK_SUSPEND                  0x17U
+#define trcEVENT_TASK_RESUME                   0x18U
+#define trcEVENT_TASK_RESUME_FROM_ISR          0x19U
+#define trcEVENT_TASK_PRIORITY_INHERIT         0x1AU /* usParam = inherited priority. */
+#define trcEVENT_TASK_PRIORITY_DISINHERIT      0x1BU /* usParam = restored priority. */
+#define trcEVENT_TASK_INCREMENT_TICK           0x1CU /* ulValue = tick count. */
+#define trcEVENT_TASK_SWITCHED_OUT             0x1DU /* usParam = one of the trcSWITCHED_OUT_ values. */
+#define trcEVENT_TASK_DEADLINE                 0x1EU /* ulValue = relative deadline in ticks. */
+#define trcEVENT_TASK_MIGRATE                  0x1FU /* usParam = core the task last ran on. */
+
+/* Why a task stopped running, recorded with trcEVENT_TASK_SWITCHED_OUT.  A task
+ * that is still in its ready list was preempted or yielded, anything else means
+ * the current job of the task has finished and it is waiting for the next one. */
+#define trcSWITCHED_OUT_READY                  0U
+#define trcSWITCHED_OUT_BLOCKED                1U
+
+#define trcEVENT_QUEUE_CREATE                  0x20U /* ulValue = queue length. */
+#define trcEVENT_MUTEX_CREATE                  0x21U
+#define trcEVENT_QUEUE_DELETE                  0x22U
+#define trcEVENT_QUEUE_SEND                    0x23U /* ulValue = items in the queue before the send. */
+#define trcEVENT_QUEUE_SEND_FAILED             0x24U
+#define trcEVENT_QUEUE_SEND_FROM_ISR           0x25U
+#define trcEVENT_QUEUE_RECEIVE                 0x26U /* ulValue = items in the queue before the receive. */
+#define trcEVENT_QUEUE_RECEIVE_FAILED          0x27U
+#define trcEVENT_QUEUE_RECEIVE_FROM_ISR        0x28U
+#define trcEVENT_QUEUE_BLOCK_ON_SEND           0x29U
+#define trcEVENT_QUEUE_BLOCK_ON_RECEIVE        0x2AU
+#define trcEVENT_QUEUE_BLOCK_ON_PEEK           0x2BU
+
+#define trcEVENT_TASK_NOTIFY                   0x30U /* usParam = notification index. */
+#define trcEVENT_TASK_NOTIFY_FROM_ISR          0x31U /* usParam = notification index. */
+#define trcEVENT_TASK_NOTIFY_TAKE_BLOCK        0x32U /* usParam = notification index. */
+#define trcEVENT_TASK_NOTIFY_TAKE              0x33U /* usParam = notification index. */
+#define trcEVENT_TASK_NOTIFY_WAIT_BLOCK        0x34U /* usParam = notification index. */
+#define trcEVENT_TASK_NOTIFY_WAIT              0x35U /* usParam = notification index. */
+
+#define trcEVENT_ISR_ENTER                     0x40U /* usParam = exception number. */
+#define trcEVENT_ISR_EXIT                      0x41U
+#define trcEVENT_ISR_EXIT_TO_SCHEDULER         0x42U
+
+#define trcEVENT_YIELD_CORE                    0x50U /* usParam = core asked to reschedule. */
+#define trcEVENT_YIELD_CORE_RECEIVED           0x51U /* usParam = 1 if the same task kept running, ulValue = latency in portSMP_STATS_TIMESTAMP() units. */
+
+/*
+ * One trace record.  The layout is little endian and exactly 16 bytes so the
+ * host decoder can read the stream without any framing.
+ */
+typedef struct xTRACE_EVENT
+{
+    uint32_t ulTimestamp; /* portTRACE_RECORDER_TIMESTAMP() when the event was recorded. */
+    uint8_t ucEvent;      /* One of the trcEVENT_ values. */
+    uint8_t ucCore;       /* Core on which the event was recorded. */
+    uint16_t usParam;     /* Event specific, see the trcEVENT_ definitions. */
+    uint32_t ulObject;    /* Handle of the task, queue, etc. the event relates to. */
+    uint32_t ulValue;     /* Event specific, see the trcEVENT_ definitions. */
+} TraceEvent_t;
+
+/*
+ * Enable recording on all cores and write a trcEVENT_TRACE_START record that
+ * carries the format version and the time stamp frequency.  Recording is
+ * disabled until this function is called, so call it before creating any
+ * tasks if the decoder should be able to name them.
+ */
+void vTraceRecorderStart( void );
+
+/*
+ * Disable recording on all cores.  Records already in the buffers are kept
+ * and can still be read with xTraceRecorderRead().
+ */
+void vTraceRecorderStop( void );
+
+/*
+ * Append a record to the ring buffer of the calling core.  Can be called from
+ * tasks and interrupts.  If the buffer is full the record is dropped and the
+ * drop counter of the core is incremented.  Normally only called through the
+ * trace macros.
+ */
+void vTraceRecorderWrite( uint8_t ucEvent,
+                          uint16_t usParam,
+                          uint32_t ulObject,
+                          uint32_t ulValue );
+
+/*
+ * Write the name of an object as a sequence of trcEVENT_OBJECT_NAME records,
+ * four characters per record.
+ */
+void vTraceRecorderWriteName( uint32_t ulObject,
+                              const char * pcName );
+
+/*
+ * Record an application defined event.  usChannel and ulValue are not
+ * interpreted by the kernel.
+ */
+void vTraceRecorderUserEvent( uint16_t usChannel,
+                              uint32_t ulValue );
+
+/* task.h is not included yet, so TaskHandle_t cannot be used here. */
+struct tskTaskControlBlock;
+
+/*
+ * Record the relative deadline of a task, in ticks, so the host tools can
+ * flag deadline misses.  A job is released when the task becomes ready and
+ * finishes when it next blocks.  Pass NULL for xTask to use the calling task.
+ * If no deadline is recorded for a task that uses xTaskDelayUntil() the host
+ * tools assume an implicit deadline equal to its period.
+ */
+void vTraceRecorderSetDeadline( struct tskTaskControlBlock * xTask,
+                                TickType_t xRelativeDeadline );
+
+/*
+ * Move up to xMaxEvents records out of the ring buffer of core xCoreID and
+ * into pxEvents, oldest first.  Returns the number of records copied.  There
+ * must only be one reader of each buffer at a time.
+ */
+size_t xTraceRecorderRead( BaseType_t xCoreID,
+                           TraceEvent_t * pxEvents,
+                           size_t xMaxEvents );
+
+/*
+ * Returns the number of records that were dropped on core xCoreID because its
+ * ring buffer was full.
+ */
+uint32_t ulTraceRecorderGetDropped( BaseType_t xCoreID );
+
+/*-----------------------------------------------------------*/
+
+#define trcHANDLE( x )    ( ( uint32_t ) ( portPOINTER_SIZE_TYPE ) ( x ) )
+
+#ifndef traceTASK_SWITCHED_IN
+    #define traceTASK_SWITCHED_IN() \
+    vTraceRecorderWrite( trcEVENT_TASK_SWITCHED_IN, ( uint16_t ) pxCurrentTCB->uxPriority, trcHANDLE( pxCurrentTCB ), 0U )
+#endif
+
+/* Only expanded in tasks.c.  A task held back by its group, budget or
+ * criticality is still waiting to run, so it is recorded as ready. */
+#ifndef traceTASK_SWITCHED_OUT
+    #define traceTASK_SWITCHED_OUT()                                                                  \
+    vTraceRecorderWrite( trcEVENT_TASK_SWITCHED_OUT,                                                  \
+                         ( ( listLIST_ITEM_CONTAINER( &( pxCurrentTCB->xStateListItem ) ) ==          \
+                             &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) ||                  \
+                           ( taskTASK_IS_THROTTLED( pxCurrentTCB ) ) ) ?                              \
+                         ( uint16_t ) trcSWITCHED_OUT_READY : ( uint16_t ) trcSWITCHED_OUT_BLOCKED,   \
+                         trcHANDLE( pxCurrentTCB ), 0U )
+#endif
+
+#ifndef traceMOVED_TASK_TO_READY_STATE
+    #define traceMOVED_TASK_TO_READY_STATE( pxTCB ) \
+    vTraceRecorderWrite( trcEVENT_TASK_READY, ( uint16_t ) ( pxTCB )->uxPriority, trcHANDLE( pxTCB ), 0U )
+#endif
+
+#ifndef traceTASK_CREATE
+    #define traceTASK_CREATE( pxNewTCB )                                                                                \
+    do {                                                                                                                \
+        vTraceRecorderWrite( trcEVENT_TASK_CREATE, ( uint16_t ) ( pxNewTCB )->uxPriority, trcHANDLE( pxNewTCB ), 0U ); \
+        vTraceRecorderWriteName( trcHANDLE( pxNewTCB ), taskCOLD( pxNewTCB )->pcTaskName );                            \
+    } while( 0 )
+#endif
+
+#ifndef traceTASK_DELETE
+    #define traceTASK_DELETE( pxTaskToDelete ) \
+    vTraceRecorderWrite( trcEVENT_TASK_DELETE, 0U, trcHANDLE( pxTaskToDelete ), 0U )
+#endif
+
+#ifndef traceTASK_DELAY
+    #define traceTASK_DELAY() \
+    vTraceRecorderWrite( trcEVENT_TASK_DELAY, 0U, trcHANDLE( pxCurrentTCB ), ( uint32_t ) xTicksToDelay )
+#endif
+
+#ifndef traceTASK_DELAY_UNTIL
+    #define traceTASK_DELAY_UNTIL( xTimeToWake ) \
+    vTraceRecorderWrite( trcEVENT_TASK_DELAY_UNTIL, 0U, trcHANDLE( pxCurrentTCB ), ( uint32_t ) ( xTimeToWake ) )
+#endif
+
+#ifndef traceTASK_PRIORITY_SET
+    #define traceTASK_PRIORITY_SET( pxTask, uxNewPriority ) \
+    vTraceRecorderWrite( trcEVENT_TASK_PRIORITY_SET, ( uint16_t ) ( uxNewPriority ), trcHANDLE( pxTask ), 0U )
+#endif
+
+#ifndef traceTASK_SUSPEND
+    #define traceTASK_SUSPEND( pxTaskToSuspend ) \
+    vTraceRecorderWrite( trcEVENT_TASK_SUSPEND, 0U, trcHANDLE( pxTaskToSuspend ), 0U )
+#endif
+
+#ifndef traceTASK_RESUME
+    #define traceTASK_RESUME( pxTaskToResume ) \
+    vTraceRecorderWrite( trcEVENT_TASK_RESUME, 0U, trcHANDLE( pxTaskToResume ), 0U )
+#endif
+
+#ifndef traceTASK_RESUME_FROM_ISR
+    #define traceTASK_RESUME_FROM_ISR( pxTaskToResume ) \
+    vTraceRecorderWrite( trcEVENT_TASK_RESUME_FROM_ISR, 0U, trcHANDLE( pxTaskToResume ), 0U )
+#endif
+
+#ifndef traceTASK_PRIORITY_INHERIT
+    #define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority ) \
+    vTraceRecorderWrite( trcEVENT_TASK_PRIORITY_INHERIT, ( uint16_t ) ( uxInheritedPriority ), trcHANDLE( pxTCBOfMutexHolder ), 0U )
+#endif
+
+#ifndef traceTASK_PRIORITY_DISINHERIT
+    #define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority ) \
+    vTraceRecorderWrite( trcEVENT_TASK_PRIORITY_DISINHERIT, ( uint16_t ) ( uxOriginalPriority ), trcHANDLE( pxTCBOfMutexHolder ), 0U )
+#endif
+
+#if ( configTRACE_RECORDER_TICK_EVENTS == 1 )
+    #ifndef traceTASK_INCREMENT_TICK
+        #define traceTASK_INCREMENT_TICK( xTickCount ) \
+    vTraceRecorderWrite( trcEVENT_TASK_INCREMENT_TICK, 0U, 0U, ( uint32_t ) ( xTickCount ) )
+    #endif
+#endif
+
+#ifndef traceQUEUE_CREATE
+    #define traceQUEUE_CREATE( pxNewQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_CREATE, 0U, trcHANDLE( pxNewQueue ), ( uint32_t ) ( pxNewQueue )->uxLength )
+#endif
+
+#ifndef traceCREATE_MUTEX
+    #define traceCREATE_MUTEX( pxNewQueue ) \
+    vTraceRecorderWrite( trcEVENT_MUTEX_CREATE, 0U, trcHANDLE( pxNewQueue ), 0U )
+#endif
+
+#ifndef traceQUEUE_DELETE
+    #define traceQUEUE_DELETE( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_DELETE, 0U, trcHANDLE( pxQueue ), 0U )
+#endif
+
+#ifndef traceQUEUE_SEND
+    #define traceQUEUE_SEND( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_SEND, 0U, trcHANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceQUEUE_SEND_FAILED
+    #define traceQUEUE_SEND_FAILED( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_SEND_FAILED, 0U, trcHANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceQUEUE_SEND_FROM_ISR
+    #define traceQUEUE_SEND_FROM_ISR( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_SEND_FROM_ISR, 0U, trcHANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceQUEUE_RECEIVE
+    #define traceQUEUE_RECEIVE( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_RECEIVE, 0U, trcHANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FAILED
+    #define traceQUEUE_RECEIVE_FAILED( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_RECEIVE_FAILED, 0U, trcHANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FROM_ISR
+    #define traceQUEUE_RECEIVE_FROM_ISR( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_RECEIVE_FROM_ISR, 0U, trcHANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_SEND
+    #define traceBLOCKING_ON_QUEUE_SEND( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_BLOCK_ON_SEND, 0U, trcHANDLE( pxQueue ), 0U )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_RECEIVE
+    #define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_BLOCK_ON_RECEIVE, 0U, trcHANDLE( pxQueue ), 0U )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_PEEK
+    #define traceBLOCKING_ON_QUEUE_PEEK( pxQueue ) \
+    vTraceRecorderWrite( trcEVENT_QUEUE_BLOCK_ON_PEEK, 0U, trcHANDLE( pxQueue ), 0U )
+#endif
+
+#ifndef traceQUEUE_REGISTRY_ADD
+    #define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName ) \
+    vTraceRecorderWriteName( trcHANDLE( xQueue ), ( pcQueueName ) )
+#endif
+
+#ifndef traceTASK_NOTIFY
+    #define traceTASK_NOTIFY( uxIndexToNotify ) \
+    vTraceRecorderWrite( trcEVENT_TASK_NOTIFY, ( uint16_t ) ( uxIndexToNotify ), trcHANDLE( pxTCB ), 0U )
+#endif
+
+#ifndef traceTASK_NOTIFY_FROM_ISR
+    #define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify ) \
+    vTraceRecorderWrite( trcEVENT_TASK_NOTIFY_FROM_ISR, ( uint16_t ) ( uxIndexToNotify ), trcHANDLE( pxTCB ), 0U )
+#endif
+
+#ifndef traceTASK_NOTIFY_GIVE_FROM_ISR
+    #define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify ) \
+    vTraceRecorderWrite( trcEVENT_TASK_NOTIFY_FROM_ISR, ( uint16_t ) ( uxIndexToNotify ), trcHANDLE( pxTCB ), 0U )
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE_BLOCK
+    #define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait ) \
+    vTraceRecorderWrite( trcEVENT_TASK_NOTIFY_TAKE_BLOCK, ( uint16_t ) ( uxIndexToWait ), trcHANDLE( pxCurrentTCB ), 0U )
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE
+    #define traceTASK_NOTIFY_TAKE( uxIndexToWait ) \
+    vTraceRecorderWrite( trcEVENT_TASK_NOTIFY_TAKE, ( uint16_t ) ( uxIndexToWait ), trcHANDLE( pxCurrentTCB ), 0U )
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT_BLOCK
+    #define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait ) \
+    vTraceRecorderWrite( trcEVENT_TASK_NOTIFY_WAIT_BLOCK, ( uint16_t ) ( uxIndexToWait ), trcHANDLE( pxCurrentTCB ), 0U )
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT
+    #define traceTASK_NOTIFY_WAIT( uxIndexToWait ) \
+    vTraceRecorderWrite( trcEVENT_TASK_NOTIFY_WAIT, ( uint16_t ) ( uxIndexToWait ), trcHANDLE( pxCurrentTCB ), 0U )
+#endif
+
+#ifndef traceYIELD_CORE_REQUESTED
+    #define traceYIELD_CORE_REQUESTED( xCoreID ) \
+    vTraceRecorderWrite( trcEVENT_YIELD_CORE, ( uint16_t ) ( xCoreID ), 0U, 0U )
+#endif
+
+#ifndef traceYIELD_CORE_RECEIVED
+    #define traceYIELD_CORE_RECEIVED( xWasted, ulLatency ) \
+    vTraceRecorderWrite( trcEVENT_YIELD_CORE_RECEIVED, ( uint16_t ) ( xWasted ), 0U, ( uint32_t ) ( ulLatency ) )
+#endif
+
+#ifndef traceTASK_MIGRATED
+    #define traceTASK_MIGRATED( pxTCB, xFromCoreID ) \
+    vTraceRecorderWrite( trcEVENT_TASK_MIGRATE, ( uint16_t ) ( xFromCoreID ), trcHANDLE( pxTCB ), 0U )
+#endif
+
+#if ( configTRACE_RECORDER_ISR_EVENTS == 1 )
+    #ifndef traceISR_ENTER
+        #define traceISR_ENTER() \
+    vTraceRecorderWrite( trcEVENT_ISR_ENTER, ( uint16_t ) portTRACE_RECORDER_ISR_NUMBER(), 0U, 0U )
+    #endif
+
+    #ifndef traceISR_EXIT
+        #define traceISR_EXIT() \
+    vTraceRecorderWrite( trcEVENT_ISR_EXIT, 0U, 0U, 0U )
+    #endif
+
+    #ifndef traceISR_EXIT_TO_SCHEDULER
+        #define traceISR_EXIT_TO_SCHEDULER() \
+    vTraceRecorderWrite( trcEVENT_ISR_EXIT_TO_SCHEDULER, 0U, 0U, 0U )
+    #endif
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* TRACE_RECORDER_H */
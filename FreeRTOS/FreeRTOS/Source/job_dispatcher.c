@@ -0,0 +1,403 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the job dispatcher. */
+#if ( configUSE_JOB_DISPATCHER == 1 )
+
+/*
+ * The task of every dispatcher.
+ */
+    static portTASK_FUNCTION_PROTO( prvDispatcherTask, pvParameters );
+
+/*
+ * Add pxJob to the pending list of its dispatcher, or merge ulEvents into it
+ * if it is already there.  Must be called from within a critical section.
+ * Returns pdTRUE if the pending list was empty, in which case the dispatcher
+ * must be notified.
+ */
+    static BaseType_t prvEnqueue( Job_t * pxJob,
+                                  uint32_t ulEvents );
+
+/*
+ * Remove the job at the head of the pending list of pxDispatcher and clear its
+ * events into *pulEvents.  Returns NULL if no job is pending.
+ */
+    static Job_t * prvDequeue( JobDispatcher_t * pxDispatcher,
+                               uint32_t * pulEvents );
+
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvDispatcherTask, pvParameters )
+    {
+        JobDispatcher_t * const pxDispatcher = ( JobDispatcher_t * ) pvParameters;
+        Job_t * pxJob;
+        uint32_t ulEvents;
+
+        for( ; ; )
+        {
+            /* The dispatcher is only notified when a job is posted to an empty
+             * pending list, so everything that is pending is run before
+             * waiting again. */
+            ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+            for( pxJob = prvDequeue( pxDispatcher, &ulEvents ); pxJob != NULL; pxJob = prvDequeue( pxDispatcher, &ulEvents ) )
+            {
+                pxJob->pxFunction( pxJob->pvParameter, ulEvents );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEnqueue( Job_t * pxJob,
+                                  uint32_t ulEvents )
+    {
+        JobDispatcher_t * const pxDispatcher = pxJob->pxDispatcher;
+        BaseType_t xWasEmpty = pdFALSE;
+
+        pxJob->ulEvents |= ulEvents;
+
+        if( pxJob->xPending == pdFALSE )
+        {
+            pxJob->xPending = pdTRUE;
+            pxJob->pxNext = NULL;
+
+            if( pxDispatcher->pxTail == NULL )
+            {
+                pxDispatcher->pxHead = pxJob;
+                xWasEmpty = pdTRUE;
+            }
+            else
+            {
+                pxDispatcher->pxTail->pxNext = pxJob;
+            }
+
+            pxDispatcher->pxTail = pxJob;
+            pxDispatcher->ulPending++;
+
+            if( pxDispatcher->ulPending > pxDispatcher->xStats.ulMaxPending )
+            {
+                pxDispatcher->xStats.ulMaxPending = pxDispatcher->ulPending;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            pxDispatcher->xStats.ulCoalesced++;
+        }
+
+        return xWasEmpty;
+    }
+/*-----------------------------------------------------------*/
+
+    static Job_t * prvDequeue( JobDispatcher_t * pxDispatcher,
+                               uint32_t * pulEvents )
+    {
+        Job_t * pxJob;
+
+        taskENTER_CRITICAL();
+        {
+            pxJob = pxDispatcher->pxHead;
+
+            if( pxJob != NULL )
+            {
+                pxDispatcher->pxHead = pxJob->pxNext;
+
+                if( pxDispatcher->pxHead == NULL )
+                {
+                    pxDispatcher->pxTail = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxDispatcher->ulPending--;
+                pxDispatcher->xStats.ulRun++;
+
+                /* Cleared before the job runs, so a post made while it runs
+                 * runs it again. */
+                *pulEvents = pxJob->ulEvents;
+                pxJob->ulEvents = 0U;
+                pxJob->xPending = pdFALSE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return pxJob;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        BaseType_t xJobDispatcherCreate( JobDispatcher_t * pxDispatcher,
+                                         const char * pcName,
+                                         configSTACK_DEPTH_TYPE uxStackDepth,
+                                         UBaseType_t uxPriority )
+        {
+            TaskHandle_t xTask = NULL;
+            BaseType_t xReturn;
+
+            configASSERT( pxDispatcher != NULL );
+
+            ( void ) memset( pxDispatcher, 0x00, sizeof( JobDispatcher_t ) );
+
+            xReturn = xTaskCreate( prvDispatcherTask, pcName, uxStackDepth, pxDispatcher, uxPriority, &xTask );
+            pxDispatcher->xTask = xTask;
+
+            return xReturn;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        BaseType_t xJobDispatcherCreateStatic( JobDispatcher_t * pxDispatcher,
+                                               const char * pcName,
+                                               configSTACK_DEPTH_TYPE uxStackDepth,
+                                               UBaseType_t uxPriority,
+                                               StackType_t * puxStackBuffer,
+                                               StaticTask_t * pxTaskBuffer )
+        {
+            configASSERT( pxDispatcher != NULL );
+
+            ( void ) memset( pxDispatcher, 0x00, sizeof( JobDispatcher_t ) );
+
+            pxDispatcher->xTask = xTaskCreateStatic( prvDispatcherTask, pcName, uxStackDepth, pxDispatcher, uxPriority, puxStackBuffer, pxTaskBuffer );
+
+            return ( pxDispatcher->xTask != NULL ) ? pdPASS : pdFAIL;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    TaskHandle_t xJobDispatcherGetTaskHandle( const JobDispatcher_t * pxDispatcher )
+    {
+        configASSERT( pxDispatcher != NULL );
+
+        return pxDispatcher->xTask;
+    }
+/*-----------------------------------------------------------*/
+
+    void vJobDispatcherGetStats( JobDispatcher_t * pxDispatcher,
+                                 JobDispatcherStats_t * pxStats )
+    {
+        configASSERT( pxDispatcher != NULL );
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = pxDispatcher->xStats;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vJobInit( Job_t * pxJob,
+                   JobDispatcher_t * pxDispatcher,
+                   JobFunction_t pxFunction,
+                   void * pvParameter )
+    {
+        configASSERT( pxJob != NULL );
+        configASSERT( pxDispatcher != NULL );
+        configASSERT( pxFunction != NULL );
+
+        pxJob->pxFunction = pxFunction;
+        pxJob->pvParameter = pvParameter;
+        pxJob->pxDispatcher = pxDispatcher;
+        pxJob->pxNext = NULL;
+        pxJob->ulEvents = 0U;
+        pxJob->xPending = pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xJobPost( Job_t * pxJob,
+                         uint32_t ulEvents )
+    {
+        BaseType_t xReturn;
+
+        configASSERT( pxJob != NULL );
+        configASSERT( pxJob->pxDispatcher->xTask != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            xReturn = ( pxJob->xPending == pdFALSE ) ? pdTRUE : pdFALSE;
+
+            if( prvEnqueue( pxJob, ulEvents ) != pdFALSE )
+            {
+                /* Safe from within the critical section, any yield is held
+                 * pending until the critical section is exited. */
+                ( void ) xTaskNotifyGive( pxJob->pxDispatcher->xTask );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xJobPostFromISR( Job_t * pxJob,
+                                uint32_t ulEvents,
+                                BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xReturn;
+
+        configASSERT( pxJob != NULL );
+        configASSERT( pxJob->pxDispatcher->xTask != NULL );
+
+        /* See the comment in xQueueGenericSendFromISR(). */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            xReturn = ( pxJob->xPending == pdFALSE ) ? pdTRUE : pdFALSE;
+
+            if( prvEnqueue( pxJob, ulEvents ) != pdFALSE )
+            {
+                vTaskNotifyGiveFromISR( pxJob->pxDispatcher->xTask, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xJobCancel( Job_t * pxJob )
+    {
+        JobDispatcher_t * pxDispatcher;
+        Job_t * pxPrevious = NULL;
+        Job_t * pxIterator;
+        BaseType_t xReturn = pdFALSE;
+
+        configASSERT( pxJob != NULL );
+
+        pxDispatcher = pxJob->pxDispatcher;
+
+        taskENTER_CRITICAL();
+        {
+            if( pxJob->xPending != pdFALSE )
+            {
+                for( pxIterator = pxDispatcher->pxHead; pxIterator != pxJob; pxIterator = pxIterator->pxNext )
+                {
+                    pxPrevious = pxIterator;
+                }
+
+                if( pxPrevious == NULL )
+                {
+                    pxDispatcher->pxHead = pxJob->pxNext;
+                }
+                else
+                {
+                    pxPrevious->pxNext = pxJob->pxNext;
+                }
+
+                if( pxDispatcher->pxTail == pxJob )
+                {
+                    pxDispatcher->pxTail = pxPrevious;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxDispatcher->ulPending--;
+                pxJob->ulEvents = 0U;
+                pxJob->xPending = pdFALSE;
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vJobPostFromQueue( Job_t * pxJob )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        /* The queue is already in a critical section, or has interrupts
+         * masked, so the pending list can be updated directly. */
+        if( prvEnqueue( pxJob, 0U ) != pdFALSE )
+        {
+            if( portCHECK_IF_IN_ISR() )
+            {
+                vTaskNotifyGiveFromISR( pxJob->pxDispatcher->xTask, &xHigherPriorityTaskWoken );
+                portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+            }
+            else
+            {
+                ( void ) xTaskNotifyGive( pxJob->pxDispatcher->xTask );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_JOB_DISPATCHER */
@@ -0,0 +1,277 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the latency histograms. */
+#if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+
+/* Index of the start time and source of the eLatencyInterruptsMasked and
+ * eLatencySchedulerSuspended sections. */
+    #define latencyNUM_SECTION_TYPES    2U
+
+/*
+ * Everything measured on one core.  Each core only ever updates its own
+ * state, with interrupts masked, so no lock is needed.
+ */
+    typedef struct xLATENCY_CORE_STATE
+    {
+        LatencyHistogram_t xHistograms[ latencyNUM_HISTOGRAM_TYPES ];
+        uint32_t ulSectionStart[ latencyNUM_SECTION_TYPES ];
+        uint32_t ulSectionSource[ latencyNUM_SECTION_TYPES ];
+        uint32_t ulISRStart;
+        uint32_t ulISRSource;
+        UBaseType_t uxISRNesting;
+    } LatencyCoreState_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+ * which static variables must be declared volatile. */
+    PRIVILEGED_DATA static LatencyCoreState_t xLatencyCores[ configNUMBER_OF_CORES ];
+/*lint -restore */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Add ulDuration to one histogram of the calling core.  Must be called with
+ * interrupts masked.
+ */
+    static void prvRecordSample( LatencyCoreState_t * pxCore,
+                                 eLatencyHistogramType eType,
+                                 uint32_t ulDuration,
+                                 uint32_t ulSource );
+
+/*-----------------------------------------------------------*/
+
+    static void prvRecordSample( LatencyCoreState_t * pxCore,
+                                 eLatencyHistogramType eType,
+                                 uint32_t ulDuration,
+                                 uint32_t ulSource )
+    {
+        LatencyHistogram_t * pxHistogram = &( pxCore->xHistograms[ eType ] );
+        uint32_t ulValue = ulDuration;
+        UBaseType_t uxBucket = 0U;
+
+        /* The bucket is the number of significant bits in the sample.  The
+         * Cortex-M0+ has no count leading zeros instruction, and this loop is
+         * bounded by the number of buckets. */
+        while( ( ulValue != 0U ) && ( uxBucket < ( ( UBaseType_t ) configLATENCY_HISTOGRAM_BUCKETS - 1U ) ) )
+        {
+            ulValue >>= 1U;
+            uxBucket++;
+        }
+
+        pxHistogram->ulBuckets[ uxBucket ]++;
+        pxHistogram->ulSamples++;
+
+        if( ulDuration > pxHistogram->ulMax )
+        {
+            pxHistogram->ulMax = ulDuration;
+            pxHistogram->ulMaxSource = ulSource;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencyHistogramSectionEnter( eLatencyHistogramType eType,
+                                        uint32_t ulSource )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        LatencyCoreState_t * pxCore;
+
+        configASSERT( ( UBaseType_t ) eType < latencyNUM_SECTION_TYPES );
+
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            pxCore = &( xLatencyCores[ portGET_CORE_ID() ] );
+            pxCore->ulSectionSource[ eType ] = ulSource;
+            pxCore->ulSectionStart[ eType ] = ( uint32_t ) portLATENCY_TIMESTAMP();
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencyHistogramSectionExit( eLatencyHistogramType eType )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        LatencyCoreState_t * pxCore;
+        uint32_t ulNow;
+
+        configASSERT( ( UBaseType_t ) eType < latencyNUM_SECTION_TYPES );
+
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ulNow = ( uint32_t ) portLATENCY_TIMESTAMP();
+            pxCore = &( xLatencyCores[ portGET_CORE_ID() ] );
+            prvRecordSample( pxCore, eType, ulNow - pxCore->ulSectionStart[ eType ], pxCore->ulSectionSource[ eType ] );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencyHistogramISREnter( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        LatencyCoreState_t * pxCore;
+
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            pxCore = &( xLatencyCores[ portGET_CORE_ID() ] );
+
+            if( pxCore->uxISRNesting == 0U )
+            {
+                pxCore->ulISRSource = ( uint32_t ) portLATENCY_ISR_NUMBER();
+                pxCore->ulISRStart = ( uint32_t ) portLATENCY_TIMESTAMP();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxCore->uxISRNesting++;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencyHistogramISRExit( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        LatencyCoreState_t * pxCore;
+
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            pxCore = &( xLatencyCores[ portGET_CORE_ID() ] );
+            configASSERT( pxCore->uxISRNesting > 0U );
+
+            pxCore->uxISRNesting--;
+
+            if( pxCore->uxISRNesting == 0U )
+            {
+                prvRecordSample( pxCore, eLatencyISRDuration, ( uint32_t ) portLATENCY_TIMESTAMP() - pxCore->ulISRStart, pxCore->ulISRSource );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencyHistogramTaskReady( uint32_t * pulWakeStamp )
+    {
+        uint32_t ulNow;
+
+        /* Only wake ups from an instrumented interrupt are measured, and only
+         * the first one if the task is readied again before it runs.  Zero
+         * means no wake up is pending, so a time stamp of zero is moved on by
+         * one tick. */
+        if( ( xLatencyCores[ portGET_CORE_ID() ].uxISRNesting != 0U ) && ( *pulWakeStamp == 0U ) )
+        {
+            ulNow = ( uint32_t ) portLATENCY_TIMESTAMP();
+            *pulWakeStamp = ( ulNow != 0U ) ? ulNow : 1U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencyHistogramTaskSwitchedIn( uint32_t * pulWakeStamp,
+                                          uint32_t ulTask )
+    {
+        /* Called from the context switch, so interrupts are already masked. */
+        if( *pulWakeStamp != 0U )
+        {
+            prvRecordSample( &( xLatencyCores[ portGET_CORE_ID() ] ), eLatencyISRToTask, ( uint32_t ) portLATENCY_TIMESTAMP() - *pulWakeStamp, ulTask );
+            *pulWakeStamp = 0U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencyHistogramGet( BaseType_t xCoreID,
+                               eLatencyHistogramType eType,
+                               LatencyHistogram_t * pxHistogram )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( taskVALID_CORE_ID( xCoreID ) == pdTRUE );
+        configASSERT( ( UBaseType_t ) eType < latencyNUM_HISTOGRAM_TYPES );
+        configASSERT( pxHistogram != NULL );
+
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ( void ) memcpy( pxHistogram, &( xLatencyCores[ xCoreID ].xHistograms[ eType ] ), sizeof( LatencyHistogram_t ) );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vLatencyHistogramReset( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xCoreID;
+
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            /* Only the histograms are cleared, sections and interrupts that
+             * are in progress are still measured when they end. */
+            for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+            {
+                ( void ) memset( xLatencyCores[ xCoreID ].xHistograms, 0x00, sizeof( xLatencyCores[ xCoreID ].xHistograms ) );
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_LATENCY_HISTOGRAMS == 1 */
@@ -42,6 +42,31 @@
  * generate the correct privileged Vs unprivileged linkage and placement. */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if ( configUSE_LIST_TREE_INDEX == 1 )
+
+/*
+ * Red-black tree helpers for indexed lists.  The tree holds the same items as
+ * the linked list, in the same order: items with equal values are placed to
+ * the right, as vListInsert() places them after each other.  Missing children
+ * are NULL, and ppxRoot is NULL for an empty tree.
+ */
+    static void prvTreeRotateLeft( ListItem_t ** ppxRoot,
+                                   ListItem_t * pxItem ) PRIVILEGED_FUNCTION;
+    static void prvTreeRotateRight( ListItem_t ** ppxRoot,
+                                    ListItem_t * pxItem ) PRIVILEGED_FUNCTION;
+    static void prvTreeReplace( ListItem_t ** ppxRoot,
+                                const ListItem_t * pxOld,
+                                ListItem_t * pxNew ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add pxNewListItem to the tree, and return the last item whose value is not
+ * above its value, or NULL if there is none.
+ */
+    static ListItem_t * prvTreeInsert( ListItem_t ** ppxRoot,
+                                       ListItem_t * pxNewListItem ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_LIST_TREE_INDEX */
+
 /*-----------------------------------------------------------
 * PUBLIC LIST API documented in list.h
 *----------------------------------------------------------*/
@@ -77,6 +102,13 @@ void vListInitialise( List_t * const pxList )
 
     pxList->uxNumberOfItems = ( UBaseType_t ) 0U;
 
+    #if ( configUSE_LIST_TREE_INDEX == 1 )
+    {
+        /* Not indexed unless vListInitialiseIndexed() says so. */
+        pxList->pxTreeRoot = NULL;
+    }
+    #endif
+
     /* Write known values into the list if
      * configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
     listSET_LIST_INTEGRITY_CHECK_1_VALUE( pxList );
@@ -86,6 +118,21 @@ void vListInitialise( List_t * const pxList )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_LIST_TREE_INDEX == 1 )
+
+    void vListInitialiseIndexed( List_t * const pxList )
+    {
+        traceENTER_vListInitialiseIndexed( pxList );
+
+        vListInitialise( pxList );
+        pxList->pxTreeRoot = listTREE_EMPTY( pxList );
+
+        traceRETURN_vListInitialiseIndexed();
+    }
+
+#endif /* configUSE_LIST_TREE_INDEX */
+/*-----------------------------------------------------------*/
+
 void vListInitialiseItem( ListItem_t * const pxItem )
 {
     traceENTER_vListInitialiseItem( pxItem );
@@ -115,6 +162,13 @@ void vListInsertEnd( List_t * const pxList,
     listTEST_LIST_INTEGRITY( pxList );
     listTEST_LIST_ITEM_INTEGRITY( pxNewListItem );
 
+    #if ( configUSE_LIST_TREE_INDEX == 1 )
+    {
+        /* An indexed list must stay sorted. */
+        configASSERT( pxList->pxTreeRoot == NULL );
+    }
+    #endif
+
     /* Insert a new list item into pxList, but rather than sort the list,
      * makes the new list item the last item to be removed by a call to
      * listGET_OWNER_OF_NEXT_ENTRY(). */
@@ -158,6 +212,29 @@ void vListInsert( List_t * const pxList,
      * share of the CPU.  However, if the xItemValue is the same as the back marker
      * the iteration loop below will not end.  Therefore the value is checked
      * first, and the algorithm slightly modified if necessary. */
+    #if ( configUSE_LIST_TREE_INDEX == 1 )
+        if( pxList->pxTreeRoot != NULL )
+        {
+            ListItem_t * pxRoot = ( pxList->pxTreeRoot == listTREE_EMPTY( pxList ) ) ? NULL : pxList->pxTreeRoot;
+
+            /* The tree gives the item to insert after, in O(log n) time.  If
+             * there is none, the new item goes to the head of the list. */
+            pxIterator = prvTreeInsert( &pxRoot, pxNewListItem );
+
+            if( pxIterator == NULL )
+            {
+                pxIterator = ( ListItem_t * ) &( pxList->xListEnd );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxList->pxTreeRoot = pxRoot;
+        }
+        else
+    #endif /* configUSE_LIST_TREE_INDEX */
+
     if( xValueOfInsertion == portMAX_DELAY )
     {
         pxIterator = pxList->xListEnd.pxPrevious;
@@ -224,6 +301,7 @@ UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
 
     pxItemToRemove->pxNext->pxPrevious = pxItemToRemove->pxPrevious;
     pxItemToRemove->pxPrevious->pxNext = pxItemToRemove->pxNext;
+    listTREE_REMOVE( pxList, pxItemToRemove );
 
     /* Only used during decision coverage testing. */
     mtCOVERAGE_TEST_DELAY();
@@ -246,3 +324,368 @@ UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
     return pxList->uxNumberOfItems;
 }
 /*-----------------------------------------------------------*/
+
+#if ( configUSE_LIST_TREE_INDEX == 1 )
+
+    static void prvTreeRotateLeft( ListItem_t ** ppxRoot,
+                                   ListItem_t * pxItem )
+    {
+        ListItem_t * const pxRight = pxItem->pxTreeRight;
+
+        pxItem->pxTreeRight = pxRight->pxTreeLeft;
+
+        if( pxRight->pxTreeLeft != NULL )
+        {
+            pxRight->pxTreeLeft->pxTreeParent = pxItem;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvTreeReplace( ppxRoot, pxItem, pxRight );
+        pxRight->pxTreeLeft = pxItem;
+        pxItem->pxTreeParent = pxRight;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTreeRotateRight( ListItem_t ** ppxRoot,
+                                    ListItem_t * pxItem )
+    {
+        ListItem_t * const pxLeft = pxItem->pxTreeLeft;
+
+        pxItem->pxTreeLeft = pxLeft->pxTreeRight;
+
+        if( pxLeft->pxTreeRight != NULL )
+        {
+            pxLeft->pxTreeRight->pxTreeParent = pxItem;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvTreeReplace( ppxRoot, pxItem, pxLeft );
+        pxLeft->pxTreeRight = pxItem;
+        pxItem->pxTreeParent = pxLeft;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTreeReplace( ListItem_t ** ppxRoot,
+                                const ListItem_t * pxOld,
+                                ListItem_t * pxNew )
+    {
+        ListItem_t * const pxParent = pxOld->pxTreeParent;
+
+        if( pxParent == NULL )
+        {
+            *ppxRoot = pxNew;
+        }
+        else if( pxParent->pxTreeLeft == pxOld )
+        {
+            pxParent->pxTreeLeft = pxNew;
+        }
+        else
+        {
+            pxParent->pxTreeRight = pxNew;
+        }
+
+        if( pxNew != NULL )
+        {
+            pxNew->pxTreeParent = pxParent;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static ListItem_t * prvTreeInsert( ListItem_t ** ppxRoot,
+                                       ListItem_t * pxNewListItem )
+    {
+        const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
+        ListItem_t * pxParent = NULL;
+        ListItem_t * pxPrevious = NULL;
+        ListItem_t * pxItem = *ppxRoot;
+        ListItem_t * pxGrandparent;
+        ListItem_t * pxUncle;
+
+        /* Find the leaf to add the item to, remembering the last item passed
+         * on its left, which comes before it in the list. */
+        while( pxItem != NULL )
+        {
+            pxParent = pxItem;
+
+            if( xValueOfInsertion < pxItem->xItemValue )
+            {
+                pxItem = pxItem->pxTreeLeft;
+            }
+            else
+            {
+                pxPrevious = pxItem;
+                pxItem = pxItem->pxTreeRight;
+            }
+        }
+
+        pxNewListItem->pxTreeParent = pxParent;
+        pxNewListItem->pxTreeLeft = NULL;
+        pxNewListItem->pxTreeRight = NULL;
+        pxNewListItem->xTreeRed = pdTRUE;
+
+        if( pxParent == NULL )
+        {
+            *ppxRoot = pxNewListItem;
+        }
+        else if( xValueOfInsertion < pxParent->xItemValue )
+        {
+            pxParent->pxTreeLeft = pxNewListItem;
+        }
+        else
+        {
+            pxParent->pxTreeRight = pxNewListItem;
+        }
+
+        /* Restore the red-black properties.  A red parent is never the root,
+         * so it always has a parent. */
+        pxItem = pxNewListItem;
+
+        while( ( pxItem->pxTreeParent != NULL ) && ( pxItem->pxTreeParent->xTreeRed != pdFALSE ) )
+        {
+            pxParent = pxItem->pxTreeParent;
+            pxGrandparent = pxParent->pxTreeParent;
+
+            if( pxParent == pxGrandparent->pxTreeLeft )
+            {
+                pxUncle = pxGrandparent->pxTreeRight;
+
+                if( ( pxUncle != NULL ) && ( pxUncle->xTreeRed != pdFALSE ) )
+                {
+                    pxParent->xTreeRed = pdFALSE;
+                    pxUncle->xTreeRed = pdFALSE;
+                    pxGrandparent->xTreeRed = pdTRUE;
+                    pxItem = pxGrandparent;
+                }
+                else
+                {
+                    if( pxItem == pxParent->pxTreeRight )
+                    {
+                        pxItem = pxParent;
+                        prvTreeRotateLeft( ppxRoot, pxItem );
+                        pxParent = pxItem->pxTreeParent;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxParent->xTreeRed = pdFALSE;
+                    pxGrandparent->xTreeRed = pdTRUE;
+                    prvTreeRotateRight( ppxRoot, pxGrandparent );
+                }
+            }
+            else
+            {
+                pxUncle = pxGrandparent->pxTreeLeft;
+
+                if( ( pxUncle != NULL ) && ( pxUncle->xTreeRed != pdFALSE ) )
+                {
+                    pxParent->xTreeRed = pdFALSE;
+                    pxUncle->xTreeRed = pdFALSE;
+                    pxGrandparent->xTreeRed = pdTRUE;
+                    pxItem = pxGrandparent;
+                }
+                else
+                {
+                    if( pxItem == pxParent->pxTreeLeft )
+                    {
+                        pxItem = pxParent;
+                        prvTreeRotateRight( ppxRoot, pxItem );
+                        pxParent = pxItem->pxTreeParent;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxParent->xTreeRed = pdFALSE;
+                    pxGrandparent->xTreeRed = pdTRUE;
+                    prvTreeRotateLeft( ppxRoot, pxGrandparent );
+                }
+            }
+        }
+
+        ( *ppxRoot )->xTreeRed = pdFALSE;
+
+        return pxPrevious;
+    }
+/*-----------------------------------------------------------*/
+
+    void vListTreeRemove( List_t * const pxList,
+                          ListItem_t * const pxItem )
+    {
+        ListItem_t * pxRoot = pxList->pxTreeRoot;
+        ListItem_t * pxChild;
+        ListItem_t * pxParent;
+        ListItem_t * pxSuccessor;
+        ListItem_t * pxSibling;
+        BaseType_t xRemovedRed = pxItem->xTreeRed;
+
+        /* Unlink the item.  An item with two children is replaced by its
+         * successor, the leftmost item of its right subtree.  pxChild takes
+         * the place of the item unlinked, and may be NULL, so its parent is
+         * tracked apart. */
+        if( pxItem->pxTreeLeft == NULL )
+        {
+            pxChild = pxItem->pxTreeRight;
+            pxParent = pxItem->pxTreeParent;
+            prvTreeReplace( &pxRoot, pxItem, pxChild );
+        }
+        else if( pxItem->pxTreeRight == NULL )
+        {
+            pxChild = pxItem->pxTreeLeft;
+            pxParent = pxItem->pxTreeParent;
+            prvTreeReplace( &pxRoot, pxItem, pxChild );
+        }
+        else
+        {
+            pxSuccessor = pxItem->pxTreeRight;
+
+            while( pxSuccessor->pxTreeLeft != NULL )
+            {
+                pxSuccessor = pxSuccessor->pxTreeLeft;
+            }
+
+            xRemovedRed = pxSuccessor->xTreeRed;
+            pxChild = pxSuccessor->pxTreeRight;
+
+            if( pxSuccessor->pxTreeParent == pxItem )
+            {
+                pxParent = pxSuccessor;
+            }
+            else
+            {
+                pxParent = pxSuccessor->pxTreeParent;
+                prvTreeReplace( &pxRoot, pxSuccessor, pxChild );
+                pxSuccessor->pxTreeRight = pxItem->pxTreeRight;
+                pxSuccessor->pxTreeRight->pxTreeParent = pxSuccessor;
+            }
+
+            prvTreeReplace( &pxRoot, pxItem, pxSuccessor );
+            pxSuccessor->pxTreeLeft = pxItem->pxTreeLeft;
+            pxSuccessor->pxTreeLeft->pxTreeParent = pxSuccessor;
+            pxSuccessor->xTreeRed = pxItem->xTreeRed;
+        }
+
+        /* Removing a black item leaves one path short of a black item.  Move
+         * the deficit up the tree until it can be fixed by recolouring or
+         * rotating.  The sibling of a short path is never NULL. */
+        if( xRemovedRed == pdFALSE )
+        {
+            while( ( pxChild != pxRoot ) && ( ( pxChild == NULL ) || ( pxChild->xTreeRed == pdFALSE ) ) )
+            {
+                if( pxChild == pxParent->pxTreeLeft )
+                {
+                    pxSibling = pxParent->pxTreeRight;
+
+                    if( pxSibling->xTreeRed != pdFALSE )
+                    {
+                        pxSibling->xTreeRed = pdFALSE;
+                        pxParent->xTreeRed = pdTRUE;
+                        prvTreeRotateLeft( &pxRoot, pxParent );
+                        pxSibling = pxParent->pxTreeRight;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( ( ( pxSibling->pxTreeLeft == NULL ) || ( pxSibling->pxTreeLeft->xTreeRed == pdFALSE ) ) &&
+                        ( ( pxSibling->pxTreeRight == NULL ) || ( pxSibling->pxTreeRight->xTreeRed == pdFALSE ) ) )
+                    {
+                        pxSibling->xTreeRed = pdTRUE;
+                        pxChild = pxParent;
+                        pxParent = pxChild->pxTreeParent;
+                    }
+                    else
+                    {
+                        if( ( pxSibling->pxTreeRight == NULL ) || ( pxSibling->pxTreeRight->xTreeRed == pdFALSE ) )
+                        {
+                            pxSibling->pxTreeLeft->xTreeRed = pdFALSE;
+                            pxSibling->xTreeRed = pdTRUE;
+                            prvTreeRotateRight( &pxRoot, pxSibling );
+                            pxSibling = pxParent->pxTreeRight;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        pxSibling->xTreeRed = pxParent->xTreeRed;
+                        pxParent->xTreeRed = pdFALSE;
+                        pxSibling->pxTreeRight->xTreeRed = pdFALSE;
+                        prvTreeRotateLeft( &pxRoot, pxParent );
+                        pxChild = pxRoot;
+                    }
+                }
+                else
+                {
+                    pxSibling = pxParent->pxTreeLeft;
+
+                    if( pxSibling->xTreeRed != pdFALSE )
+                    {
+                        pxSibling->xTreeRed = pdFALSE;
+                        pxParent->xTreeRed = pdTRUE;
+                        prvTreeRotateRight( &pxRoot, pxParent );
+                        pxSibling = pxParent->pxTreeLeft;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( ( ( pxSibling->pxTreeLeft == NULL ) || ( pxSibling->pxTreeLeft->xTreeRed == pdFALSE ) ) &&
+                        ( ( pxSibling->pxTreeRight == NULL ) || ( pxSibling->pxTreeRight->xTreeRed == pdFALSE ) ) )
+                    {
+                        pxSibling->xTreeRed = pdTRUE;
+                        pxChild = pxParent;
+                        pxParent = pxChild->pxTreeParent;
+                    }
+                    else
+                    {
+                        if( ( pxSibling->pxTreeLeft == NULL ) || ( pxSibling->pxTreeLeft->xTreeRed == pdFALSE ) )
+                        {
+                            pxSibling->pxTreeRight->xTreeRed = pdFALSE;
+                            pxSibling->xTreeRed = pdTRUE;
+                            prvTreeRotateLeft( &pxRoot, pxSibling );
+                            pxSibling = pxParent->pxTreeLeft;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        pxSibling->xTreeRed = pxParent->xTreeRed;
+                        pxParent->xTreeRed = pdFALSE;
+                        pxSibling->pxTreeLeft->xTreeRed = pdFALSE;
+                        prvTreeRotateRight( &pxRoot, pxParent );
+                        pxChild = pxRoot;
+                    }
+                }
+            }
+
+            if( pxChild != NULL )
+            {
+                pxChild->xTreeRed = pdFALSE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxList->pxTreeRoot = ( pxRoot == NULL ) ? listTREE_EMPTY( pxList ) : pxRoot;
+    }
+
+#endif /* configUSE_LIST_TREE_INDEX */
+/*-----------------------------------------------------------*/
@@ -0,0 +1,562 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the object metrics. */
+#if ( configUSE_OBJECT_METRICS == 1 )
+
+/* Size of the xObjectMetricsExport() header. */
+    #define objmetricsEXPORT_HEADER_SIZE    12U
+
+/* Longest name written by xObjectMetricsExport(). */
+    #define objmetricsMAX_EXPORT_NAME       ( ( size_t ) configMAX_TASK_NAME_LEN )
+
+/* Bounds of the encoded sizes: a 32-bit varint, and a record made of the
+ * object number, handle, eight counters and the histogram as varints plus
+ * the type, name length and name. */
+    #define objmetricsMAX_VARINT_SIZE       5U
+    #define objmetricsMAX_RECORD_SIZE       ( ( ( 10U + ( size_t ) configOBJECT_METRICS_BUCKETS ) * objmetricsMAX_VARINT_SIZE ) + 2U + objmetricsMAX_EXPORT_NAME )
+
+/*
+ * Position of a walk through the registry that does not hold a critical
+ * section between steps.
+ */
+    typedef struct xOBJECT_METRICS_CURSOR
+    {
+        ObjectMetrics_t * pxNext;  /* The next record to visit. */
+        uint32_t ulGeneration;     /* ulRegistryGeneration when pxNext was read. */
+        uint32_t ulLastVisited;    /* ulObjectNumber of the last record returned, 0 if none. */
+    } ObjectMetricsCursor_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+ * which static variables must be declared volatile. */
+
+/* Every registered object, in ulObjectNumber order.  Only accessed from
+ * critical sections. */
+    PRIVILEGED_DATA static ObjectMetrics_t * pxRegistryHead = NULL;
+    PRIVILEGED_DATA static ObjectMetrics_t * pxRegistryTail = NULL;
+    PRIVILEGED_DATA static uint32_t ulNextObjectNumber = 1U;
+
+/* Changes whenever a record is removed, so a walk knows its position may no
+ * longer be valid. */
+    PRIVILEGED_DATA static uint32_t ulRegistryGeneration = 0U;
+/*lint -restore */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the next record of a registry walk, or NULL once every record has
+ * been visited.  Must be called from a critical section, and the returned
+ * record may only be used until that critical section is exited.
+ */
+    static ObjectMetrics_t * prvRegistryNext( ObjectMetricsCursor_t * pxCursor );
+
+/*
+ * Clear the counters and histogram of one record, keeping its identity.
+ */
+    static void prvClearCounters( ObjectMetrics_t * pxMetrics );
+
+/*
+ * Write ulValue to pucOut as an LEB128 varint and return the number of bytes
+ * written, at most objmetricsMAX_VARINT_SIZE.
+ */
+    static size_t prvEncodeVarint( uint8_t * pucOut,
+                                   uint32_t ulValue );
+
+/*
+ * Encode one export record into pucOut, which must hold at least
+ * objmetricsMAX_RECORD_SIZE bytes, and return its length.
+ */
+    static size_t prvEncodeRecord( const ObjectMetrics_t * pxMetrics,
+                                   uint8_t * pucOut );
+
+/*-----------------------------------------------------------*/
+
+    static ObjectMetrics_t * prvRegistryNext( ObjectMetricsCursor_t * pxCursor )
+    {
+        ObjectMetrics_t * pxMetrics;
+
+        /* On the first step, or if a record has been removed since the last
+         * one and may have taken pxCursor->pxNext with it, start from the head
+         * and skip the records already visited, which have lower numbers. */
+        if( ( pxCursor->ulLastVisited == 0U ) || ( pxCursor->ulGeneration != ulRegistryGeneration ) )
+        {
+            pxCursor->ulGeneration = ulRegistryGeneration;
+            pxCursor->pxNext = pxRegistryHead;
+
+            while( ( pxCursor->pxNext != NULL ) && ( pxCursor->pxNext->ulObjectNumber <= pxCursor->ulLastVisited ) )
+            {
+                pxCursor->pxNext = pxCursor->pxNext->pxNext;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxMetrics = pxCursor->pxNext;
+
+        if( pxMetrics != NULL )
+        {
+            pxCursor->ulLastVisited = pxMetrics->ulObjectNumber;
+            pxCursor->pxNext = pxMetrics->pxNext;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxMetrics;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvClearCounters( ObjectMetrics_t * pxMetrics )
+    {
+        pxMetrics->ulSends = 0U;
+        pxMetrics->ulReceives = 0U;
+        pxMetrics->ulSendTimeouts = 0U;
+        pxMetrics->ulReceiveTimeouts = 0U;
+        pxMetrics->ulPeakLevel = 0U;
+        pxMetrics->ulContentions = 0U;
+        pxMetrics->ulMaxHoldTime = 0U;
+        pxMetrics->ulTotalHoldTime = 0U;
+        ( void ) memset( pxMetrics->ulBlockedTime, 0x00, sizeof( pxMetrics->ulBlockedTime ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvEncodeVarint( uint8_t * pucOut,
+                                   uint32_t ulValue )
+    {
+        size_t xLength = 0U;
+
+        /* Seven bits per byte, least significant first, with the top bit set
+         * on every byte but the last. */
+        while( ulValue >= 0x80U )
+        {
+            pucOut[ xLength ] = ( uint8_t ) ( ( ulValue & 0x7FU ) | 0x80U );
+            xLength++;
+            ulValue >>= 7U;
+        }
+
+        pucOut[ xLength ] = ( uint8_t ) ulValue;
+
+        return xLength + 1U;
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvEncodeRecord( const ObjectMetrics_t * pxMetrics,
+                                   uint8_t * pucOut )
+    {
+        size_t xLength = 0U;
+        size_t xNameLength = 0U;
+        size_t x;
+
+        if( pxMetrics->pcName != NULL )
+        {
+            while( ( xNameLength < objmetricsMAX_EXPORT_NAME ) && ( pxMetrics->pcName[ xNameLength ] != ( char ) 0x00 ) )
+            {
+                xNameLength++;
+            }
+        }
+
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulObjectNumber );
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), ( uint32_t ) ( portPOINTER_SIZE_TYPE ) pxMetrics->pvObject );
+        pucOut[ xLength ] = pxMetrics->ucType;
+        pucOut[ xLength + 1U ] = ( uint8_t ) xNameLength;
+        xLength += 2U;
+
+        for( x = 0U; x < xNameLength; x++ )
+        {
+            pucOut[ xLength ] = ( uint8_t ) pxMetrics->pcName[ x ];
+            xLength++;
+        }
+
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulSends );
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulReceives );
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulSendTimeouts );
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulReceiveTimeouts );
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulPeakLevel );
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulContentions );
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulMaxHoldTime );
+        xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulTotalHoldTime );
+
+        for( x = 0U; x < ( size_t ) configOBJECT_METRICS_BUCKETS; x++ )
+        {
+            xLength += prvEncodeVarint( &( pucOut[ xLength ] ), pxMetrics->ulBlockedTime[ x ] );
+        }
+
+        return xLength;
+    }
+/*-----------------------------------------------------------*/
+
+    void vObjectMetricsRegister( ObjectMetrics_t * pxMetrics,
+                                 const void * pvObject,
+                                 eObjectMetricsType eType,
+                                 const char * pcName )
+    {
+        configASSERT( pxMetrics != NULL );
+
+        /* The object's memory is not necessarily zeroed. */
+        prvClearCounters( pxMetrics );
+        pxMetrics->pxNext = NULL;
+        pxMetrics->pvObject = pvObject;
+        pxMetrics->pcName = pcName;
+        pxMetrics->ucType = ( uint8_t ) eType;
+        pxMetrics->ulHoldStart = 0U;
+
+        taskENTER_CRITICAL();
+        {
+            pxMetrics->ulObjectNumber = ulNextObjectNumber;
+            ulNextObjectNumber++;
+
+            if( pxRegistryTail == NULL )
+            {
+                pxRegistryHead = pxMetrics;
+            }
+            else
+            {
+                pxRegistryTail->pxNext = pxMetrics;
+            }
+
+            pxRegistryTail = pxMetrics;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vObjectMetricsUnregister( ObjectMetrics_t * pxMetrics )
+    {
+        ObjectMetrics_t * pxPrevious = NULL;
+        ObjectMetrics_t * pxIterator;
+
+        taskENTER_CRITICAL();
+        {
+            pxIterator = pxRegistryHead;
+
+            while( ( pxIterator != NULL ) && ( pxIterator != pxMetrics ) )
+            {
+                pxPrevious = pxIterator;
+                pxIterator = pxIterator->pxNext;
+            }
+
+            if( pxIterator != NULL )
+            {
+                if( pxPrevious == NULL )
+                {
+                    pxRegistryHead = pxMetrics->pxNext;
+                }
+                else
+                {
+                    pxPrevious->pxNext = pxMetrics->pxNext;
+                }
+
+                if( pxRegistryTail == pxMetrics )
+                {
+                    pxRegistryTail = pxPrevious;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxMetrics->pxNext = NULL;
+                ulRegistryGeneration++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vObjectMetricsWaitEnd( ObjectMetrics_t * pxMetrics,
+                                uint32_t ulWaitStart,
+                                eObjectMetricsWaitResult eResult )
+    {
+        uint32_t ulValue = ( uint32_t ) portOBJECT_METRICS_TIMESTAMP() - ulWaitStart;
+        UBaseType_t uxBucket = 0U;
+
+        /* The bucket is the number of significant bits in the wait time.  The
+         * Cortex-M0+ has no count leading zeros instruction, and this loop is
+         * bounded by the number of buckets. */
+        while( ( ulValue != 0U ) && ( uxBucket < ( ( UBaseType_t ) configOBJECT_METRICS_BUCKETS - 1U ) ) )
+        {
+            ulValue >>= 1U;
+            uxBucket++;
+        }
+
+        taskENTER_CRITICAL();
+        {
+            pxMetrics->ulBlockedTime[ uxBucket ]++;
+
+            if( eResult == eObjectMetricsSendTimedOut )
+            {
+                pxMetrics->ulSendTimeouts++;
+            }
+            else if( eResult == eObjectMetricsReceiveTimedOut )
+            {
+                pxMetrics->ulReceiveTimeouts++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vObjectMetricsMutexGiven( ObjectMetrics_t * pxMetrics )
+    {
+        uint32_t ulHeld = ( uint32_t ) portOBJECT_METRICS_TIMESTAMP() - pxMetrics->ulHoldStart;
+
+        pxMetrics->ulTotalHoldTime += ulHeld;
+
+        if( ulHeld > pxMetrics->ulMaxHoldTime )
+        {
+            pxMetrics->ulMaxHoldTime = ulHeld;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xObjectMetricsSetName( const void * pvObject,
+                                      const char * pcName )
+    {
+        ObjectMetrics_t * pxIterator;
+        BaseType_t xReturn = pdFAIL;
+
+        taskENTER_CRITICAL();
+        {
+            for( pxIterator = pxRegistryHead; pxIterator != NULL; pxIterator = pxIterator->pxNext )
+            {
+                if( pxIterator->pvObject == pvObject )
+                {
+                    pxIterator->pcName = pcName;
+                    xReturn = pdPASS;
+                    break;
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xObjectMetricsGet( const void * pvObject,
+                                  ObjectMetrics_t * pxMetrics )
+    {
+        ObjectMetrics_t * pxIterator;
+        BaseType_t xReturn = pdFAIL;
+
+        configASSERT( pxMetrics != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            for( pxIterator = pxRegistryHead; pxIterator != NULL; pxIterator = pxIterator->pxNext )
+            {
+                if( pxIterator->pvObject == pvObject )
+                {
+                    ( void ) memcpy( pxMetrics, pxIterator, sizeof( ObjectMetrics_t ) );
+                    pxMetrics->pxNext = NULL;
+                    xReturn = pdPASS;
+                    break;
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxObjectMetricsGetAll( ObjectMetrics_t * const pxMetricsArray,
+                                       const UBaseType_t uxArraySize )
+    {
+        ObjectMetricsCursor_t xCursor = { NULL, 0U, 0U };
+        const ObjectMetrics_t * pxMetrics;
+        UBaseType_t uxCount = 0U;
+        BaseType_t xDone = pdFALSE;
+
+        configASSERT( ( pxMetricsArray != NULL ) || ( uxArraySize == 0U ) );
+
+        while( ( xDone == pdFALSE ) && ( uxCount < uxArraySize ) )
+        {
+            taskENTER_CRITICAL();
+            {
+                pxMetrics = prvRegistryNext( &xCursor );
+
+                if( pxMetrics == NULL )
+                {
+                    xDone = pdTRUE;
+                }
+                else
+                {
+                    ( void ) memcpy( &( pxMetricsArray[ uxCount ] ), pxMetrics, sizeof( ObjectMetrics_t ) );
+                    pxMetricsArray[ uxCount ].pxNext = NULL;
+                    uxCount++;
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        return uxCount;
+    }
+/*-----------------------------------------------------------*/
+
+    void vObjectMetricsReset( void )
+    {
+        ObjectMetricsCursor_t xCursor = { NULL, 0U, 0U };
+        ObjectMetrics_t * pxMetrics;
+
+        do
+        {
+            taskENTER_CRITICAL();
+            {
+                pxMetrics = prvRegistryNext( &xCursor );
+
+                if( pxMetrics != NULL )
+                {
+                    prvClearCounters( pxMetrics );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        } while( pxMetrics != NULL );
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xObjectMetricsExport( uint8_t * pucBuffer,
+                                 size_t xBufferSize )
+    {
+        ObjectMetricsCursor_t xCursor = { NULL, 0U, 0U };
+        ObjectMetrics_t xCopy;
+        const ObjectMetrics_t * pxMetrics;
+        uint8_t ucRecord[ objmetricsMAX_RECORD_SIZE ];
+        size_t xOffset = 0U;
+        size_t xLength;
+        uint32_t ulRecords = 0U;
+        const uint32_t ulHz = ( uint32_t ) portOBJECT_METRICS_TIMESTAMP_HZ;
+
+        configASSERT( ( pucBuffer != NULL ) || ( xBufferSize == 0U ) );
+
+        if( xBufferSize >= ( size_t ) objmetricsEXPORT_HEADER_SIZE )
+        {
+            xOffset = objmetricsEXPORT_HEADER_SIZE;
+
+            /* The header limits the number of records to 65535. */
+            do
+            {
+                /* Copy the record out so it is encoded with interrupts
+                 * enabled. */
+                taskENTER_CRITICAL();
+                {
+                    pxMetrics = prvRegistryNext( &xCursor );
+
+                    if( pxMetrics != NULL )
+                    {
+                        ( void ) memcpy( &xCopy, pxMetrics, sizeof( ObjectMetrics_t ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( pxMetrics != NULL )
+                {
+                    xLength = prvEncodeRecord( &xCopy, ucRecord );
+
+                    if( xLength <= ( xBufferSize - xOffset ) )
+                    {
+                        ( void ) memcpy( &( pucBuffer[ xOffset ] ), ucRecord, xLength );
+                        xOffset += xLength;
+                        ulRecords++;
+                    }
+                    else
+                    {
+                        /* Out of space. */
+                        pxMetrics = NULL;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            } while( ( pxMetrics != NULL ) && ( ulRecords < 0xFFFFU ) );
+
+            pucBuffer[ 0 ] = ( uint8_t ) objmetricsEXPORT_MAGIC;
+            pucBuffer[ 1 ] = ( uint8_t ) ( objmetricsEXPORT_MAGIC >> 8 );
+            pucBuffer[ 2 ] = ( uint8_t ) ( objmetricsEXPORT_MAGIC >> 16 );
+            pucBuffer[ 3 ] = ( uint8_t ) ( objmetricsEXPORT_MAGIC >> 24 );
+            pucBuffer[ 4 ] = ( uint8_t ) objmetricsFORMAT_VERSION;
+            pucBuffer[ 5 ] = ( uint8_t ) configOBJECT_METRICS_BUCKETS;
+            pucBuffer[ 6 ] = ( uint8_t ) ulRecords;
+            pucBuffer[ 7 ] = ( uint8_t ) ( ulRecords >> 8 );
+            pucBuffer[ 8 ] = ( uint8_t ) ulHz;
+            pucBuffer[ 9 ] = ( uint8_t ) ( ulHz >> 8 );
+            pucBuffer[ 10 ] = ( uint8_t ) ( ulHz >> 16 );
+            pucBuffer[ 11 ] = ( uint8_t ) ( ulHz >> 24 );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xOffset;
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_OBJECT_METRICS == 1 */
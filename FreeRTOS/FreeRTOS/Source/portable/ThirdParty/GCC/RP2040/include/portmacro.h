@@ -86,7 +86,9 @@ typedef uint32_t         UBaseType_t;
 /* We have to use PICO_DIVIDER_DISABLE_INTERRUPTS as the source of truth rather than our config,
  * as our FreeRTOSConfig.h header cannot be included by ASM code - which is what this affects in the SDK */
 #define portUSE_DIVIDER_SAVE_RESTORE    !PICO_DIVIDER_DISABLE_INTERRUPTS
-#if portUSE_DIVIDER_SAVE_RESTORE
+#if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+    #define portSTACK_LIMIT_PADDING     19
+#elif portUSE_DIVIDER_SAVE_RESTORE
     #define portSTACK_LIMIT_PADDING     4
 #endif
 
@@ -271,6 +273,106 @@ static inline void vPortRecursiveLock( BaseType_t xCoreID,
 #endif
 /*-----------------------------------------------------------*/
 
+/* Run time stats are counted with the 1 MHz, 64-bit RP2040 timer.  It is
+ * started by the SDK at boot, never wraps in practice and can be read from
+ * either core without a lock. */
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+    #include "hardware/timer.h"
+    #ifndef configRUN_TIME_COUNTER_TYPE
+        #define configRUN_TIME_COUNTER_TYPE    uint64_t
+    #endif
+    #ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+        #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+    #endif
+    #ifndef portGET_RUN_TIME_COUNTER_VALUE
+        #define portGET_RUN_TIME_COUNTER_VALUE()    time_us_64()
+    #endif
+#endif
+/*-----------------------------------------------------------*/
+
+/* Trace recorder time base - the free running 1MHz system timer, which keeps
+ * counting across clock changes and is shared by both cores. */
+#if ( configUSE_TRACE_RECORDER == 1 )
+    #include "hardware/structs/timer.h"
+    #define portTRACE_RECORDER_TIMESTAMP()     ( timer_hw->timerawl )
+    #define portTRACE_RECORDER_TIMESTAMP_HZ    ( 1000000UL )
+    #define portTRACE_RECORDER_ISR_NUMBER()                   \
+    ( {                                                       \
+        uint32_t ulIPSR;                                      \
+        __asm volatile ( "mrs %0, IPSR" : "=r" ( ulIPSR )::); \
+        ( uint8_t ) ulIPSR; } )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Latency histograms use the same 1 MHz time stamp as the trace recorder. */
+#if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+    #include "hardware/structs/timer.h"
+    #define portLATENCY_TIMESTAMP()          ( timer_hw->timerawl )
+    #define portLATENCY_TIMESTAMP_HZ         ( 1000000UL )
+    #define portLATENCY_CALLER_ADDRESS()     ( ( uint32_t ) __builtin_return_address( 0 ) )
+    #define portLATENCY_ISR_NUMBER()                          \
+    ( {                                                       \
+        uint32_t ulIPSR;                                      \
+        __asm volatile ( "mrs %0, IPSR" : "=r" ( ulIPSR )::); \
+        ( uint8_t ) ulIPSR; } )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Blocked and hold times of kernel objects in microseconds rather than ticks. */
+#if ( configUSE_OBJECT_METRICS == 1 )
+    #include "hardware/structs/timer.h"
+    #define portOBJECT_METRICS_TIMESTAMP()       ( timer_hw->timerawl )
+    #define portOBJECT_METRICS_TIMESTAMP_HZ      ( 1000000UL )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Cross-core yield latency in microseconds. */
+#if ( configUSE_SMP_STATS == 1 )
+    #include "hardware/structs/timer.h"
+    #define portSMP_STATS_TIMESTAMP()    ( timer_hw->timerawl )
+#endif
+/*-----------------------------------------------------------*/
+
+/* One shot timer per core for enforcing execution budgets, on a hardware
+ * alarm of the 1 MHz run time counter. */
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+    void vPortExecutionTimerStart( configRUN_TIME_COUNTER_TYPE ulTimeout );
+    void vPortExecutionTimerStop( void );
+    #define portEXECUTION_TIMER_START( ulTimeout )    vPortExecutionTimerStart( ulTimeout )
+    #define portEXECUTION_TIMER_STOP()                vPortExecutionTimerStop()
+#endif
+/*-----------------------------------------------------------*/
+
+/* Wait for interrupt and deep sleep idle states, used unless the application
+ * sets its own. */
+#if ( configUSE_IDLE_GOVERNOR == 1 )
+    void vPortIdleStatesInit( void );
+    #define portIDLE_STATES_INIT()    vPortIdleStatesInit()
+#endif
+/*-----------------------------------------------------------*/
+
+/* Move the MPU stack guard to the task that is about to run. */
+#if ( configUSE_STACK_GUARD_MPU == 1 )
+    void vPortSetStackGuard( const void * pvStackStart );
+    #define portTASK_SWITCH_HOOK( pxTCB )    vPortSetStackGuard( ( pxTCB )->pxStack )
+#endif
+/*-----------------------------------------------------------*/
+
+/* SIO state saved with the context of the tasks that claimed it.  Pass NULL
+ * as xTask to claim it for the calling task. */
+#if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+    #define portSIO_CONTEXT_DIVIDER          ( 1UL << 0UL )
+    #define portSIO_CONTEXT_INTERPOLATORS    ( 1UL << 1UL )
+
+    struct tskTaskControlBlock;
+    void vPortTaskUsesSIOContext( struct tskTaskControlBlock * xTask,
+                                  uint32_t ulContext );
+
+    #define portTASK_USES_DIVIDER()          vPortTaskUsesSIOContext( NULL, portSIO_CONTEXT_DIVIDER )
+    #define portTASK_USES_INTERPOLATORS()    vPortTaskUsesSIOContext( NULL, portSIO_CONTEXT_INTERPOLATORS )
+#endif
+/*-----------------------------------------------------------*/
+
 /* Task function macros as described on the FreeRTOS.org WEB site. */
 #define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
 #define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
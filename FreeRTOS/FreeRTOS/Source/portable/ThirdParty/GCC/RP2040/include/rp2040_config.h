@@ -65,6 +65,57 @@
     #endif
 #endif
 
+/* configUSE_STACK_GUARD_MPU == 1 means the lowest 32 byte aligned block of
+ * the running task's stack is made read only with one MPU region, so a stack
+ * overflow faults at the offending store instead of corrupting memory.  The
+ * region is reprogrammed on every context switch on each core.
+ */
+#ifndef configUSE_STACK_GUARD_MPU
+    #define configUSE_STACK_GUARD_MPU    0
+#endif
+
+/* configSTACK_GUARD_MPU_REGION is the MPU region used for the stack guard */
+#ifndef configSTACK_GUARD_MPU_REGION
+    #define configSTACK_GUARD_MPU_REGION    7
+#endif
+
+/* configUSE_LAZY_SIO_CONTEXT == 1 means the SIO divider and interpolator
+ * state is saved and restored on a context switch only for the tasks that
+ * claimed it with vPortTaskUsesSIOContext(), instead of the divider being
+ * saved for every task and the interpolators for none.  While the SDK
+ * divider routines can be interrupted (PICO_DIVIDER_DISABLE_INTERRUPTS == 0)
+ * every task still starts out owning the divider, as compiler generated
+ * divisions may be preempted anywhere; otherwise only tasks that drive the
+ * divider registers directly need to claim it.  Each task stack carries 19
+ * extra words for the saved state.
+ */
+#ifndef configUSE_LAZY_SIO_CONTEXT
+    #define configUSE_LAZY_SIO_CONTEXT    0
+#endif
+
+/* configIDLE_SLEEP_EN0 and configIDLE_SLEEP_EN1 are written to the SLEEP_EN0
+ * and SLEEP_EN1 registers of the clocks block when configUSE_IDLE_GOVERNOR is
+ * 1, and select the clocks that keep running while both cores are in the deep
+ * sleep idle state.  The processor and timer clocks are always kept.  The
+ * defaults keep every clock running, so only the cores sleep.
+ */
+#ifndef configIDLE_SLEEP_EN0
+    #define configIDLE_SLEEP_EN0    0xffffffffUL
+#endif
+
+#ifndef configIDLE_SLEEP_EN1
+    #define configIDLE_SLEEP_EN1    0xffffffffUL
+#endif
+
+/* configTCB_POOL_ATTRIBUTE places the TCB pool enabled by configTCB_POOL_LENGTH.
+ * The default puts it in SCRATCH_X, the 4K SRAM bank outside the striped main
+ * SRAM, so the scheduler does not contend with task stacks and data for it.
+ * Core 1's boot stack also lives there, which leaves room for about 2K of TCBs.
+ */
+#ifndef configTCB_POOL_ATTRIBUTE
+    #define configTCB_POOL_ATTRIBUTE    __attribute__( ( section( ".scratch_x.tcb_pool" ) ) )
+#endif
+
 #if ( configNUMBER_OF_CORES > 1 )
 
 /* configTICK_CORE indicates which core should handle the SysTick
@@ -13,6 +13,12 @@ target_sources(FreeRTOS-Kernel-Core INTERFACE
         ${FREERTOS_KERNEL_PATH}/stream_buffer.c
         ${FREERTOS_KERNEL_PATH}/tasks.c
         ${FREERTOS_KERNEL_PATH}/timers.c
+        ${FREERTOS_KERNEL_PATH}/trace_recorder.c
+        ${FREERTOS_KERNEL_PATH}/latency_histogram.c
+        ${FREERTOS_KERNEL_PATH}/object_metrics.c
+        ${FREERTOS_KERNEL_PATH}/sampling_profiler.c
+        ${FREERTOS_KERNEL_PATH}/job_dispatcher.c
+        ${FREERTOS_KERNEL_PATH}/admission_control.c
         )
 target_include_directories(FreeRTOS-Kernel-Core INTERFACE ${FREERTOS_KERNEL_PATH}/include)
 
@@ -35,6 +41,7 @@ target_link_libraries(FreeRTOS-Kernel INTERFACE
         pico_base_headers
         hardware_clocks
         hardware_exception
+        hardware_timer
         pico_multicore
 )
 
@@ -64,6 +64,22 @@
 /* Constants required to set up the initial stack. */
 #define portINITIAL_XPSR                      ( 0x01000000 )
 
+/* Constants required to program the ARMv6-M MPU for the stack guard. */
+#define portMPU_CTRL_REG                      ( *( ( volatile uint32_t * ) 0xe000ed94 ) )
+#define portMPU_RNR_REG                       ( *( ( volatile uint32_t * ) 0xe000ed98 ) )
+#define portMPU_RBAR_REG                      ( *( ( volatile uint32_t * ) 0xe000ed9c ) )
+#define portMPU_RASR_REG                      ( *( ( volatile uint32_t * ) 0xe000eda0 ) )
+#define portMPU_CTRL_ENABLE_BIT               ( 1UL << 0UL )
+#define portMPU_CTRL_PRIVDEFENA_BIT           ( 1UL << 2UL )
+#define portMPU_RASR_ENABLE_BIT               ( 1UL << 0UL )
+#define portMPU_RASR_SIZE_256_BYTES           ( 7UL << 1UL )
+#define portMPU_RASR_SRD_POS                  ( 8UL )
+#define portMPU_RASR_NORMAL_MEMORY            ( 7UL << 16UL ) /* Shareable, cacheable, bufferable - as the default SRAM map. */
+#define portMPU_RASR_AP_READ_ONLY             ( 6UL << 24UL )
+#define portMPU_RASR_XN_BIT                   ( 1UL << 28UL )
+#define portMPU_REGION_SIZE                   ( 256UL )
+#define portMPU_SUBREGION_SIZE                ( 32UL )
+
 /* The systick is a 24-bit counter. */
 #define portMAX_24_BIT_NUMBER                 ( 0xffffffUL )
 
@@ -107,6 +123,70 @@ static void vPortStartFirstTask( void ) __attribute__( ( naked ) );
  */
 static void prvTaskExitError( void );
 
+#if ( configUSE_STACK_GUARD_MPU == 1 )
+
+    #if ( INCLUDE_pxTaskGetStackStart != 1 )
+        #error configUSE_STACK_GUARD_MPU requires INCLUDE_pxTaskGetStackStart to be set to 1.
+    #endif
+
+/*
+ * Guard the stack of the first task on this core and enable the MPU.
+ */
+    static void prvStackGuardInit( void );
+#endif
+
+#if ( configUSE_SAMPLING_PROFILER == 1 )
+
+    #if ( configSAMPLING_PROFILER_HZ > 100000U )
+        #error configSAMPLING_PROFILER_HZ must not exceed 100000 on this port.
+    #endif
+
+/*
+ * Sampling interrupt.  The naked handler finds the stack frame saved on
+ * exception entry and passes it to vPortProfilerSample(), which returns
+ * directly from the exception.
+ */
+    static void prvProfilerInterruptHandler( void ) __attribute__( ( naked ) );
+    void vPortProfilerSample( const uint32_t * pulFrame );
+
+/*
+ * Claim a hardware alarm for this core and start sampling.
+ */
+    static void prvProfilerInit( void );
+#endif
+
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+
+/*
+ * Execution timer interrupt, and the hardware alarm for this core that
+ * drives it.
+ */
+    static void prvExecutionTimerInterruptHandler( void );
+    static void prvExecutionTimerInit( void );
+#endif
+
+#if ( configUSE_IDLE_GOVERNOR == 1 )
+
+/*
+ * Idle states entered by the idle tasks.
+ */
+    static TickType_t prvIdleWait( TickType_t xExpectedIdleTime );
+    static TickType_t prvIdleDeepSleep( TickType_t xExpectedIdleTime );
+#endif
+
+#if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+
+/*
+ * The saved SIO context flags of a task that is not running.
+ */
+    static StackType_t * prvSIOContextFlags( TaskHandle_t xTask );
+
+/*
+ * Load the SIO context flags of the first task to run on this core.
+ */
+    static void prvSIOContextInit( void );
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* Each task maintains its own interrupt status in the critical nesting
@@ -162,6 +242,174 @@ UBaseType_t uxCriticalNestings[ configNUMBER_OF_CORES ] = { 0 };
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+
+/* The SIO context flags (portSIO_CONTEXT_ bits) of the task running on each
+ * core.  Saved and restored by xPortPendSVHandler() with the rest of the task
+ * context, so it must not be static. */
+    uint32_t ulPortSIOContext[ configNUMBER_OF_CORES ] = { 0 };
+
+/*
+ * Below the saved r4-r11 of every task xPortPendSVHandler() keeps a fixed
+ * area of portSIO_CONTEXT_WORDS words: the state of both interpolators
+ * (offset 0), the divider (offset 56) and the task's SIO context flags
+ * (offset 72).  Only the flags are written on every context switch, the
+ * hardware state is only copied for a task that owns it.
+ *
+ * Both macros expect r0 to point to the area, r1 to hold the flags and r2 the
+ * SIO base, and use r4-r7.  r2 is left unchanged.
+ */
+    #define portSIO_CONTEXT_WORDS    19U
+
+/* Interruptible SDK divider routines rely on the divider being saved for
+ * every task, as without the lazy context. */
+    #if portUSE_DIVIDER_SAVE_RESTORE
+        #define portSIO_CONTEXT_INITIAL    portSIO_CONTEXT_DIVIDER
+    #else
+        #define portSIO_CONTEXT_INITIAL    0UL
+    #endif
+
+    #define portSAVE_SIO_CONTEXT                                                           \
+    "   str r1, [r0, #72]                   \n"                                            \
+    "   lsrs r4, r1, #1                     \n" /* Divider flag into the carry. */         \
+    "   bcc 1f                              \n"                                            \
+    "   ldr r4, [r2, #0x60]                 \n" /* SIO_DIV_UDIVIDEND_OFFSET */             \
+    "   ldr r5, [r2, #0x64]                 \n" /* SIO_DIV_UDIVISOR_OFFSET */              \
+    "   ldr r6, [r2, #0x74]                 \n" /* SIO_DIV_REMAINDER_OFFSET */             \
+    "   ldr r7, [r2, #0x70]                 \n" /* SIO_DIV_QUOTIENT_OFFSET */              \
+    "   str r4, [r0, #56]                   \n"                                            \
+    "   str r5, [r0, #60]                   \n"                                            \
+    "   str r6, [r0, #64]                   \n"                                            \
+    "   str r7, [r0, #68]                   \n"                                            \
+    "1:                                     \n"                                            \
+    "   lsrs r4, r1, #2                     \n" /* Interpolator flag into the carry. */    \
+    "   bcc 2f                              \n"                                            \
+    "   adds r2, #0x80                      \n" /* SIO_INTERP0_ACCUM0_OFFSET */            \
+    "   ldr r4, [r2, #0x00]                 \n" /* INTERP0 ACCUM0 */                       \
+    "   ldr r5, [r2, #0x04]                 \n" /* INTERP0 ACCUM1 */                       \
+    "   ldr r6, [r2, #0x08]                 \n" /* INTERP0 BASE0 */                        \
+    "   ldr r7, [r2, #0x0c]                 \n" /* INTERP0 BASE1 */                        \
+    "   stmia r0!, {r4-r7}                  \n"                                            \
+    "   ldr r4, [r2, #0x10]                 \n" /* INTERP0 BASE2 */                        \
+    "   ldr r5, [r2, #0x2c]                 \n" /* INTERP0 CTRL_LANE0 */                   \
+    "   ldr r6, [r2, #0x30]                 \n" /* INTERP0 CTRL_LANE1 */                   \
+    "   ldr r7, [r2, #0x40]                 \n" /* INTERP1 ACCUM0 */                       \
+    "   stmia r0!, {r4-r7}                  \n"                                            \
+    "   ldr r4, [r2, #0x44]                 \n" /* INTERP1 ACCUM1 */                       \
+    "   ldr r5, [r2, #0x48]                 \n" /* INTERP1 BASE0 */                        \
+    "   ldr r6, [r2, #0x4c]                 \n" /* INTERP1 BASE1 */                        \
+    "   ldr r7, [r2, #0x50]                 \n" /* INTERP1 BASE2 */                        \
+    "   stmia r0!, {r4-r7}                  \n"                                            \
+    "   ldr r4, [r2, #0x6c]                 \n" /* INTERP1 CTRL_LANE0 */                   \
+    "   ldr r5, [r2, #0x70]                 \n" /* INTERP1 CTRL_LANE1 */                   \
+    "   stmia r0!, {r4, r5}                 \n"                                            \
+    "   subs r2, #0x80                      \n"                                            \
+    "2:                                     \n"
+
+/* Restore in the same order as above, but without moving r0. */
+    #define portRESTORE_SIO_CONTEXT                                                        \
+    "   lsrs r4, r1, #1                     \n"                                            \
+    "   bcc 1f                              \n"                                            \
+    "   ldr r4, [r0, #56]                   \n"                                            \
+    "   ldr r5, [r0, #60]                   \n"                                            \
+    "   ldr r6, [r0, #64]                   \n"                                            \
+    "   ldr r7, [r0, #68]                   \n"                                            \
+    "   str r4, [r2, #0x60]                 \n" /* Dividend and divisor first, see */      \
+    "   str r5, [r2, #0x64]                 \n" /* the non-lazy restore below. */          \
+    "   str r6, [r2, #0x74]                 \n"                                            \
+    "   str r7, [r2, #0x70]                 \n"                                            \
+    "1:                                     \n"                                            \
+    "   lsrs r4, r1, #2                     \n"                                            \
+    "   bcc 2f                              \n"                                            \
+    "   adds r2, #0x80                      \n"                                            \
+    "   ldr r4, [r0, #0]                    \n"                                            \
+    "   ldr r5, [r0, #4]                    \n"                                            \
+    "   ldr r6, [r0, #8]                    \n"                                            \
+    "   ldr r7, [r0, #12]                   \n"                                            \
+    "   str r4, [r2, #0x00]                 \n"                                            \
+    "   str r5, [r2, #0x04]                 \n"                                            \
+    "   str r6, [r2, #0x08]                 \n"                                            \
+    "   str r7, [r2, #0x0c]                 \n"                                            \
+    "   ldr r4, [r0, #16]                   \n"                                            \
+    "   ldr r5, [r0, #20]                   \n"                                            \
+    "   ldr r6, [r0, #24]                   \n"                                            \
+    "   ldr r7, [r0, #28]                   \n"                                            \
+    "   str r4, [r2, #0x10]                 \n"                                            \
+    "   str r5, [r2, #0x2c]                 \n"                                            \
+    "   str r6, [r2, #0x30]                 \n"                                            \
+    "   str r7, [r2, #0x40]                 \n"                                            \
+    "   ldr r4, [r0, #32]                   \n"                                            \
+    "   ldr r5, [r0, #36]                   \n"                                            \
+    "   ldr r6, [r0, #40]                   \n"                                            \
+    "   ldr r7, [r0, #44]                   \n"                                            \
+    "   str r4, [r2, #0x44]                 \n"                                            \
+    "   str r5, [r2, #0x48]                 \n"                                            \
+    "   str r6, [r2, #0x4c]                 \n"                                            \
+    "   str r7, [r2, #0x50]                 \n"                                            \
+    "   ldr r4, [r0, #48]                   \n"                                            \
+    "   ldr r5, [r0, #52]                   \n"                                            \
+    "   str r4, [r2, #0x6c]                 \n"                                            \
+    "   str r5, [r2, #0x70]                 \n"                                            \
+    "   subs r2, #0x80                      \n"                                            \
+    "2:                                     \n"
+#endif /* configUSE_LAZY_SIO_CONTEXT */
+
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SAMPLING_PROFILER == 1 )
+    #include "hardware/irq.h"
+    #include "hardware/timer.h"
+
+/* Each core samples itself with its own hardware alarm, at a rate that is
+ * independent of the tick.  The alarm interrupt is enabled only in the NVIC of
+ * the core that claimed it, so it is always taken on that core. */
+    #define portPROFILER_PERIOD_US       ( 1000000UL / ( uint32_t ) configSAMPLING_PROFILER_HZ )
+    #define portPROFILER_PRIORITY        ( 0U )
+
+/* Words of the exception stack frame. */
+    #define portPROFILER_FRAME_LR        ( 5U )
+    #define portPROFILER_FRAME_PC        ( 6U )
+    #define portPROFILER_FRAME_XPSR      ( 7U )
+    #define portPROFILER_IPSR_MASK       ( 0x3fUL )
+
+    static uint8_t ucProfilerAlarm[ configNUMBER_OF_CORES ];
+    static uint32_t ulProfilerNextSample[ configNUMBER_OF_CORES ];
+#endif /* configUSE_SAMPLING_PROFILER */
+
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+    #include "hardware/irq.h"
+    #include "hardware/timer.h"
+
+/* Like the profiler, each core has its own hardware alarm, which counts the
+ * 1 MHz run time counter, so timeouts are in microseconds.  The alarm only
+ * compares the low 32 bits of the timer, so longer timeouts are cut short and
+ * re-armed by the kernel. */
+    #define portEXECUTION_TIMER_MAX_US    ( 0x7fffffffUL )
+
+    static uint8_t ucExecutionTimerAlarm[ configNUMBER_OF_CORES ];
+#endif /* configUSE_EXECUTION_BUDGETS */
+
+#if ( configUSE_IDLE_GOVERNOR == 1 )
+    #include "hardware/structs/clocks.h"
+    #include "hardware/structs/scb.h"
+
+/* Conservative time for the clocks gated in deep sleep to restart. */
+    #define portIDLE_DEEP_SLEEP_EXIT_LATENCY_US    ( 10UL )
+
+/* A plain wait for interrupt, and deep sleep.  Once both cores are in deep
+ * sleep the clocks left out of configIDLE_SLEEP_EN0 and configIDLE_SLEEP_EN1
+ * are gated until one of them wakes.  Dormant mode is not offered as it stops
+ * the timer that drives the run time counter, and needs a GPIO or RTC wake
+ * source that only the application knows about. */
+    static const IdleState_t xPortIdleStates[] =
+    {
+        { "wfi",   ( TickType_t ) 0, ( configRUN_TIME_COUNTER_TYPE ) 0,                                   prvIdleWait      },
+        { "sleep", ( TickType_t ) 1, ( configRUN_TIME_COUNTER_TYPE ) portIDLE_DEEP_SLEEP_EXIT_LATENCY_US, prvIdleDeepSleep }
+    };
+#endif /* configUSE_IDLE_GOVERNOR */
+
+/*-----------------------------------------------------------*/
+
 #define INVALID_PRIMARY_CORE_NUM    0xffu
 /* The primary core number (the own which has the SysTick handler) */
 static uint8_t ucPrimaryCoreNum = INVALID_PRIMARY_CORE_NUM;
@@ -192,6 +440,21 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
     *pxTopOfStack = ( StackType_t ) pvParameters;            /* R0 */
     pxTopOfStack -= 8;                                       /* R11..R4. */
 
+    #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+    {
+        uint32_t ulWord;
+
+        /* The area starts out clear so a task that claims SIO state before
+         * it first runs starts with the reset state. */
+        for( ulWord = 1U; ulWord <= portSIO_CONTEXT_WORDS; ulWord++ )
+        {
+            *( pxTopOfStack - ulWord ) = 0U;
+        }
+
+        *( pxTopOfStack - 1 ) = portSIO_CONTEXT_INITIAL;
+    }
+    #endif
+
     return pxTopOfStack;
 }
 /*-----------------------------------------------------------*/
@@ -273,6 +536,13 @@ void vPortStartFirstTask( void )
 #if ( LIB_PICO_MULTICORE == 1 ) && ( configSUPPORT_PICO_SYNC_INTEROP == 1 )
     static void prvFIFOInterruptHandler()
     {
+        #if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+            vTaskRunTimeStatsISREnter();
+        #endif
+        #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+            vLatencyHistogramISREnter();
+        #endif
+
         /* We must remove the contents (which we don't care about)
          * to clear the IRQ */
         multicore_fifo_drain();
@@ -291,6 +561,13 @@ void vPortStartFirstTask( void )
             xEventGroupSetBitsFromISR( xEventGroup, ulBits, &xHigherPriorityTaskWoken );
             portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
         #endif /* configNUMBER_OF_CORES != 1 */
+
+        #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+            vLatencyHistogramISRExit();
+        #endif
+        #if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+            vTaskRunTimeStatsISRExit();
+        #endif
     }
 #endif /* if ( LIB_PICO_MULTICORE == 1 ) && ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) */
 
@@ -329,6 +606,22 @@ void vPortStartFirstTask( void )
         irq_set_exclusive_handler( ulIRQNum, prvFIFOInterruptHandler );
         irq_set_enabled( ulIRQNum, 1 );
 
+        #if ( configUSE_STACK_GUARD_MPU == 1 )
+            prvStackGuardInit();
+        #endif
+
+        #if ( configUSE_SAMPLING_PROFILER == 1 )
+            prvProfilerInit();
+        #endif
+
+        #if ( configUSE_EXECUTION_BUDGETS == 1 )
+            prvExecutionTimerInit();
+        #endif
+
+        #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+            prvSIOContextInit();
+        #endif
+
         /* Start the first task. */
         vPortStartFirstTask();
 
@@ -409,6 +702,22 @@ void vPortStartFirstTask( void )
             #endif
         #endif
 
+        #if ( configUSE_STACK_GUARD_MPU == 1 )
+            prvStackGuardInit();
+        #endif
+
+        #if ( configUSE_SAMPLING_PROFILER == 1 )
+            prvProfilerInit();
+        #endif
+
+        #if ( configUSE_EXECUTION_BUDGETS == 1 )
+            prvExecutionTimerInit();
+        #endif
+
+        #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+            prvSIOContextInit();
+        #endif
+
         /* Start the first task. */
         vPortStartFirstTask();
 
@@ -428,6 +737,311 @@ void vPortStartFirstTask( void )
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STACK_GUARD_MPU == 1 )
+
+    void vPortSetStackGuard( const void * pvStackStart )
+    {
+        uint32_t ulGuard, ulRegion, ulSubRegion;
+
+        /* The smallest ARMv6-M MPU region is 256 bytes, split into eight 32
+         * byte sub-regions.  Enable only the first sub-region that lies
+         * entirely inside the stack, so the guard costs at most 63 bytes of
+         * stack and nothing outside the stack is affected.  Reads are still
+         * allowed so stack high water mark scans keep working. */
+        ulGuard = ( ( uint32_t ) pvStackStart + ( portMPU_SUBREGION_SIZE - 1UL ) ) & ~( portMPU_SUBREGION_SIZE - 1UL );
+        ulRegion = ulGuard & ~( portMPU_REGION_SIZE - 1UL );
+        ulSubRegion = ( ulGuard - ulRegion ) / portMPU_SUBREGION_SIZE;
+
+        /* Called with interrupts disabled, from the context switch or before
+         * the first task starts, so the region cannot be seen half written. */
+        portMPU_RNR_REG = configSTACK_GUARD_MPU_REGION;
+        portMPU_RBAR_REG = ulRegion;
+        portMPU_RASR_REG = ( ( 0xffUL & ~( 1UL << ulSubRegion ) ) << portMPU_RASR_SRD_POS ) |
+                           portMPU_RASR_XN_BIT |
+                           portMPU_RASR_AP_READ_ONLY |
+                           portMPU_RASR_NORMAL_MEMORY |
+                           portMPU_RASR_SIZE_256_BYTES |
+                           portMPU_RASR_ENABLE_BIT;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvStackGuardInit( void )
+    {
+        vPortSetStackGuard( pxTaskGetStackStart( NULL ) );
+
+        /* Keep the default memory map for everything the guard does not
+         * cover.  The MPU is per core, so each core enables its own. */
+        portMPU_CTRL_REG |= ( portMPU_CTRL_PRIVDEFENA_BIT | portMPU_CTRL_ENABLE_BIT );
+        __asm volatile ( "dsb" ::: "memory" );
+        __asm volatile ( "isb" );
+    }
+
+#endif /* configUSE_STACK_GUARD_MPU */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SAMPLING_PROFILER == 1 )
+
+    static void prvProfilerInterruptHandler( void )
+    {
+        /* This is a naked function.  Bit 2 of EXC_RETURN tells whether the
+         * interrupted code was using the process or the main stack. */
+        __asm volatile
+        (
+            "   .syntax unified                     \n"
+            "   mov r1, lr                          \n"
+            "   movs r0, #4                         \n"
+            "   tst r0, r1                          \n"
+            "   beq 1f                              \n"
+            "   mrs r0, psp                         \n"
+            "   b 2f                                \n"
+            "1:                                     \n"
+            "   mrs r0, msp                         \n"
+            "2:                                     \n"
+            "   ldr r2, vPortProfilerSampleConst    \n" /* lr still holds EXC_RETURN, so returning from the */
+            "   bx r2                               \n" /* C function returns from the exception. */
+            "   .align 4                            \n"
+            "vPortProfilerSampleConst: .word vPortProfilerSample \n"
+        );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortProfilerSample( const uint32_t * pulFrame )
+    {
+        uint32_t ulStart, ulEnd, ulNext, ulCoreID, ulAlarm;
+        uint8_t ucFlags = 0U;
+
+        /* The handler times itself with SysTick, which counts down at the
+         * CPU clock.  Exception entry and exit, about 30 cycles, are not
+         * included. */
+        ulStart = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+        ulCoreID = get_core_num();
+        ulAlarm = ucProfilerAlarm[ ulCoreID ];
+
+        /* Acknowledge the alarm and set the next one a period after this one
+         * was due, so the rate does not drift.  If sampling has fallen behind
+         * (interrupts were masked for more than a period) skip ahead rather
+         * than taking a burst of samples. */
+        timer_hw->intr = 1UL << ulAlarm;
+        ulNext = ulProfilerNextSample[ ulCoreID ] + portPROFILER_PERIOD_US;
+
+        if( ( int32_t ) ( ulNext - timer_hw->timerawl ) <= 0 )
+        {
+            ulNext = timer_hw->timerawl + portPROFILER_PERIOD_US;
+        }
+
+        ulProfilerNextSample[ ulCoreID ] = ulNext;
+        timer_hw->alarm[ ulAlarm ] = ulNext;
+
+        if( ( pulFrame[ portPROFILER_FRAME_XPSR ] & portPROFILER_IPSR_MASK ) != 0UL )
+        {
+            ucFlags = sprofFLAG_INTERRUPT;
+        }
+
+        vSamplingProfilerSample( pulFrame[ portPROFILER_FRAME_PC ], pulFrame[ portPROFILER_FRAME_LR ], ucFlags );
+
+        ulEnd = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+        if( ulEnd > ulStart )
+        {
+            /* SysTick reloaded while the handler ran. */
+            ulStart += portNVIC_SYSTICK_LOAD_REG + 1UL;
+        }
+
+        vSamplingProfilerAddOverhead( ulStart - ulEnd );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvProfilerInit( void )
+    {
+        uint32_t ulCoreID = get_core_num();
+        uint32_t ulAlarm = ( uint32_t ) hardware_alarm_claim_unused( true );
+        uint32_t ulIRQNum = TIMER_IRQ_0 + ulAlarm;
+
+        ucProfilerAlarm[ ulCoreID ] = ( uint8_t ) ulAlarm;
+
+        /* Only the tick core runs SysTick.  Let it count freely, without an
+         * interrupt, on the other core so the handler can time itself. */
+        if( ( portNVIC_SYSTICK_CTRL_REG & portNVIC_SYSTICK_ENABLE_BIT ) == 0UL )
+        {
+            portNVIC_SYSTICK_LOAD_REG = portMAX_24_BIT_NUMBER;
+            portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+            portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT | portNVIC_SYSTICK_ENABLE_BIT;
+        }
+
+        /* The highest priority, so interrupt handlers are profiled too. */
+        irq_set_priority( ulIRQNum, portPROFILER_PRIORITY );
+        irq_set_exclusive_handler( ulIRQNum, prvProfilerInterruptHandler );
+        hw_set_bits( &timer_hw->inte, 1UL << ulAlarm );
+        irq_set_enabled( ulIRQNum, true );
+
+        /* Interrupts are still disabled, so the first alarm cannot fire
+         * before the first task has started. */
+        ulProfilerNextSample[ ulCoreID ] = timer_hw->timerawl + portPROFILER_PERIOD_US;
+        timer_hw->alarm[ ulAlarm ] = ulProfilerNextSample[ ulCoreID ];
+    }
+
+#endif /* configUSE_SAMPLING_PROFILER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+
+    static void prvExecutionTimerInterruptHandler( void )
+    {
+        const uint32_t ulMask = 1UL << ucExecutionTimerAlarm[ get_core_num() ];
+
+        /* Clear both a real and a forced expiry. */
+        hw_clear_bits( &timer_hw->intf, ulMask );
+        timer_hw->intr = ulMask;
+
+        portYIELD_FROM_ISR( xTaskExecutionTimerExpired() );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortExecutionTimerStart( configRUN_TIME_COUNTER_TYPE ulTimeout )
+    {
+        const uint32_t ulAlarm = ucExecutionTimerAlarm[ get_core_num() ];
+        uint32_t ulTarget;
+
+        if( ulTimeout > portEXECUTION_TIMER_MAX_US )
+        {
+            ulTimeout = portEXECUTION_TIMER_MAX_US;
+        }
+
+        ulTarget = timer_hw->timerawl + ( uint32_t ) ulTimeout;
+        timer_hw->alarm[ ulAlarm ] = ulTarget;
+
+        /* An alarm only fires when the timer matches it, so one that was
+         * already passed by the time it was armed is forced instead. */
+        if( ( ( int32_t ) ( timer_hw->timerawl - ulTarget ) >= 0 ) &&
+            ( ( timer_hw->armed & ( 1UL << ulAlarm ) ) != 0UL ) )
+        {
+            timer_hw->armed = 1UL << ulAlarm;
+            hw_set_bits( &timer_hw->intf, 1UL << ulAlarm );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortExecutionTimerStop( void )
+    {
+        const uint32_t ulMask = 1UL << ucExecutionTimerAlarm[ get_core_num() ];
+
+        /* Writing 1 to the armed register disarms the alarm. */
+        timer_hw->armed = ulMask;
+        hw_clear_bits( &timer_hw->intf, ulMask );
+        timer_hw->intr = ulMask;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvExecutionTimerInit( void )
+    {
+        uint32_t ulAlarm = ( uint32_t ) hardware_alarm_claim_unused( true );
+        uint32_t ulIRQNum = TIMER_IRQ_0 + ulAlarm;
+
+        ucExecutionTimerAlarm[ get_core_num() ] = ( uint8_t ) ulAlarm;
+
+        /* The handler enters a critical section, so it runs at the kernel
+         * priority. */
+        irq_set_priority( ulIRQNum, portMIN_INTERRUPT_PRIORITY );
+        irq_set_exclusive_handler( ulIRQNum, prvExecutionTimerInterruptHandler );
+        hw_set_bits( &timer_hw->inte, 1UL << ulAlarm );
+        irq_set_enabled( ulIRQNum, true );
+    }
+
+#endif /* configUSE_EXECUTION_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_IDLE_GOVERNOR == 1 )
+
+    static TickType_t prvIdleWait( TickType_t xExpectedIdleTime )
+    {
+        ( void ) xExpectedIdleTime;
+
+        __wfi();
+
+        return ( TickType_t ) 0;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvIdleDeepSleep( TickType_t xExpectedIdleTime )
+    {
+        ( void ) xExpectedIdleTime;
+
+        /* The SCB is private to each core, so this only affects the calling
+         * core. */
+        scb_hw->scr |= M0PLUS_SCR_SLEEPDEEP_BITS;
+        __wfi();
+        scb_hw->scr &= ~M0PLUS_SCR_SLEEPDEEP_BITS;
+
+        return ( TickType_t ) 0;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortIdleStatesInit( void )
+    {
+        /* The processors keep their clocks so SysTick keeps counting ticks,
+         * and the timer keeps its clock for the run time counter. */
+        clocks_hw->sleep_en0 = ( uint32_t ) configIDLE_SLEEP_EN0 | CLOCKS_SLEEP_EN0_CLK_SYS_PROC0_BITS | CLOCKS_SLEEP_EN0_CLK_SYS_PROC1_BITS;
+        clocks_hw->sleep_en1 = ( uint32_t ) configIDLE_SLEEP_EN1 | CLOCKS_SLEEP_EN1_CLK_SYS_TIMER_BITS;
+
+        vTaskSetIdleStates( xPortIdleStates, sizeof( xPortIdleStates ) / sizeof( xPortIdleStates[ 0 ] ) );
+    }
+
+#endif /* configUSE_IDLE_GOVERNOR */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+
+    static StackType_t * prvSIOContextFlags( TaskHandle_t xTask )
+    {
+        /* pxTopOfStack is the first member of the TCB, and the flags are the
+         * word just below the saved r4. */
+        return *( ( StackType_t ** ) xTask ) - 1;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSIOContextInit( void )
+    {
+        /* The first task is started without going through
+         * xPortPendSVHandler(), so pick up anything it claimed before the
+         * scheduler was started. */
+        ulPortSIOContext[ portGET_CORE_ID() ] = *prvSIOContextFlags( xTaskGetCurrentTaskHandle() );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortTaskUsesSIOContext( TaskHandle_t xTask,
+                                  uint32_t ulContext )
+    {
+        configASSERT( ( ulContext & ~( portSIO_CONTEXT_DIVIDER | portSIO_CONTEXT_INTERPOLATORS ) ) == 0UL );
+
+        taskENTER_CRITICAL();
+        {
+            if( ucPrimaryCoreNum == INVALID_PRIMARY_CORE_NUM )
+            {
+                /* The scheduler has not been started, so xTask is not
+                 * running and its saved flags are the ones that count. */
+                configASSERT( xTask != NULL );
+                *prvSIOContextFlags( xTask ) |= ulContext;
+            }
+            else if( ( xTask == NULL ) || ( xTask == xTaskGetCurrentTaskHandle() ) )
+            {
+                /* Saved with the rest of the context on the next switch. */
+                ulPortSIOContext[ portGET_CORE_ID() ] |= ulContext;
+            }
+            else
+            {
+                #if ( configNUMBER_OF_CORES > 1 )
+                    configASSERT( xTaskGetCurrentTaskHandleForCore( ( BaseType_t ) !portGET_CORE_ID() ) != xTask );
+                #endif
+
+                *prvSIOContextFlags( xTask ) |= ulContext;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_LAZY_SIO_CONTEXT */
+/*-----------------------------------------------------------*/
+
 void vPortEndScheduler( void )
 {
     /* Not implemented in ports where there is nothing to return to.
@@ -456,6 +1070,13 @@ void vPortYield( void )
         uxCriticalNesting++;
         __asm volatile ( "dsb" ::: "memory" );
         __asm volatile ( "isb" );
+
+        #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+            if( uxCriticalNesting == 1 )
+            {
+                vLatencyHistogramSectionEnter( eLatencyInterruptsMasked, ( uint32_t ) portLATENCY_CALLER_ADDRESS() );
+            }
+        #endif
     }
 #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 /*-----------------------------------------------------------*/
@@ -468,6 +1089,9 @@ void vPortYield( void )
 
         if( uxCriticalNesting == 0 )
         {
+            #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+                vLatencyHistogramSectionExit( eLatencyInterruptsMasked );
+            #endif
             portENABLE_INTERRUPTS();
         }
     }
@@ -535,7 +1159,14 @@ void xPortPendSVHandler( void )
             "   mov r6, r10                         \n"
             "   mov r7, r11                         \n"
             "   stmia r0!, {r4-r7}                  \n"
-            #if portUSE_DIVIDER_SAVE_RESTORE
+            #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+                "   subs r0, r0, #108                   \n" /* r0 = the SIO context area below the saved registers. */
+                "   ldr r1, ulSIOContextConst           \n"
+                "   ldr r1, [r1]                        \n" /* r1 = the SIO context flags of the task. */
+                "   movs r2, #0xd                       \n"
+                "   lsls r2, #28                        \n"
+                portSAVE_SIO_CONTEXT
+            #elif portUSE_DIVIDER_SAVE_RESTORE
                 "   movs r2, #0xd                   \n" /* Store the divider state. */
                 "   lsls r2, #28                    \n"
 
@@ -577,7 +1208,16 @@ void xPortPendSVHandler( void )
             "                                       \n"
             "   msr psp, r0                         \n" /* Remember the new top of stack for the task. */
             "                                       \n"
-            #if portUSE_DIVIDER_SAVE_RESTORE
+            #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+                "   subs r0, r0, #108                   \n" /* r0 = the SIO context area below the saved registers. */
+                "   ldr r1, [r0, #72]                   \n" /* r1 = the SIO context flags of the task. */
+                "   ldr r2, ulSIOContextConst           \n"
+                "   str r1, [r2]                        \n"
+                "   movs r2, #0xd                       \n"
+                "   lsls r2, #28                        \n"
+                portRESTORE_SIO_CONTEXT
+                "   adds r0, r0, #76                    \n" /* Back to the low registers. */
+            #elif portUSE_DIVIDER_SAVE_RESTORE
                 "   movs r2, #0xd                       \n" /* Pop the divider state. */
                 "   lsls r2, #28                        \n"
                 "   subs r0, r0, #48                    \n" /* Go back for the divider state */
@@ -599,6 +1239,9 @@ void xPortPendSVHandler( void )
             "   bx r3                               \n"
             "   .align 4                            \n"
             "pxCurrentTCBConst2: .word pxCurrentTCB \n"
+            #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+                "ulSIOContextConst: .word ulPortSIOContext \n"
+            #endif
         );
     #else /* if ( configNUMBER_OF_CORES == 1 ) */
         __asm volatile
@@ -621,7 +1264,15 @@ void xPortPendSVHandler( void )
             "   mov r6, r10                         \n"
             "   mov r7, r11                         \n"
             "   stmia r1!, {r4-r7}                  \n"
-            #if portUSE_DIVIDER_SAVE_RESTORE
+            #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+                "   mov r0, r1                          \n"
+                "   subs r0, r0, #108                   \n" /* r0 = the SIO context area below the saved registers. */
+                "   ldr r1, [r2]                        \n" /* r1 = core number. */
+                "   lsls r1, r1, #2                     \n"
+                "   ldr r4, ulSIOContextConst           \n"
+                "   ldr r1, [r4, r1]                    \n" /* r1 = the SIO context flags of the task. */
+                portSAVE_SIO_CONTEXT
+            #elif portUSE_DIVIDER_SAVE_RESTORE
 
                 /* We expect that the divider is ready at this point (which is
                  * necessary to safely save/restore), because:
@@ -662,7 +1313,18 @@ void xPortPendSVHandler( void )
             "                                       \n"
             "   msr psp, r0                         \n" /* Remember the new top of stack for the task. */
             "                                       \n"
-            #if portUSE_DIVIDER_SAVE_RESTORE
+            #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+                "   subs r0, r0, #108                   \n" /* r0 = the SIO context area below the saved registers. */
+                "   ldr r1, [r0, #72]                   \n" /* r1 = the SIO context flags of the task. */
+                "   movs r2, #0xd                       \n"
+                "   lsls r2, #28                        \n"
+                "   ldr r4, [r2]                        \n" /* r4 = core number. */
+                "   lsls r4, r4, #2                     \n"
+                "   ldr r5, ulSIOContextConst           \n"
+                "   str r1, [r5, r4]                    \n"
+                portRESTORE_SIO_CONTEXT
+                "   adds r0, r0, #76                    \n" /* Back to the low registers. */
+            #elif portUSE_DIVIDER_SAVE_RESTORE
                 "   movs r2, #0xd                       \n" /* Pop the divider state. */
                 "   lsls r2, #28                        \n"
                 "   subs r0, r0, #48                    \n" /* Go back for the divider state */
@@ -687,6 +1349,9 @@ void xPortPendSVHandler( void )
             "ulAsmLocals2:                         \n"
             "   .word 0xD0000000                   \n" /* SIO */
             "   .word pxCurrentTCBs                \n"
+            #if ( configUSE_LAZY_SIO_CONTEXT == 1 )
+                "ulSIOContextConst: .word ulPortSIOContext \n"
+            #endif
         );
     #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 }
@@ -696,6 +1361,13 @@ void xPortSysTickHandler( void )
 {
     uint32_t ulPreviousMask;
 
+    #if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+        vTaskRunTimeStatsISREnter();
+    #endif
+    #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+        vLatencyHistogramISREnter();
+    #endif
+
     ulPreviousMask = taskENTER_CRITICAL_FROM_ISR();
     traceISR_ENTER();
     {
@@ -712,6 +1384,13 @@ void xPortSysTickHandler( void )
         }
     }
     taskEXIT_CRITICAL_FROM_ISR( ulPreviousMask );
+
+    #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+        vLatencyHistogramISRExit();
+    #endif
+    #if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+        vTaskRunTimeStatsISRExit();
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -133,12 +133,31 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
     #endif
+
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        ObjectMetrics_t xMetrics; /**< Use counts and blocked times, see object_metrics.h. */
+    #endif
+
+    #if ( configUSE_JOB_DISPATCHER == 1 )
+        struct xJOB * pxJob; /**< Job posted each time an item is sent to the queue, see job_dispatcher.h. */
+    #endif
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
  * name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+#if ( configUSE_QUEUE_SCALAR_COPY == 1 )
+
+/* The storage area of a dynamically allocated queue starts at this offset from
+ * the queue structure, so items of up to 8 bytes are aligned to their size. */
+    #define queueSTORAGE_OFFSET                                ( ( sizeof( Queue_t ) + ( sizeof( uint64_t ) - 1U ) ) & ~( sizeof( uint64_t ) - 1U ) )
+    #define queueCOPY_ITEM( pvDestination, pvSource, uxSize )    prvCopyItem( ( pvDestination ), ( pvSource ), ( uxSize ) )
+#else
+    #define queueSTORAGE_OFFSET                                sizeof( Queue_t )
+    #define queueCOPY_ITEM( pvDestination, pvSource, uxSize )    ( void ) memcpy( ( void * ) ( pvDestination ), ( pvSource ), ( size_t ) ( uxSize ) )
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -210,6 +229,18 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_QUEUE_SCALAR_COPY == 1 )
+
+/*
+ * Copies an item of uxSize bytes.  Items of 1, 2, 4 or 8 bytes are copied with
+ * a single load and store when both addresses are aligned to the item size.
+ * Other items use memcpy().
+ */
+    static void prvCopyItem( void * pvDestination,
+                             const void * pvSource,
+                             UBaseType_t uxSize ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
@@ -249,6 +280,17 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
  */
     static UBaseType_t prvGetHighestPriorityOfWaitToReceiveList( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
+
+#if ( configUSE_QUEUE_FAST_PATHS == 1 )
+
+/*
+ * Called from a critical section by the fast paths once an item has been
+ * stored or a semaphore given.  Counts the item and unblocks a task waiting
+ * to receive it, or notifies the queue set the queue is a member of.
+ */
+    static void prvFastPathPosted( Queue_t * const pxQueue,
+                                   BaseType_t xYieldRequired ) PRIVILEGED_FUNCTION;
+#endif
 /*-----------------------------------------------------------*/
 
 /*
@@ -516,7 +558,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             /* MISRA Ref 14.3.1 [Configuration dependent invariant] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-143. */
             /* coverity[misra_c_2012_rule_14_3_violation] */
-            ( ( SIZE_MAX - sizeof( Queue_t ) ) >= ( size_t ) ( ( size_t ) uxQueueLength * ( size_t ) uxItemSize ) ) )
+            ( ( SIZE_MAX - queueSTORAGE_OFFSET ) >= ( size_t ) ( ( size_t ) uxQueueLength * ( size_t ) uxItemSize ) ) )
         {
             /* Allocate enough space to hold the maximum number of items that
              * can be in the queue at any time.  It is valid for uxItemSize to be
@@ -526,14 +568,14 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
+            pxNewQueue = ( Queue_t * ) pvPortMalloc( queueSTORAGE_OFFSET + xQueueSizeInBytes );
 
             if( pxNewQueue != NULL )
             {
                 /* Jump past the queue structure to find the location of the queue
                  * storage area. */
                 pucQueueStorage = ( uint8_t * ) pxNewQueue;
-                pucQueueStorage += sizeof( Queue_t );
+                pucQueueStorage += queueSTORAGE_OFFSET;
 
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
@@ -608,6 +650,27 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
     }
     #endif /* configUSE_QUEUE_SETS */
 
+    #if ( configUSE_JOB_DISPATCHER == 1 )
+    {
+        pxNewQueue->pxJob = NULL;
+    }
+    #endif /* configUSE_JOB_DISPATCHER */
+
+    /* Mutexes are registered by prvInitialiseMutex(), once they have been
+     * given for the first time. */
+    if( ( ucQueueType == queueQUEUE_TYPE_COUNTING_SEMAPHORE ) || ( ucQueueType == queueQUEUE_TYPE_BINARY_SEMAPHORE ) )
+    {
+        objmetricsREGISTER( &( pxNewQueue->xMetrics ), pxNewQueue, eObjectMetricsSemaphore, NULL );
+    }
+    else if( ( ucQueueType != queueQUEUE_TYPE_MUTEX ) && ( ucQueueType != queueQUEUE_TYPE_RECURSIVE_MUTEX ) )
+    {
+        objmetricsREGISTER( &( pxNewQueue->xMetrics ), pxNewQueue, eObjectMetricsQueue, NULL );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
     traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
@@ -632,6 +695,10 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
 
             /* Start with the semaphore in the expected state. */
             ( void ) xQueueGenericSend( pxNewQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
+
+            /* Registering clears the counters, so the give above is not
+             * counted. */
+            objmetricsREGISTER( &( pxNewQueue->xMetrics ), pxNewQueue, eObjectMetricsMutex, NULL );
         }
         else
         {
@@ -955,6 +1022,10 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
     TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        uint32_t ulWaitStart = 0U;
+    #endif
+
     traceENTER_xQueueGenericSend( xQueue, pvItemToQueue, xTicksToWait, xCopyPosition );
 
     configASSERT( pxQueue );
@@ -1074,6 +1145,15 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 }
                 #endif /* configUSE_QUEUE_SETS */
 
+                if( xEntryTimeSet != pdFALSE )
+                {
+                    objmetricsWAIT_END( &( pxQueue->xMetrics ), ulWaitStart, eObjectMetricsWaitSatisfied );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
                 taskEXIT_CRITICAL();
 
                 traceRETURN_xQueueGenericSend( pdPASS );
@@ -1086,6 +1166,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 {
                     /* The queue was full and no block time is specified (or
                      * the block time has expired) so leave now. */
+                    objmetricsSEND_FAILED( &( pxQueue->xMetrics ) );
                     taskEXIT_CRITICAL();
 
                     /* Return to the original privilege level before exiting
@@ -1100,6 +1181,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                     /* The queue was full and a block time was specified so
                      * configure the timeout structure. */
                     vTaskInternalSetTimeOutState( &xTimeOut );
+                    objmetricsWAIT_START( ulWaitStart );
                     xEntryTimeSet = pdTRUE;
                 }
                 else
@@ -1155,6 +1237,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
             prvUnlockQueue( pxQueue );
             ( void ) xTaskResumeAll();
 
+            objmetricsWAIT_END( &( pxQueue->xMetrics ), ulWaitStart, eObjectMetricsSendTimedOut );
             traceQUEUE_SEND_FAILED( pxQueue );
             traceRETURN_xQueueGenericSend( errQUEUE_FULL );
 
@@ -1324,6 +1407,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
         else
         {
             traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+            objmetricsSEND_FAILED( &( pxQueue->xMetrics ) );
             xReturn = errQUEUE_FULL;
         }
     }
@@ -1398,6 +1482,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
              * priority disinheritance is needed.  Simply increase the count of
              * messages (semaphores) available. */
             pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting + ( UBaseType_t ) 1 );
+            objmetricsSEND( &( pxQueue->xMetrics ), uxMessagesWaiting + ( UBaseType_t ) 1 );
 
             /* The event list is not altered if the queue is locked.  This will
              * be done when the queue is unlocked later. */
@@ -1495,6 +1580,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
         else
         {
             traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+            objmetricsSEND_FAILED( &( pxQueue->xMetrics ) );
             xReturn = errQUEUE_FULL;
         }
     }
@@ -1514,6 +1600,10 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
     TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        uint32_t ulWaitStart = 0U;
+    #endif
+
     traceENTER_xQueueReceive( xQueue, pvBuffer, xTicksToWait );
 
     /* Check the pointer is not NULL. */
@@ -1544,6 +1634,16 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 prvCopyDataFromQueue( pxQueue, pvBuffer );
                 traceQUEUE_RECEIVE( pxQueue );
                 pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
+                objmetricsRECEIVE( &( pxQueue->xMetrics ) );
+
+                if( xEntryTimeSet != pdFALSE )
+                {
+                    objmetricsWAIT_END( &( pxQueue->xMetrics ), ulWaitStart, eObjectMetricsWaitSatisfied );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
                 /* There is now space in the queue, were any tasks waiting to
                  * post to the queue?  If so, unblock the highest priority waiting
@@ -1576,6 +1676,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 {
                     /* The queue was empty and no block time is specified (or
                      * the block time has expired) so leave now. */
+                    objmetricsRECEIVE_FAILED( &( pxQueue->xMetrics ) );
                     taskEXIT_CRITICAL();
 
                     traceQUEUE_RECEIVE_FAILED( pxQueue );
@@ -1588,6 +1689,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                     /* The queue was empty and a block time was specified so
                      * configure the timeout structure. */
                     vTaskInternalSetTimeOutState( &xTimeOut );
+                    objmetricsWAIT_START( ulWaitStart );
                     xEntryTimeSet = pdTRUE;
                 }
                 else
@@ -1642,6 +1744,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 
             if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
             {
+                objmetricsWAIT_END( &( pxQueue->xMetrics ), ulWaitStart, eObjectMetricsReceiveTimedOut );
                 traceQUEUE_RECEIVE_FAILED( pxQueue );
                 traceRETURN_xQueueReceive( errQUEUE_EMPTY );
 
@@ -1667,6 +1770,10 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
         BaseType_t xInheritanceOccurred = pdFALSE;
     #endif
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        uint32_t ulWaitStart = 0U;
+    #endif
+
     traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait );
 
     /* Check the queue pointer is not NULL. */
@@ -1700,6 +1807,16 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                 /* Semaphores are queues with a data size of zero and where the
                  * messages waiting is the semaphore's count.  Reduce the count. */
                 pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxSemaphoreCount - ( UBaseType_t ) 1 );
+                objmetricsRECEIVE( &( pxQueue->xMetrics ) );
+
+                if( xEntryTimeSet != pdFALSE )
+                {
+                    objmetricsWAIT_END( &( pxQueue->xMetrics ), ulWaitStart, eObjectMetricsWaitSatisfied );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
                 #if ( configUSE_MUTEXES == 1 )
                 {
@@ -1708,6 +1825,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                         /* Record the information required to implement
                          * priority inheritance should it become necessary. */
                         pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+                        objmetricsMUTEX_TAKEN( &( pxQueue->xMetrics ) );
                     }
                     else
                     {
@@ -1746,6 +1864,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                 {
                     /* The semaphore count was 0 and no block time is specified
                      * (or the block time has expired) so exit now. */
+                    objmetricsRECEIVE_FAILED( &( pxQueue->xMetrics ) );
                     taskEXIT_CRITICAL();
 
                     traceQUEUE_RECEIVE_FAILED( pxQueue );
@@ -1758,7 +1877,17 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                     /* The semaphore count was 0 and a block time was specified
                      * so configure the timeout structure ready to block. */
                     vTaskInternalSetTimeOutState( &xTimeOut );
+                    objmetricsWAIT_START( ulWaitStart );
                     xEntryTimeSet = pdTRUE;
+
+                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                    {
+                        objmetricsCONTENTION( &( pxQueue->xMetrics ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 else
                 {
@@ -1867,6 +1996,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                 }
                 #endif /* configUSE_MUTEXES */
 
+                objmetricsWAIT_END( &( pxQueue->xMetrics ), ulWaitStart, eObjectMetricsReceiveTimedOut );
                 traceQUEUE_RECEIVE_FAILED( pxQueue );
                 traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
 
@@ -2081,6 +2211,7 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
 
             prvCopyDataFromQueue( pxQueue, pvBuffer );
             pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
+            objmetricsRECEIVE( &( pxQueue->xMetrics ) );
 
             /* If the queue is locked the event list will not be modified.
              * Instead update the lock count so the task that unlocks the queue
@@ -2126,6 +2257,7 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
         {
             xReturn = pdFAIL;
             traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+            objmetricsRECEIVE_FAILED( &( pxQueue->xMetrics ) );
         }
     }
     taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
@@ -2269,6 +2401,8 @@ void vQueueDelete( QueueHandle_t xQueue )
     }
     #endif
 
+    objmetricsUNREGISTER( &( pxQueue->xMetrics ) );
+
     #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
     {
         /* The queue can only have been allocated dynamically - free it
@@ -2410,6 +2544,7 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
                 /* The mutex is no longer being held. */
                 xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
                 pxQueue->u.xSemaphore.xMutexHolder = NULL;
+                objmetricsMUTEX_GIVEN( &( pxQueue->xMetrics ) );
             }
             else
             {
@@ -2420,7 +2555,7 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
     }
     else if( xPosition == queueSEND_TO_BACK )
     {
-        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        queueCOPY_ITEM( pxQueue->pcWriteTo, pvItemToQueue, pxQueue->uxItemSize );
         pxQueue->pcWriteTo += pxQueue->uxItemSize;
 
         if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
@@ -2434,7 +2569,7 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
     }
     else
     {
-        ( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        queueCOPY_ITEM( pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, pxQueue->uxItemSize );
         pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
 
         if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
@@ -2468,6 +2603,20 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
     }
 
     pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting + ( UBaseType_t ) 1 );
+    objmetricsSEND( &( pxQueue->xMetrics ), pxQueue->uxMessagesWaiting );
+
+    #if ( configUSE_JOB_DISPATCHER == 1 )
+    {
+        if( pxQueue->pxJob != NULL )
+        {
+            vJobPostFromQueue( pxQueue->pxJob );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_JOB_DISPATCHER */
 
     return xReturn;
 }
@@ -2489,11 +2638,46 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
             mtCOVERAGE_TEST_MARKER();
         }
 
-        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize );
+        queueCOPY_ITEM( pvBuffer, pxQueue->u.xQueue.pcReadFrom, pxQueue->uxItemSize );
     }
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_SCALAR_COPY == 1 )
+
+    static void prvCopyItem( void * pvDestination,
+                             const void * pvSource,
+                             UBaseType_t uxSize )
+    {
+        /* The addresses are aligned to the item size if no bit below the
+         * size is set.  Only meaningful for power of two sizes. */
+        const portPOINTER_SIZE_TYPE uxMisaligned = ( ( portPOINTER_SIZE_TYPE ) pvDestination | ( portPOINTER_SIZE_TYPE ) pvSource ) & ( portPOINTER_SIZE_TYPE ) ( uxSize - 1U );
+
+        if( ( uxSize == ( UBaseType_t ) sizeof( uint32_t ) ) && ( uxMisaligned == 0U ) )
+        {
+            *( ( uint32_t * ) pvDestination ) = *( ( const uint32_t * ) pvSource );
+        }
+        else if( uxSize == ( UBaseType_t ) sizeof( uint8_t ) )
+        {
+            *( ( uint8_t * ) pvDestination ) = *( ( const uint8_t * ) pvSource );
+        }
+        else if( ( uxSize == ( UBaseType_t ) sizeof( uint16_t ) ) && ( uxMisaligned == 0U ) )
+        {
+            *( ( uint16_t * ) pvDestination ) = *( ( const uint16_t * ) pvSource );
+        }
+        else if( ( uxSize == ( UBaseType_t ) sizeof( uint64_t ) ) && ( uxMisaligned == 0U ) )
+        {
+            *( ( uint64_t * ) pvDestination ) = *( ( const uint64_t * ) pvSource );
+        }
+        else
+        {
+            ( void ) memcpy( pvDestination, pvSource, ( size_t ) uxSize );
+        }
+    }
+
+#endif /* configUSE_QUEUE_SCALAR_COPY */
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -3052,6 +3236,13 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
             traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName );
         }
 
+        #if ( configUSE_OBJECT_METRICS == 1 )
+        {
+            /* Report the object metrics under the same name. */
+            ( void ) xObjectMetricsSetName( xQueue, pcQueueName );
+        }
+        #endif
+
         traceRETURN_vQueueAddToRegistry();
     }
 
@@ -3212,6 +3403,303 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 #endif /* #if ( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_JOB_DISPATCHER == 1 )
+
+    void vJobAttachQueue( Job_t * pxJob,
+                          QueueHandle_t xQueue )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue != NULL );
+
+        #if ( configUSE_MUTEXES == 1 )
+            configASSERT( pxQueue->uxQueueType != queueQUEUE_IS_MUTEX );
+        #endif
+
+        #if ( configUSE_QUEUE_SETS == 1 )
+
+            /* The job would take items without the queue set knowing. */
+            configASSERT( pxQueue->pxQueueSetContainer == NULL );
+        #endif
+
+        taskENTER_CRITICAL();
+        {
+            pxQueue->pxJob = pxJob;
+
+            /* Items sent before the job was attached are handled too. */
+            if( ( pxJob != NULL ) && ( pxQueue->uxMessagesWaiting != ( UBaseType_t ) 0 ) )
+            {
+                vJobPostFromQueue( pxJob );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_JOB_DISPATCHER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_FAST_PATHS == 1 )
+
+    static void prvFastPathPosted( Queue_t * const pxQueue,
+                                   BaseType_t xYieldRequired )
+    {
+        BaseType_t xInQueueSet = pdFALSE;
+
+        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1 );
+        objmetricsSEND( &( pxQueue->xMetrics ), pxQueue->uxMessagesWaiting );
+
+        #if ( configUSE_JOB_DISPATCHER == 1 )
+        {
+            if( pxQueue->pxJob != NULL )
+            {
+                vJobPostFromQueue( pxQueue->pxJob );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_JOB_DISPATCHER */
+
+        #if ( configUSE_QUEUE_SETS == 1 )
+        {
+            if( pxQueue->pxQueueSetContainer != NULL )
+            {
+                /* Tasks wait on the queue set rather than on the queue. */
+                xInQueueSet = pdTRUE;
+
+                if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_QUEUE_SETS */
+
+        if( xInQueueSet != pdFALSE )
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+        else if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+        {
+            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+            {
+                queueYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else if( xYieldRequired != pdFALSE )
+        {
+            /* The mutex holder disinherited a priority. */
+            queueYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueSemaphoreGive( QueueHandle_t xQueue )
+    {
+        BaseType_t xReturn;
+        BaseType_t xYieldRequired = pdFALSE;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueSemaphoreGive( xQueue );
+
+        configASSERT( pxQueue );
+        configASSERT( pxQueue->uxItemSize == ( UBaseType_t ) 0 );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+            {
+                traceQUEUE_SEND( pxQueue );
+
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                    {
+                        /* The mutex is no longer being held. */
+                        xYieldRequired = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+                        pxQueue->u.xSemaphore.xMutexHolder = NULL;
+                        objmetricsMUTEX_GIVEN( &( pxQueue->xMetrics ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_MUTEXES */
+
+                prvFastPathPosted( pxQueue, xYieldRequired );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                /* A semaphore give never blocks. */
+                objmetricsSEND_FAILED( &( pxQueue->xMetrics ) );
+                traceQUEUE_SEND_FAILED( pxQueue );
+                xReturn = errQUEUE_FULL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xQueueSemaphoreGive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueSendPointer( QueueHandle_t xQueue,
+                                  void * pvItem,
+                                  TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueSendPointer( xQueue, pvItem, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pxQueue->uxItemSize == ( UBaseType_t ) sizeof( void * ) );
+        configASSERT( ( ( portPOINTER_SIZE_TYPE ) pxQueue->pcHead & ( portPOINTER_SIZE_TYPE ) ( sizeof( void * ) - 1U ) ) == 0U );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+            {
+                traceQUEUE_SEND( pxQueue );
+
+                *( ( void ** ) pxQueue->pcWriteTo ) = pvItem;
+                pxQueue->pcWriteTo += sizeof( void * );
+
+                if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->pcWriteTo = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvFastPathPosted( pxQueue, pdFALSE );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xReturn != pdPASS )
+        {
+            /* The queue is full, so fail or block on the generic path. */
+            xReturn = xQueueGenericSend( xQueue, &pvItem, xTicksToWait, queueSEND_TO_BACK );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xQueueSendPointer( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueReceivePointer( QueueHandle_t xQueue,
+                                     void ** ppvItem,
+                                     TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueReceivePointer( xQueue, ppvItem, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( ppvItem );
+        configASSERT( pxQueue->uxItemSize == ( UBaseType_t ) sizeof( void * ) );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+            {
+                pxQueue->u.xQueue.pcReadFrom += sizeof( void * );
+
+                if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                *ppvItem = *( ( void ** ) pxQueue->u.xQueue.pcReadFrom );
+                traceQUEUE_RECEIVE( pxQueue );
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1 );
+                objmetricsRECEIVE( &( pxQueue->xMetrics ) );
+
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xReturn != pdPASS )
+        {
+            /* The queue is empty, so fail or block on the generic path. */
+            xReturn = xQueueReceive( xQueue, ( void * ) ppvItem, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xQueueReceivePointer( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_FAST_PATHS */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
     BaseType_t xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore,
@@ -0,0 +1,229 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the sampling profiler. */
+#if ( configUSE_SAMPLING_PROFILER == 1 )
+
+    #define sprofBUFFER_INDEX_MASK    ( ( uint32_t ) configSAMPLING_PROFILER_BUFFER_LENGTH - 1U )
+
+/*
+ * Ring buffer and statistics owned by one core.  As with the trace recorder,
+ * ulHead and the statistics are only written by the owning core (from the
+ * sampling interrupt, with interrupts masked) and ulTail is only written by
+ * the reader, so no lock is needed.
+ */
+    typedef struct xPROFILER_CORE
+    {
+        volatile uint32_t ulHead;
+        volatile uint32_t ulTail;
+        ProfilerStats_t xStats;
+        ProfilerSample_t xSamples[ configSAMPLING_PROFILER_BUFFER_LENGTH ];
+    } ProfilerCore_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+ * which static variables must be declared volatile. */
+    PRIVILEGED_DATA static ProfilerCore_t xProfilerCores[ configNUMBER_OF_CORES ];
+    PRIVILEGED_DATA static volatile BaseType_t xProfilerEnabled = pdFALSE;
+/*lint -restore */
+
+/*-----------------------------------------------------------*/
+
+    void vSamplingProfilerStart( void )
+    {
+        xProfilerEnabled = pdTRUE;
+    }
+/*-----------------------------------------------------------*/
+
+    void vSamplingProfilerStop( void )
+    {
+        xProfilerEnabled = pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    void vSamplingProfilerSample( uint32_t ulPC,
+                                  uint32_t ulLR,
+                                  uint8_t ucFlags )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        ProfilerCore_t * pxCore;
+        ProfilerSample_t * pxSample;
+        uint32_t ulHead;
+        BaseType_t xCoreID;
+
+        if( xProfilerEnabled != pdFALSE )
+        {
+            uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+            {
+                xCoreID = ( BaseType_t ) portGET_CORE_ID();
+                pxCore = &( xProfilerCores[ xCoreID ] );
+                ulHead = pxCore->ulHead;
+
+                if( ( ulHead - pxCore->ulTail ) < ( uint32_t ) configSAMPLING_PROFILER_BUFFER_LENGTH )
+                {
+                    pxSample = &( pxCore->xSamples[ ulHead & sprofBUFFER_INDEX_MASK ] );
+                    pxSample->ulPC = ulPC;
+                    pxSample->ulLR = ulLR;
+                    pxSample->ulTask = ( uint32_t ) xTaskGetCurrentTaskHandleForCore( xCoreID );
+                    pxSample->ucCore = ( uint8_t ) xCoreID;
+                    pxSample->ucFlags = ucFlags;
+                    pxSample->usReserved = 0U;
+
+                    /* The sample must be complete before the reader can see
+                     * it. */
+                    portMEMORY_BARRIER();
+                    pxCore->ulHead = ulHead + 1U;
+                    pxCore->xStats.ulSamples++;
+                }
+                else
+                {
+                    pxCore->xStats.ulDropped++;
+                }
+            }
+            portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vSamplingProfilerAddOverhead( uint32_t ulCycles )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        ProfilerStats_t * pxStats;
+
+        if( xProfilerEnabled != pdFALSE )
+        {
+            uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+            {
+                pxStats = &( xProfilerCores[ portGET_CORE_ID() ].xStats );
+                pxStats->ulTotalCycles += ulCycles;
+
+                if( ulCycles > pxStats->ulMaxCycles )
+                {
+                    pxStats->ulMaxCycles = ulCycles;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xSamplingProfilerRead( BaseType_t xCoreID,
+                                  ProfilerSample_t * pxSamples,
+                                  size_t xMaxSamples )
+    {
+        ProfilerCore_t * pxCore;
+        uint32_t ulHead, ulTail;
+        size_t xCount = 0U;
+
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+        configASSERT( pxSamples != NULL );
+
+        pxCore = &( xProfilerCores[ xCoreID ] );
+        ulHead = pxCore->ulHead;
+        ulTail = pxCore->ulTail;
+
+        /* Samples up to ulHead are complete, the writer only publishes a
+         * sample once it has been filled in. */
+        portMEMORY_BARRIER();
+
+        while( ( ulTail != ulHead ) && ( xCount < xMaxSamples ) )
+        {
+            ( void ) memcpy( &( pxSamples[ xCount ] ), &( pxCore->xSamples[ ulTail & sprofBUFFER_INDEX_MASK ] ), sizeof( ProfilerSample_t ) );
+            ulTail++;
+            xCount++;
+        }
+
+        /* Only release the slots after the samples have been copied out. */
+        portMEMORY_BARRIER();
+        pxCore->ulTail = ulTail;
+
+        return xCount;
+    }
+/*-----------------------------------------------------------*/
+
+    void vSamplingProfilerGetStats( BaseType_t xCoreID,
+                                    ProfilerStats_t * pxStats )
+    {
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+        configASSERT( pxStats != NULL );
+
+        /* This only keeps the calling core from sampling during the copy, the
+         * other core may still update its own statistics. */
+        taskENTER_CRITICAL();
+        {
+            ( void ) memcpy( pxStats, &( xProfilerCores[ xCoreID ].xStats ), sizeof( ProfilerStats_t ) );
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vSamplingProfilerReset( void )
+    {
+        BaseType_t xCoreID;
+
+        taskENTER_CRITICAL();
+        {
+            for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+            {
+                ( void ) memset( &( xProfilerCores[ xCoreID ].xStats ), 0x00, sizeof( ProfilerStats_t ) );
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_SAMPLING_PROFILER == 1 */
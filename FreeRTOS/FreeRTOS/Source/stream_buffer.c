@@ -249,6 +249,10 @@ typedef struct StreamBufferDef_t
         StreamBufferCallbackFunction_t pxReceiveCompletedCallback; /* Optional callback called on receive complete.  sbRECEIVE_COMPLETED is called if this is NULL. */
     #endif
     UBaseType_t uxNotificationIndex;                               /* The index we are using for notification, by default tskDEFAULT_INDEX_TO_NOTIFY. */
+
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        ObjectMetrics_t xMetrics; /* Registry record, preserved across a reset. */
+    #endif
 } StreamBuffer_t;
 
 /*
@@ -405,6 +409,7 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           pxSendCompletedCallback,
                                           pxReceiveCompletedCallback );
 
+            objmetricsREGISTER( &( ( ( StreamBuffer_t * ) pvAllocatedMemory )->xMetrics ), pvAllocatedMemory, ( xStreamBufferType == sbTYPE_MESSAGE_BUFFER ) ? eObjectMetricsMessageBuffer : eObjectMetricsStreamBuffer, NULL );
             traceSTREAM_BUFFER_CREATE( ( ( StreamBuffer_t * ) pvAllocatedMemory ), xStreamBufferType );
         }
         else
@@ -499,6 +504,7 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
              * again. */
             pxStreamBuffer->ucFlags |= sbFLAGS_IS_STATICALLY_ALLOCATED;
 
+            objmetricsREGISTER( &( pxStreamBuffer->xMetrics ), pxStreamBuffer, ( xStreamBufferType == sbTYPE_MESSAGE_BUFFER ) ? eObjectMetricsMessageBuffer : eObjectMetricsStreamBuffer, NULL );
             traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xStreamBufferType );
 
             /* MISRA Ref 11.3.1 [Misaligned access] */
@@ -563,6 +569,7 @@ void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
     configASSERT( pxStreamBuffer );
 
     traceSTREAM_BUFFER_DELETE( xStreamBuffer );
+    objmetricsUNREGISTER( &( pxStreamBuffer->xMetrics ) );
 
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
     {
@@ -601,6 +608,10 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
         UBaseType_t uxStreamBufferNumber;
     #endif
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        ObjectMetrics_t xMetrics;
+    #endif
+
     traceENTER_xStreamBufferReset( xStreamBuffer );
 
     configASSERT( pxStreamBuffer );
@@ -625,6 +636,14 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                /* The record stays linked into the metrics registry, so it
+                 * must survive the reset. */
+                xMetrics = pxStreamBuffer->xMetrics;
+            }
+            #endif
+
             prvInitialiseNewStreamBuffer( pxStreamBuffer,
                                           pxStreamBuffer->pucBuffer,
                                           pxStreamBuffer->xLength,
@@ -639,6 +658,12 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                pxStreamBuffer->xMetrics = xMetrics;
+            }
+            #endif
+
             traceSTREAM_BUFFER_RESET( xStreamBuffer );
 
             xReturn = pdPASS;
@@ -663,6 +688,10 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
         UBaseType_t uxStreamBufferNumber;
     #endif
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        ObjectMetrics_t xMetrics;
+    #endif
+
     traceENTER_xStreamBufferResetFromISR( xStreamBuffer );
 
     configASSERT( pxStreamBuffer );
@@ -690,6 +719,14 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                /* The record stays linked into the metrics registry, so it
+                 * must survive the reset. */
+                xMetrics = pxStreamBuffer->xMetrics;
+            }
+            #endif
+
             prvInitialiseNewStreamBuffer( pxStreamBuffer,
                                           pxStreamBuffer->pucBuffer,
                                           pxStreamBuffer->xLength,
@@ -704,6 +741,12 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                pxStreamBuffer->xMetrics = xMetrics;
+            }
+            #endif
+
             traceSTREAM_BUFFER_RESET_FROM_ISR( xStreamBuffer );
 
             xReturn = pdPASS;
@@ -816,6 +859,11 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
     TimeOut_t xTimeOut;
     size_t xMaxReportedSpace = 0;
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        uint32_t ulWaitStart = 0U;
+        BaseType_t xWaited = pdFALSE;
+    #endif
+
     traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait );
 
     configASSERT( pvTxData );
@@ -893,6 +941,16 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
             }
             taskEXIT_CRITICAL();
 
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                if( xWaited == pdFALSE )
+                {
+                    objmetricsWAIT_START( ulWaitStart );
+                    xWaited = pdTRUE;
+                }
+            }
+            #endif
+
             traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
             ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
             pxStreamBuffer->xTaskWaitingToSend = NULL;
@@ -914,8 +972,26 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
 
     xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+    {
+        if( xWaited != pdFALSE )
+        {
+            objmetricsWAIT_END( &( pxStreamBuffer->xMetrics ), ulWaitStart, ( xReturn > ( size_t ) 0 ) ? eObjectMetricsWaitSatisfied : eObjectMetricsSendTimedOut );
+        }
+        else if( xReturn == ( size_t ) 0 )
+        {
+            objmetricsSEND_FAILED( &( pxStreamBuffer->xMetrics ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_OBJECT_METRICS */
+
     if( xReturn > ( size_t ) 0 )
     {
+        objmetricsSEND( &( pxStreamBuffer->xMetrics ), prvBytesInBuffer( pxStreamBuffer ) );
         traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
 
         /* Was a task waiting for the data? */
@@ -972,6 +1048,8 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
 
     if( xReturn > ( size_t ) 0 )
     {
+        objmetricsSEND( &( pxStreamBuffer->xMetrics ), prvBytesInBuffer( pxStreamBuffer ) );
+
         /* Was a task waiting for the data? */
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
@@ -987,7 +1065,7 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
     }
     else
     {
-        mtCOVERAGE_TEST_MARKER();
+        objmetricsSEND_FAILED( &( pxStreamBuffer->xMetrics ) );
     }
 
     traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
@@ -1058,6 +1136,11 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
     size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+        uint32_t ulWaitStart = 0U;
+        BaseType_t xWaited = pdFALSE;
+    #endif
+
     traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait );
 
     configASSERT( pvRxData );
@@ -1118,6 +1201,12 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         {
             /* Wait for data to be available. */
             traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                objmetricsWAIT_START( ulWaitStart );
+                xWaited = pdTRUE;
+            }
+            #endif
             ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
             pxStreamBuffer->xTaskWaitingToReceive = NULL;
 
@@ -1146,6 +1235,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         /* Was a task waiting for space in the buffer? */
         if( xReceivedLength != ( size_t ) 0 )
         {
+            objmetricsRECEIVE( &( pxStreamBuffer->xMetrics ) );
             traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
             prvRECEIVE_COMPLETED( xStreamBuffer );
         }
@@ -1160,6 +1250,23 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
+    #if ( configUSE_OBJECT_METRICS == 1 )
+    {
+        if( xWaited != pdFALSE )
+        {
+            objmetricsWAIT_END( &( pxStreamBuffer->xMetrics ), ulWaitStart, ( xReceivedLength != ( size_t ) 0 ) ? eObjectMetricsWaitSatisfied : eObjectMetricsReceiveTimedOut );
+        }
+        else if( xReceivedLength == ( size_t ) 0 )
+        {
+            objmetricsRECEIVE_FAILED( &( pxStreamBuffer->xMetrics ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_OBJECT_METRICS */
+
     traceRETURN_xStreamBufferReceive( xReceivedLength );
 
     return xReceivedLength;
@@ -1251,6 +1358,8 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
         /* Was a task waiting for space in the buffer? */
         if( xReceivedLength != ( size_t ) 0 )
         {
+            objmetricsRECEIVE( &( pxStreamBuffer->xMetrics ) );
+
             /* MISRA Ref 4.7.1 [Return value shall be checked] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
             /* coverity[misra_c_2012_directive_4_7_violation] */
@@ -1263,7 +1372,7 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
     }
     else
     {
-        mtCOVERAGE_TEST_MARKER();
+        objmetricsRECEIVE_FAILED( &( pxStreamBuffer->xMetrics ) );
     }
 
     traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength );
@@ -64,6 +64,14 @@
     #include <stdio.h>
 #endif /* configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) */
 
+/* The priority a task must be above to preempt pxTCB while it is running. */
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+    #define taskPREEMPTION_PRIORITY( pxTCB ) \
+    ( ( ( pxTCB )->uxPreemptionThreshold > ( pxTCB )->uxPriority ) ? ( pxTCB )->uxPreemptionThreshold : ( pxTCB )->uxPriority )
+#else
+    #define taskPREEMPTION_PRIORITY( pxTCB )    ( ( pxTCB )->uxPriority )
+#endif
+
 #if ( configUSE_PREEMPTION == 0 )
 
 /* If the cooperative scheduler is being used then a yield should not be
@@ -85,15 +93,15 @@
     } while( 0 )
 
         #define taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB ) \
-    do {                                                        \
-        if( pxCurrentTCB->uxPriority < ( pxTCB )->uxPriority )  \
-        {                                                       \
-            portYIELD_WITHIN_API();                             \
-        }                                                       \
-        else                                                    \
-        {                                                       \
-            mtCOVERAGE_TEST_MARKER();                           \
-        }                                                       \
+    do {                                                                      \
+        if( taskPREEMPTION_PRIORITY( pxCurrentTCB ) < ( pxTCB )->uxPriority ) \
+        {                                                                     \
+            portYIELD_WITHIN_API();                                           \
+        }                                                                     \
+        else                                                                  \
+        {                                                                     \
+            mtCOVERAGE_TEST_MARKER();                                         \
+        }                                                                     \
     } while( 0 )
 
     #else /* if ( configNUMBER_OF_CORES == 1 ) */
@@ -133,6 +141,20 @@
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    0
 #endif
 
+/* Stack fill elision only has an effect if new stacks are filled at all. */
+#if ( ( configUSE_STACK_FILL_ELISION == 1 ) && ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 ) )
+    #define taskUSE_STACK_FILL_ELISION    1
+
+/* Bytes at the limit of a stack that are filled however the stack is filled,
+ * which covers the words checked when configCHECK_FOR_STACK_OVERFLOW is 2. */
+    #define tskSTACK_FILL_GUARD_BYTES    ( ( size_t ) 32U )
+
+/* The most bytes the idle task fills from one critical section. */
+    #define tskSTACK_FILL_CHUNK_BYTES    ( ( size_t ) 256U )
+#else
+    #define taskUSE_STACK_FILL_ELISION    0
+#endif
+
 /*
  * Macros used by vListTask to indicate which state a task is in.
  */
@@ -281,12 +303,244 @@
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
-#define prvAddTaskToReadyList( pxTCB )                                                                     \
-    do {                                                                                                   \
-        traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
-        taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
-        listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
-        tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                      \
+#if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+    #define taskLATENCY_TASK_READY( pxTCB )    vLatencyHistogramTaskReady( &( ( pxTCB )->ulLatencyWakeStamp ) )
+#else
+    #define taskLATENCY_TASK_READY( pxTCB )
+#endif
+
+/* States of a job monitor.  A job is released when the task is made ready
+ * after completing the previous job, and starts when the task is next switched
+ * in. */
+#define taskJOB_WAITING     ( ( UBaseType_t ) 0U )
+#define taskJOB_RELEASED    ( ( UBaseType_t ) 1U )
+#define taskJOB_RUNNING     ( ( UBaseType_t ) 2U )
+
+#if ( configUSE_JOB_MONITOR == 1 )
+    #define taskJOB_TASK_READY( pxTCB )                 \
+    do {                                                \
+        if( ( pxTCB )->pxJobMonitor != NULL )           \
+        {                                               \
+            prvJobReleased( pxTCB );                    \
+        }                                               \
+    } while( 0 )
+    #define taskJOB_TASK_SWITCHED_IN( pxTCB, xCoreID )  \
+    do {                                                \
+        if( ( pxTCB )->pxJobMonitor != NULL )           \
+        {                                               \
+            prvJobStarted( ( pxTCB ), ( xCoreID ) );    \
+        }                                               \
+    } while( 0 )
+#else
+    #define taskJOB_TASK_READY( pxTCB )
+    #define taskJOB_TASK_SWITCHED_IN( pxTCB, xCoreID )
+#endif
+
+/* Features that charge tasks for the run time they use, and change their
+ * priority from the tick or a context switch. */
+#if ( ( configUSE_APERIODIC_SERVERS == 1 ) || ( configUSE_MIXED_CRITICALITY == 1 ) || ( configUSE_EXECUTION_BUDGETS == 1 ) || ( configUSE_TASK_GROUPS == 1 ) )
+    #define taskUSE_RUN_TIME_BUDGETS    1
+
+/* Wrap safe test of whether the run time counter has reached ulTime. */
+    #define taskRUN_TIME_REACHED( ulNow, ulTime ) \
+    ( ( ( configRUN_TIME_COUNTER_TYPE ) ( ( ulNow ) - ( ulTime ) ) ) <= ( ( ( configRUN_TIME_COUNTER_TYPE ) ~( configRUN_TIME_COUNTER_TYPE ) 0U ) >> 1U ) )
+#else
+    #define taskUSE_RUN_TIME_BUDGETS    0
+#endif
+
+#if ( configUSE_APERIODIC_SERVERS == 1 )
+    #define taskSERVER_TASK_SWITCHED_OUT( pxTCB, ulNow )                         \
+    do {                                                                         \
+        if( ( pxTCB )->pxAperiodicServer != NULL )                               \
+        {                                                                        \
+            prvServerSwitchedOut( ( pxTCB ), ( ulNow ) );                        \
+        }                                                                        \
+    } while( 0 )
+    #define taskSERVER_TASK_SWITCHED_IN( pxTCB, ulNow )                          \
+    do {                                                                         \
+        if( ( pxTCB )->pxAperiodicServer != NULL )                               \
+        {                                                                        \
+            prvServerSwitchedIn( ( pxTCB )->pxAperiodicServer, ( ulNow ) );      \
+        }                                                                        \
+    } while( 0 )
+#else
+    #define taskSERVER_TASK_SWITCHED_OUT( pxTCB, ulNow )
+    #define taskSERVER_TASK_SWITCHED_IN( pxTCB, ulNow )
+#endif
+
+#if ( configUSE_MIXED_CRITICALITY == 1 )
+    #define taskCRITICALITY_TASK_SWITCHED_OUT( pxTCB, ulNow )                    \
+    do {                                                                         \
+        if( ( pxTCB )->pxCriticality != NULL )                                   \
+        {                                                                        \
+            prvCriticalitySwitchedOut( ( pxTCB ), ( ulNow ) );                   \
+        }                                                                        \
+    } while( 0 )
+    #define taskCRITICALITY_TASK_SWITCHED_IN( pxTCB, ulNow )                     \
+    do {                                                                         \
+        if( ( pxTCB )->pxCriticality != NULL )                                   \
+        {                                                                        \
+            ( pxTCB )->pxCriticality->ulSwitchedInTime = ( ulNow );              \
+        }                                                                        \
+    } while( 0 )
+#else
+    #define taskCRITICALITY_TASK_SWITCHED_OUT( pxTCB, ulNow )
+    #define taskCRITICALITY_TASK_SWITCHED_IN( pxTCB, ulNow )
+#endif
+
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+    #define taskBUDGET_TASK_SWITCHED_OUT( pxTCB, ulNow )                         \
+    do {                                                                         \
+        if( ( pxTCB )->pxExecutionBudget != NULL )                               \
+        {                                                                        \
+            prvBudgetSwitchedOut( ( pxTCB ), ( ulNow ) );                        \
+        }                                                                        \
+    } while( 0 )
+    #define taskBUDGET_TASK_SWITCHED_IN( pxTCB, ulNow )                          \
+    do {                                                                         \
+        if( ( pxTCB )->pxExecutionBudget != NULL )                               \
+        {                                                                        \
+            prvBudgetSwitchedIn( ( pxTCB )->pxExecutionBudget, ( ulNow ) );      \
+        }                                                                        \
+    } while( 0 )
+#else
+    #define taskBUDGET_TASK_SWITCHED_OUT( pxTCB, ulNow )
+    #define taskBUDGET_TASK_SWITCHED_IN( pxTCB, ulNow )
+#endif
+
+#if ( configUSE_TASK_GROUPS == 1 )
+    #define taskGROUP_TASK_SWITCHED_OUT( pxTCB, ulNow )                          \
+    do {                                                                         \
+        if( ( pxTCB )->pxTaskGroup != NULL )                                     \
+        {                                                                        \
+            prvTaskGroupSwitchedOut( ( pxTCB ), ( ulNow ) );                     \
+        }                                                                        \
+    } while( 0 )
+    #define taskGROUP_TASK_SWITCHED_IN( pxTCB, ulNow )                           \
+    do {                                                                         \
+        ( pxTCB )->ulTaskGroupCharged = ( ulNow );                               \
+    } while( 0 )
+#else
+    #define taskGROUP_TASK_SWITCHED_OUT( pxTCB, ulNow )
+    #define taskGROUP_TASK_SWITCHED_IN( pxTCB, ulNow )
+#endif
+
+/* On a single core, remember the tasks preempted while running above their
+ * priority, so the scheduler resumes them ahead of the tasks they shut out. */
+#if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+    #define taskTHRESHOLD_TASK_SWITCHED_OUT( pxTCB )                   \
+    do {                                                               \
+        if( ( pxTCB )->uxPreemptionThreshold > ( pxTCB )->uxPriority ) \
+        {                                                              \
+            prvThresholdSwitchedOut( pxTCB );                          \
+        }                                                              \
+    } while( 0 )
+    #define taskTHRESHOLD_SELECT_PREEMPTED()    prvThresholdSelectPreempted()
+#else
+    #define taskTHRESHOLD_TASK_SWITCHED_OUT( pxTCB )
+    #define taskTHRESHOLD_SELECT_PREEMPTED()
+#endif
+
+/* Whether pxTCB is only kept out of the ready lists by its group, budget or
+ * criticality, rather than waiting for an event.  The trace recorder reports
+ * such a task as preempted.  An aperiodic server only lowers the priority of
+ * its task, which stays in the ready lists. */
+#if ( configUSE_TASK_GROUPS == 1 )
+    #define taskGROUP_IS_HOLDING( pxTCB )         \
+    ( ( ( pxTCB )->pxTaskGroup != NULL ) &&       \
+      ( listIS_CONTAINED_WITHIN( &( ( pxTCB )->pxTaskGroup->xHeldTasks ), &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) )
+#else
+    #define taskGROUP_IS_HOLDING( pxTCB )    ( pdFALSE )
+#endif
+
+#if ( ( configUSE_EXECUTION_BUDGETS == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+    #define taskBUDGET_IS_HOLDING( pxTCB )                                                \
+    ( ( ( pxTCB )->pxExecutionBudget != NULL ) &&                                         \
+      ( ( pxTCB )->pxExecutionBudget->xEnforced != pdFALSE ) &&                           \
+      ( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) )
+#else
+    #define taskBUDGET_IS_HOLDING( pxTCB )    ( pdFALSE )
+#endif
+
+#if ( ( configUSE_MIXED_CRITICALITY == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+    #define taskCRITICALITY_IS_HOLDING( pxTCB )                                           \
+    ( ( ( pxTCB )->pxCriticality != NULL ) &&                                             \
+      ( ( pxTCB )->pxCriticality->xHeld != pdFALSE ) &&                                   \
+      ( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) )
+#else
+    #define taskCRITICALITY_IS_HOLDING( pxTCB )    ( pdFALSE )
+#endif
+
+#define taskTASK_IS_THROTTLED( pxTCB ) \
+    ( ( taskGROUP_IS_HOLDING( pxTCB ) ) || ( taskBUDGET_IS_HOLDING( pxTCB ) ) || ( taskCRITICALITY_IS_HOLDING( pxTCB ) ) )
+
+/* Bracket changes to the fields of pxTCB that vTaskGetSnapshot() reads, so a
+ * reader that does not hold a critical section can detect that it raced with
+ * the change and try again.  Only called with interrupts masked. */
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+    #define taskSNAPSHOT_WRITE_BEGIN( pxTCB ) \
+    do {                                      \
+        ( pxTCB )->uxSnapshotSequence++;      \
+        portMEMORY_BARRIER();                 \
+    } while( 0 )
+    #define taskSNAPSHOT_WRITE_END( pxTCB )   \
+    do {                                      \
+        portMEMORY_BARRIER();                 \
+        ( pxTCB )->uxSnapshotSequence++;      \
+    } while( 0 )
+
+/* A task is moved between state lists with only the scheduler suspended, so
+ * an interrupt can find it in no list until the interrupted code carries on.
+ * The snapshot reports eInvalid after this many attempts instead of waiting. */
+    #define taskSNAPSHOT_MAX_ATTEMPTS    ( ( UBaseType_t ) 8U )
+#else
+    #define taskSNAPSHOT_WRITE_BEGIN( pxTCB )
+    #define taskSNAPSHOT_WRITE_END( pxTCB )
+#endif
+
+/* Everything that needs to know when a task becomes ready. */
+#define taskRECORD_TASK_READY( pxTCB )    \
+    do {                                  \
+        taskLATENCY_TASK_READY( pxTCB );  \
+        taskJOB_TASK_READY( pxTCB );      \
+    } while( 0 )
+
+#if ( configUSE_TASK_GROUPS == 1 )
+
+/* A task whose group has used up its budget is held in the group's list, and
+ * only enters its ready list once the budget is replenished. */
+    #define prvReinsertTaskInReadyList( pxTCB )                                                                    \
+    do {                                                                                                           \
+        traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                                   \
+        if( ( ( pxTCB )->pxTaskGroup != NULL ) && ( ( pxTCB )->pxTaskGroup->xDepleted != pdFALSE ) )               \
+        {                                                                                                          \
+            listINSERT_END( &( ( pxTCB )->pxTaskGroup->xHeldTasks ), &( ( pxTCB )->xStateListItem ) );             \
+        }                                                                                                          \
+        else                                                                                                       \
+        {                                                                                                          \
+            taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                    \
+            listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) );     \
+        }                                                                                                          \
+        tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                              \
+    } while( 0 )
+#else
+    #define prvReinsertTaskInReadyList( pxTCB )                                                                \
+    do {                                                                                                       \
+        traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                               \
+        taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                    \
+        listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) );     \
+        tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                          \
+    } while( 0 )
+#endif /* if ( configUSE_TASK_GROUPS == 1 ) */
+
+/* prvAddTaskToReadyList() makes a blocked, suspended or new task ready.
+ * prvReinsertTaskInReadyList() only moves a task that was already ready, for
+ * example after a priority change, so it does not count as a wake or a job
+ * release. */
+#define prvAddTaskToReadyList( pxTCB )          \
+    do {                                        \
+        taskRECORD_TASK_READY( pxTCB );         \
+        prvReinsertTaskInReadyList( pxTCB );    \
     } while( 0 )
 /*-----------------------------------------------------------*/
 
@@ -332,6 +586,13 @@
 /* Indicates that the task is an Idle task. */
 #define taskATTRIBUTE_IS_IDLE    ( UBaseType_t ) ( 1U << 0U )
 
+/* Returns pdTRUE if the task is an Idle task. */
+#if ( configNUMBER_OF_CORES == 1 )
+    #define taskTASK_IS_IDLE( pxTCB )    ( ( ( pxTCB ) == xIdleTaskHandles[ 0 ] ) ? ( pdTRUE ) : ( pdFALSE ) )
+#else
+    #define taskTASK_IS_IDLE( pxTCB )    ( ( ( ( pxTCB )->uxTaskAttributes & taskATTRIBUTE_IS_IDLE ) != 0U ) ? ( pdTRUE ) : ( pdFALSE ) )
+#endif
+
 #if ( ( configNUMBER_OF_CORES > 1 ) && ( portCRITICAL_NESTING_IN_TCB == 1 ) )
     #define portGET_CRITICAL_NESTING_COUNT( xCoreID )          ( pxCurrentTCBs[ ( xCoreID ) ]->uxCriticalNesting )
     #define portSET_CRITICAL_NESTING_COUNT( xCoreID, x )       ( pxCurrentTCBs[ ( xCoreID ) ]->uxCriticalNesting = ( x ) )
@@ -341,6 +602,20 @@
 
 #define taskBITS_PER_BYTE    ( ( size_t ) 8 )
 
+#if ( configUSE_SMP_STATS == 1 )
+
+/* Count a yield request sent by this core and note when it was sent, so the
+ * receiving core can work out how long it took to act on it.  Called with the
+ * ISR lock held, as is the code in vTaskSwitchContext() that reads the time. */
+    #define taskSMP_STATS_YIELD_REQUESTED( xCoreID )                       \
+    do {                                                                   \
+        xCoreSMPStats[ portGET_CORE_ID() ].ulYieldRequestsSent++;          \
+        ulYieldRequestTime[ ( xCoreID ) ] = portSMP_STATS_TIMESTAMP();     \
+    } while( 0 )
+#else
+    #define taskSMP_STATS_YIELD_REQUESTED( xCoreID )
+#endif
+
 #if ( configNUMBER_OF_CORES > 1 )
 
 /* Yields the given core. This must be called from a critical section and xCoreID
@@ -358,6 +633,8 @@
             /* Request other core to yield if it is not requested before. */                 \
             if( pxCurrentTCBs[ ( xCoreID ) ]->xTaskRunState != taskTASK_SCHEDULED_TO_YIELD ) \
             {                                                                                \
+                taskSMP_STATS_YIELD_REQUESTED( xCoreID );                                    \
+                traceYIELD_CORE_REQUESTED( xCoreID );                                        \
                 portYIELD_CORE( xCoreID );                                                   \
                 pxCurrentTCBs[ ( xCoreID ) ]->xTaskRunState = taskTASK_SCHEDULED_TO_YIELD;   \
             }                                                                                \
@@ -366,6 +643,49 @@
 #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TCB_COLD_BLOCK == 1 )
+
+/*
+ * The part of the task control block that is not used to schedule tasks.  It
+ * is allocated separately from the TCB when configUSE_TCB_COLD_BLOCK is 1, so
+ * the TCBs the scheduler walks are smaller and touch fewer cache lines and
+ * memory banks.  Access it through taskCOLD().
+ */
+    typedef struct tskTaskControlBlockCold
+    {
+        #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+            void * pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+        #endif
+
+        #if ( configUSE_TRACE_FACILITY == 1 )
+            UBaseType_t uxTCBNumber;  /**< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
+            UBaseType_t uxTaskNumber; /**< Stores a number specifically for use by third party trace code. */
+        #endif
+
+        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+            configTLS_BLOCK_TYPE xTLSBlock; /**< Memory block used as Thread Local Storage (TLS) Block for the task. */
+        #endif
+
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+
+        #if ( configUSE_POSIX_ERRNO == 1 )
+            int iTaskErrno;
+        #endif
+
+        char pcTaskName[ configMAX_TASK_NAME_LEN ]; /**< Descriptive name given to the task when created.  Facilitates debugging only. */
+
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+        #endif
+    } TCBCold_t;
+
+    #define taskCOLD( pxTCB )    ( ( pxTCB )->pxCold )
+#else
+    #define taskCOLD( pxTCB )    ( pxTCB )
+#endif /* configUSE_TCB_COLD_BLOCK */
+
 /*
  * Task control block.  A task control block (TCB) is allocated for each task,
  * and stores task state information, including a pointer to the task's context
@@ -391,12 +711,21 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         volatile BaseType_t xTaskRunState;      /**< Used to identify the core the task is running on, if the task is running. Otherwise, identifies the task's state - not running or yielding. */
         UBaseType_t uxTaskAttributes;           /**< Task's attributes - currently used to identify the idle tasks. */
     #endif
-    char pcTaskName[ configMAX_TASK_NAME_LEN ]; /**< Descriptive name given to the task when created.  Facilitates debugging only. */
+    #if ( configUSE_TCB_COLD_BLOCK == 0 )
+        char pcTaskName[ configMAX_TASK_NAME_LEN ]; /**< Descriptive name given to the task when created.  Facilitates debugging only. */
+    #endif
 
     #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
         BaseType_t xPreemptionDisable; /**< Used to prevent the task from being preempted. */
     #endif
 
+    #if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+        UBaseType_t uxPreemptionThreshold; /**< Only tasks above this priority, or uxPriority if higher, preempt the task. */
+        #if ( configNUMBER_OF_CORES == 1 )
+            struct tskTaskControlBlock * pxNextPreempted; /**< Next task of the list of preempted tasks. */
+        #endif
+    #endif
+
     #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
         StackType_t * pxEndOfStack; /**< Points to the highest valid address for the stack. */
     #endif
@@ -405,7 +734,7 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         UBaseType_t uxCriticalNesting; /**< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
     #endif
 
-    #if ( configUSE_TRACE_FACILITY == 1 )
+    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         UBaseType_t uxTCBNumber;  /**< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
         UBaseType_t uxTaskNumber; /**< Stores a number specifically for use by third party trace code. */
     #endif
@@ -419,7 +748,7 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         TaskHookFunction_t pxTaskTag;
     #endif
 
-    #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+    #if ( ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         void * pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
     #endif
 
@@ -427,11 +756,64 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /**< Stores the amount of time the task has spent in the Running state. */
     #endif
 
-    #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+    #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+        uint32_t ulLatencyWakeStamp; /**< Time an interrupt readied the task, or 0.  Used for the eLatencyISRToTask histogram. */
+    #endif
+
+    #if ( configUSE_JOB_MONITOR == 1 )
+        JobMonitor_t * pxJobMonitor; /**< Job monitor attached with vTaskSetJobMonitor(), or NULL. */
+    #endif
+
+    #if ( configUSE_APERIODIC_SERVERS == 1 )
+        AperiodicServer_t * pxAperiodicServer; /**< Server attached with vTaskSetAperiodicServer(), or NULL. */
+    #endif
+
+    #if ( configUSE_MIXED_CRITICALITY == 1 )
+        Criticality_t * pxCriticality; /**< Criticality set with vTaskSetCriticality(), or NULL. */
+    #endif
+
+    #if ( configUSE_EXECUTION_BUDGETS == 1 )
+        ExecutionBudget_t * pxExecutionBudget; /**< Budget set with vTaskSetExecutionBudget(), or NULL. */
+    #endif
+
+    #if ( configUSE_TASK_GROUPS == 1 )
+        TaskGroup_t * pxTaskGroup;                          /**< Group set with vTaskSetTaskGroup(), or NULL. */
+        struct tskTaskControlBlock * pxNextTaskGroupMember; /**< Next task in the same group. */
+        configRUN_TIME_COUNTER_TYPE ulTaskGroupCharged;     /**< Time the group was last charged for this task. */
+    #endif
+
+    #if ( configUSE_IDLE_GOVERNOR == 1 )
+        configRUN_TIME_COUNTER_TYPE ulWakeLatency;      /**< Set with vTaskSetWakeLatency(), or 0. */
+        struct tskTaskControlBlock * pxNextWakeLatency; /**< Next task with a wake latency. */
+    #endif
+
+    #if ( configUSE_STACK_FILL_ELISION == 1 )
+        struct tskTaskControlBlock * pxNextStackFill; /**< Next task whose stack the idle task has to fill. */
+    #endif
+
+    #if ( configUSE_SAMPLED_STACK_HIGH_WATER_MARK == 1 )
+        volatile StackType_t * pxStackHighWaterMark; /**< Deepest saved stack pointer seen when the task was switched out. */
+    #endif
+
+    #if ( tskUSE_TASK_REGISTRY == 1 )
+        ListItem_t xRegistryListItem; /**< Used to reference the task from the list of all tasks. */
+    #endif
+
+    #if ( configUSE_TASK_SNAPSHOT == 1 )
+        volatile UBaseType_t uxSnapshotSequence; /**< Odd while the kernel is changing the fields read by vTaskGetSnapshot(). */
+    #endif
+
+    #if ( configUSE_SMP_STATS == 1 )
+        BaseType_t xLastRunCore;  /**< Core the task last ran on, or taskTASK_NOT_RUNNING if it has never run. */
+        uint32_t ulMigrations;    /**< Times the task was switched in on a different core than xLastRunCore. */
+        uint32_t ulYieldRequests; /**< Times another core asked the core running the task to reschedule. */
+    #endif
+
+    #if ( ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         configTLS_BLOCK_TYPE xTLSBlock; /**< Memory block used as Thread Local Storage (TLS) Block for the task. */
     #endif
 
-    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+    #if ( ( configUSE_TASK_NOTIFICATIONS == 1 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
         volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
     #endif
@@ -446,9 +828,17 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         uint8_t ucDelayAborted;
     #endif
 
-    #if ( configUSE_POSIX_ERRNO == 1 )
+    #if ( configUSE_TIME_TRIGGERED == 1 )
+        uint8_t ucTimeTriggeredWaiting; /**< Set to pdTRUE while the task waits in vTaskWaitForTableRelease(). */
+    #endif
+
+    #if ( ( configUSE_POSIX_ERRNO == 1 ) && ( configUSE_TCB_COLD_BLOCK == 0 ) )
         int iTaskErrno;
     #endif
+
+    #if ( configUSE_TCB_COLD_BLOCK == 1 )
+        struct tskTaskControlBlockCold * pxCold; /**< The fields the scheduler does not use, see TCBCold_t. */
+    #endif
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -492,6 +882,24 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Ta
 
 #endif
 
+#if ( tskUSE_TASK_REGISTRY == 1 )
+
+/* Every task that exists, in the order they were created.  Each item value is
+ * the uxTaskNumber of the task's creation, so a walk that has to restart can
+ * skip the tasks it has already visited. */
+    PRIVILEGED_DATA static List_t xTaskRegistry;
+
+/* Position of a walk through xTaskRegistry that does not hold a critical
+ * section between steps.  See prvTaskRegistryNext(). */
+    typedef struct xTASK_REGISTRY_CURSOR
+    {
+        const ListItem_t * pxItem; /**< The next item to visit. */
+        UBaseType_t uxGeneration;  /**< uxTaskNumber when pxItem was read. */
+        TickType_t xLastVisited;   /**< Item value of the last task returned, 0 if none. */
+    } TaskRegistryCursor_t;
+
+#endif
+
 /* Global POSIX errno. Its value is changed upon context switching to match
  * the errno of the currently running task. */
 #if ( configUSE_POSIX_ERRNO == 1 )
@@ -538,6 +946,112 @@ PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTime[ conf
 
 #endif
 
+#if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+
+/* Each core only updates its own counters, with interrupts masked, and bumps
+ * its uxCoreRunTimeSequence before and after doing so.  Readers on either core
+ * retry while the sequence is odd or has changed, so they never need a lock. */
+PRIVILEGED_DATA static volatile UBaseType_t uxCoreRunTimeSequence[ configNUMBER_OF_CORES ] = { 0U };                         /**< Odd while the core is updating its counters. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulCoreRunTimeOrigin = 0U;                                                  /**< Run time counter value when the scheduler started. */
+PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulCoreIdleTime[ configNUMBER_OF_CORES ] = { 0U };                 /**< Time each core spent in an idle task, excluding interrupts. */
+PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulCoreISRTime[ configNUMBER_OF_CORES ] = { 0U };                  /**< Time each core spent in instrumented interrupts. */
+PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulCoreISRTimeSinceSwitchedIn[ configNUMBER_OF_CORES ] = { 0U };   /**< Interrupt time to deduct from the task currently running on each core. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulCoreISREnterTime[ configNUMBER_OF_CORES ] = { 0U };                      /**< Counter value when the outermost instrumented interrupt was entered. */
+PRIVILEGED_DATA static UBaseType_t uxCoreISRNesting[ configNUMBER_OF_CORES ] = { 0U };                                        /**< Instrumented interrupt nesting depth of each core. */
+
+#endif
+
+#if ( configUSE_SMP_STATS == 1 )
+
+/* Only written with the ISR lock held, by a core sending a yield request or by
+ * a core rescheduling. */
+PRIVILEGED_DATA static CoreSMPStats_t xCoreSMPStats[ configNUMBER_OF_CORES ];                /**< Migration and cross-core yield counters of each core. */
+PRIVILEGED_DATA static uint32_t ulYieldRequestTime[ configNUMBER_OF_CORES ] = { 0U };     /**< When the last yield request was sent to each core. */
+
+#endif
+
+#if ( configUSE_APERIODIC_SERVERS == 1 )
+
+/* Only accessed with the ready lists locked. */
+PRIVILEGED_DATA static AperiodicServer_t * pxAperiodicServers = NULL; /**< Every attached aperiodic server, checked on each tick. */
+
+#endif
+
+#if ( configUSE_MIXED_CRITICALITY == 1 )
+
+/* Only accessed with the ready lists locked. */
+PRIVILEGED_DATA static Criticality_t * pxCriticalityTasks = NULL;                   /**< Every task given a criticality, checked on each tick. */
+PRIVILEGED_DATA static volatile eCriticalityLevel eCriticalityMode = eCriticalityLow; /**< The current criticality mode of the system. */
+PRIVILEGED_DATA static CriticalityStats_t xCriticalityStats;                        /**< Returned by vTaskGetCriticalityStats(). */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulCriticalityHighModeStart = 0U; /**< Time the current high criticality mode began. */
+
+#endif
+
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+
+/* Only accessed with the ready lists locked. */
+PRIVILEGED_DATA static ExecutionBudget_t * pxExecutionBudgets = NULL; /**< Every task given a budget, replenished from the tick. */
+
+#endif
+
+#if ( configUSE_TASK_GROUPS == 1 )
+
+/* Only accessed with the ready lists locked. */
+PRIVILEGED_DATA static TaskGroup_t * pxTaskGroups = NULL; /**< Every group, replenished from the tick. */
+
+#endif
+
+#if ( configUSE_TIME_TRIGGERED == 1 )
+
+/* Only accessed from the tick, or with the ready lists locked. */
+PRIVILEGED_DATA static const TimeTriggeredTable_t * pxTimeTriggeredTable = NULL; /**< Table being dispatched, or NULL. */
+PRIVILEGED_DATA static TaskHandle_t const * pxTimeTriggeredTasks = NULL;          /**< Tasks the entries of the table refer to. */
+PRIVILEGED_DATA static UBaseType_t uxTimeTriggeredTasks = ( UBaseType_t ) 0;      /**< Length of pxTimeTriggeredTasks. */
+PRIVILEGED_DATA static TickType_t xTimeTriggeredTime = ( TickType_t ) 0;          /**< Offset within the hyperperiod of the next tick. */
+PRIVILEGED_DATA static UBaseType_t uxTimeTriggeredNext = ( UBaseType_t ) 0;       /**< Next entry of the table to dispatch. */
+PRIVILEGED_DATA static TimeTriggeredStats_t xTimeTriggeredStats;                  /**< Returned by vTaskGetTimeTriggeredStats(). */
+
+#endif
+
+#if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+
+/* Only accessed from a context switch, or with the ready lists locked. */
+PRIVILEGED_DATA static TCB_t * pxThresholdPreempted = NULL; /**< Tasks preempted above their priority, most recent first. */
+
+#endif
+
+#if ( configUSE_IDLE_GOVERNOR == 1 )
+
+/* Read by the idle tasks without a critical section.  The states are only
+ * set before the scheduler starts, and each core only updates its own
+ * statistics. */
+PRIVILEGED_DATA static const IdleState_t * pxIdleStates = NULL;                                                 /**< Set with vTaskSetIdleStates(). */
+PRIVILEGED_DATA static UBaseType_t uxIdleStates = ( UBaseType_t ) 0U;                                           /**< Number of states in pxIdleStates. */
+PRIVILEGED_DATA static volatile IdleGovernorFunction_t pxIdleGovernor = NULL;                                   /**< Set with vTaskSetIdleGovernor(), NULL for the default governor. */
+PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulWakeLatencyLimit = ~( configRUN_TIME_COUNTER_TYPE ) 0U; /**< Shortest latency in pxWakeLatencyTasks. */
+PRIVILEGED_DATA static TCB_t * pxWakeLatencyTasks = NULL;                                                       /**< Tasks with a wake latency, only accessed from a critical section. */
+PRIVILEGED_DATA static IdleStateStats_t xIdleStateStats[ configNUMBER_OF_CORES ][ configIDLE_GOVERNOR_MAX_STATES ];
+
+#endif
+
+#if ( taskUSE_STACK_FILL_ELISION == 1 )
+
+/* Only accessed from a critical section.  A fill in progress is always that of
+ * the first task in the list. */
+PRIVILEGED_DATA static TCB_t * pxStackFillTasks = NULL;     /**< Tasks whose stack the idle task has yet to fill. */
+PRIVILEGED_DATA static uint8_t * pucStackFillCursor = NULL; /**< Next byte the idle task fills in the stack of pxStackFillTasks, or NULL if it has not started. */
+
+#endif
+
+#if ( configTCB_POOL_LENGTH > 0 )
+
+/* TCBs of dynamically created tasks are taken from here while any are free,
+ * so the TCBs walked by the scheduler sit next to each other. */
+static TCB_t xTCBPool[ configTCB_POOL_LENGTH ] configTCB_POOL_ATTRIBUTE;
+PRIVILEGED_DATA static uint8_t ucTCBPoolUsed[ configTCB_POOL_LENGTH ]; /**< pdTRUE for the entries of xTCBPool in use, only accessed from a critical section. */
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* File private functions. --------------------------------*/
@@ -698,91 +1212,452 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
-#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+#if ( configUSE_CORE_RUN_TIME_STATS == 1 )
 
 /*
- * Helper function used to pad task names with spaces when printing out
- * human readable tables of task information.
+ * Charge the slice that just ended on core xCoreID to pxTCB, less any time
+ * spent in instrumented interrupts, and to the core's idle time if pxTCB is an
+ * idle task.  Called from vTaskSwitchContext() with interrupts masked.
  */
-    static char * prvWriteNameToBuffer( char * pcBuffer,
-                                        const char * pcTaskName ) PRIVILEGED_FUNCTION;
+    static void prvAccountCoreRunTime( BaseType_t xCoreID,
+                                       TCB_t * pxTCB,
+                                       configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configUSE_SMP_STATS == 1 )
+
 /*
- * Called after a Task_t structure has been allocated either statically or
- * dynamically to fill in the structure's members.
+ * Update the migration and cross-core yield counters after core xCoreID has
+ * selected a task.  pxPreviousTCB is the task that was running before, and
+ * xYieldRequested is pdTRUE if another core had asked this one to reschedule.
+ * Called from vTaskSwitchContext() with the ISR lock held.
  */
-static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
-                                  const char * const pcName,
-                                  const configSTACK_DEPTH_TYPE uxStackDepth,
-                                  void * const pvParameters,
-                                  UBaseType_t uxPriority,
-                                  TaskHandle_t * const pxCreatedTask,
-                                  TCB_t * pxNewTCB,
-                                  const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+    static void prvSMPStatsTaskSwitched( BaseType_t xCoreID,
+                                         TCB_t * pxPreviousTCB,
+                                         BaseType_t xYieldRequested ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_JOB_MONITOR == 1 )
 
 /*
- * Called after a new task has been created and initialised to place the task
- * under the control of the scheduler.
+ * Job monitor transitions.  prvJobReleased() is called when pxTCB is made
+ * ready and prvJobStarted() when it is switched in on core xCoreID, both with
+ * the ready lists locked.  prvJobComplete() is called by the task itself at the
+ * end of a job and calls the deadline miss hook if the job was late.
  */
-static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+    static void prvJobReleased( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvJobStarted( TCB_t * pxTCB,
+                               BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+    static void prvJobComplete( TickType_t xPeriod,
+                                TickType_t xNextReleaseTick ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( taskUSE_RUN_TIME_BUDGETS == 1 ) || ( configUSE_IDLE_GOVERNOR == 1 ) )
 
 /*
- * Create a task with static buffer for both TCB and stack. Returns a handle to
- * the task if it is created successfully. Otherwise, returns NULL.
+ * The current value of the run time counter.
  */
-#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
-    static TCB_t * prvCreateStaticTask( TaskFunction_t pxTaskCode,
-                                        const char * const pcName,
-                                        const configSTACK_DEPTH_TYPE uxStackDepth,
-                                        void * const pvParameters,
-                                        UBaseType_t uxPriority,
-                                        StackType_t * const puxStackBuffer,
-                                        StaticTask_t * const pxTaskBuffer,
-                                        TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
-#endif /* #if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+    static configRUN_TIME_COUNTER_TYPE prvGetRunTimeNow( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( taskUSE_RUN_TIME_BUDGETS == 1 )
 
 /*
- * Create a restricted task with static buffer for both TCB and stack. Returns
- * a handle to the task if it is created successfully. Otherwise, returns NULL.
+ * Move pxTCB to uxNewPriority without yielding, the caller decides whether a
+ * yield is needed.  An inherited priority is left in place.
  */
-#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
-    static TCB_t * prvCreateRestrictedStaticTask( const TaskParameters_t * const pxTaskDefinition,
-                                                  TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
-#endif /* #if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+    #if ( ( configUSE_APERIODIC_SERVERS == 1 ) || ( configUSE_MIXED_CRITICALITY == 1 ) || ( configUSE_EXECUTION_BUDGETS == 1 ) )
+        static void prvSetPriorityWithoutYield( TCB_t * pxTCB,
+                                                UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+    #endif
 
 /*
- * Create a restricted task with static buffer for task stack and allocated buffer
- * for TCB. Returns a handle to the task if it is created successfully. Otherwise,
- * returns NULL.
+ * Move pxTCB to, or back from, the Suspended state as vTaskSuspend() and
+ * vTaskResume() would, but without yielding.  prvSuspendWithoutYield() does
+ * nothing and returns pdFALSE if the task is already suspended.
+ * prvResumeWithoutYield() does nothing if the task is no longer suspended.
  */
-#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
-    static TCB_t * prvCreateRestrictedTask( const TaskParameters_t * const pxTaskDefinition,
-                                            TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
-#endif /* #if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+    #if ( ( INCLUDE_vTaskSuspend == 1 ) && ( ( configUSE_MIXED_CRITICALITY == 1 ) || ( configUSE_EXECUTION_BUDGETS == 1 ) ) )
+        static BaseType_t prvSuspendWithoutYield( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+        static void prvResumeWithoutYield( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    #endif
+
+#endif
+
+#if ( configUSE_APERIODIC_SERVERS == 1 )
 
 /*
- * Create a task with allocated buffer for both TCB and stack. Returns a handle to
- * the task if it is created successfully. Otherwise, returns NULL.
+ * Aperiodic server transitions, all called with the ready lists locked.
+ * ulNow is the current run time counter value.  prvServerSwitchedOut() charges
+ * pxTCB for the time it ran and drops it to its low priority if that used up
+ * its budget, before the next task is selected.  prvServerSwitchedIn() starts
+ * charging the task that was selected.  prvServersTick() charges the running
+ * tasks and applies the replenishments that are due; it returns pdTRUE if
+ * the task running on this core should yield.
  */
-#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
-    static TCB_t * prvCreateTask( TaskFunction_t pxTaskCode,
-                                  const char * const pcName,
-                                  const configSTACK_DEPTH_TYPE uxStackDepth,
-                                  void * const pvParameters,
-                                  UBaseType_t uxPriority,
-                                  TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
-#endif /* #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+    static void prvServerSwitchedOut( TCB_t * pxTCB,
+                                      configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static void prvServerSwitchedIn( AperiodicServer_t * pxServer,
+                                     configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvServersTick( void ) PRIVILEGED_FUNCTION;
 
 /*
- * freertos_tasks_c_additions_init() should only be called if the user definable
- * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
- * called by the function.
+ * Remove pxServer from the list of attached servers.
  */
-#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
-
-    static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+    static void prvServerUnlink( const AperiodicServer_t * pxServer ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_MIXED_CRITICALITY == 1 )
+
+/*
+ * Mixed criticality transitions, all called with the ready lists locked.
+ * prvCriticalityCharge() adds the time since the task was last charged to its
+ * current job, and returns pdTRUE if a high criticality task has just overrun
+ * its low criticality budget.  prvCriticalitySwitchedOut() charges pxTCB, ends
+ * its job if it blocked, and switches the mode as needed before the next task
+ * is selected.  prvCriticalityTick() does the same for the running tasks, and
+ * returns pdTRUE if the task running on this core should yield.
+ */
+    static BaseType_t prvCriticalityCharge( Criticality_t * pxCriticality,
+                                            configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static void prvCriticalitySwitchedOut( TCB_t * pxTCB,
+                                           configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvCriticalityTick( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Enter eMode, holding (degrading or suspending) every low criticality task
+ * when entering high criticality mode, and releasing them again when leaving
+ * it.
+ */
+    static void prvCriticalitySetMode( eCriticalityLevel eMode,
+                                       configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static void prvCriticalityHold( Criticality_t * pxCriticality ) PRIVILEGED_FUNCTION;
+
+    static void prvCriticalityRelease( Criticality_t * pxCriticality ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the application suspends or resumes pxTCB itself.  A task held
+ * in the Suspended state is then no longer resumed when it is released.
+ */
+    #if ( INCLUDE_vTaskSuspend == 1 )
+        static void prvCriticalitySuspendOverridden( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*
+ * Returns pdTRUE if any high criticality task is ready or running.
+ */
+    static BaseType_t prvCriticalityHighTaskReady( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove pxCriticality from the list of tasks with a criticality.
+ */
+    static void prvCriticalityUnlink( const Criticality_t * pxCriticality ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+
+/*
+ * Execution budget transitions, all called with the ready lists locked.
+ * prvBudgetCharge() takes the time since the task was last charged off its
+ * budget.  prvBudgetEnforce() applies the budget action to a task that has
+ * used up its budget, and returns pdTRUE if that means the task must stop
+ * running.  prvBudgetRestore() undoes that action.  prvBudgetSwitchedOut() and
+ * prvBudgetSwitchedIn() stop and start the execution timer around a context
+ * switch.  prvBudgetsTick() charges the running tasks, in case the port has no
+ * execution timer, and replenishes the budgets that are due; it returns
+ * pdTRUE if the task running on this core should yield.
+ */
+    static void prvBudgetCharge( ExecutionBudget_t * pxBudget,
+                                 configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvBudgetEnforce( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvBudgetRestore( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the application suspends or resumes pxTCB itself.  A task the
+ * budget suspended is then no longer resumed when the budget is replenished.
+ */
+    #if ( INCLUDE_vTaskSuspend == 1 )
+        static void prvBudgetSuspendOverridden( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    #endif
+
+    static void prvBudgetSwitchedOut( TCB_t * pxTCB,
+                                      configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static void prvBudgetSwitchedIn( ExecutionBudget_t * pxBudget,
+                                     configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvBudgetsTick( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if pxTCB is running on this core.  If it is running on
+ * another core that core is asked to yield instead.
+ */
+    static BaseType_t prvBudgetYield( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove pxBudget from the list of tasks with a budget.
+ */
+    static void prvBudgetUnlink( const ExecutionBudget_t * pxBudget ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TASK_GROUPS == 1 )
+
+/*
+ * Task group transitions, all called with the ready lists locked.
+ * prvTaskGroupCharge() takes the time pxTCB ran since it was last charged off
+ * the budget of its group.  prvTaskGroupDeplete() moves every ready member of
+ * a group that has used up its budget to the group's held list, and
+ * prvTaskGroupReplenish() moves them back.  prvTaskGroupHoldTask() holds a
+ * single member.  These return pdTRUE if the task running on this core should
+ * yield, and ask other cores to yield as needed.  prvTaskGroupsTick() charges
+ * the running members and applies the depletions and replenishments that are
+ * due.
+ */
+    static void prvTaskGroupCharge( TCB_t * pxTCB,
+                                    configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvTaskGroupHoldTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvTaskGroupDeplete( TaskGroup_t * pxGroup ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvTaskGroupReplenish( TaskGroup_t * pxGroup ) PRIVILEGED_FUNCTION;
+
+    static void prvTaskGroupSwitchedOut( TCB_t * pxTCB,
+                                         configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvTaskGroupsTick( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove pxTCB from its group, charging the group for the time it has run.
+ */
+    static void prvTaskGroupLeave( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TIME_TRIGGERED == 1 )
+
+/*
+ * Called from the tick.  prvTimeTriggeredTick() releases the tasks of the
+ * table entries at the current offset and advances the offset.
+ * prvTimeTriggeredRelease() moves one task waiting in
+ * vTaskWaitForTableRelease() to its ready list.  Both return pdTRUE if the
+ * task running on this core should yield.
+ */
+    static BaseType_t prvTimeTriggeredTick( void ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvTimeTriggeredRelease( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+
+/*
+ * Called from vTaskSwitchContext().  prvThresholdSwitchedOut() records pxTCB
+ * as preempted if it is still ready.  prvThresholdSelectPreempted() replaces
+ * the task chosen by taskSELECT_HIGHEST_PRIORITY_TASK() with the most recently
+ * preempted task if the chosen task is not above its threshold.
+ */
+    static void prvThresholdSwitchedOut( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvThresholdSelectPreempted( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove pxTCB from the list of preempted tasks, if it is in it.  Called
+ * whenever a task leaves the ready state other than by running, so a task
+ * that is readied again later is not taken for a preempted one.
+ */
+    static void prvThresholdRemove( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_IDLE_GOVERNOR == 1 )
+
+/*
+ * Called from the idle tasks.  Puts the calling core in the idle state chosen
+ * by the governor until an interrupt is pending, unless the core has other
+ * work to do.
+ */
+    static void prvIdleGovernorRun( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * The governor used until vTaskSetIdleGovernor() sets another.
+ */
+    static UBaseType_t prvIdleGovernorDefault( const IdleState_t * pxStates,
+                                               UBaseType_t uxStates,
+                                               TickType_t xExpectedIdleTime,
+                                               configRUN_TIME_COUNTER_TYPE ulLatencyLimit );
+
+/*
+ * Remove pxTCB from the tasks with a wake latency, and recompute the latency
+ * limit.  Called from a critical section.
+ */
+    static void prvWakeLatencyRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( taskUSE_STACK_FILL_ELISION == 1 )
+
+/*
+ * Fill the unused part of the stack of a new task as eFill says, before the
+ * task is placed under the control of the scheduler.
+ */
+    static void prvStackFillNew( TCB_t * pxTCB,
+                                 eTaskStackFill eFill ) PRIVILEGED_FUNCTION;
+
+/*
+ * Fill the next chunk of the stacks left to the idle task.  Returns pdTRUE if
+ * anything was filled.
+ */
+    static BaseType_t prvStackFillIdle( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove pxTCB from the tasks whose stack the idle task has to fill.  Called
+ * from a critical section.
+ */
+    static void prvStackFillRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( tskUSE_TASK_REGISTRY == 1 )
+
+/*
+ * Return the next task of a registry walk, or NULL once every task has been
+ * visited.  Must be called from a critical section, and the returned TCB may
+ * only be used until that critical section is exited.
+ */
+    static TCB_t * prvTaskRegistryNext( TaskRegistryCursor_t * pxCursor ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+
+/*
+ * Fill *pxSnapshot from pxTCB without taking a lock.  Retries until it has
+ * read the fields without a change to the task in between.
+ */
+    static void prvTaskFillSnapshot( const TCB_t * pxTCB,
+                                     TaskSnapshot_t * pxSnapshot ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+/*
+ * Helper function used to pad task names with spaces when printing out
+ * human readable tables of task information.
+ */
+    static char * prvWriteNameToBuffer( char * pcBuffer,
+                                        const char * pcTaskName ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called after a Task_t structure has been allocated either statically or
+ * dynamically to fill in the structure's members.
+ */
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
+                                  const char * const pcName,
+                                  const configSTACK_DEPTH_TYPE uxStackDepth,
+                                  void * const pvParameters,
+                                  UBaseType_t uxPriority,
+                                  TaskHandle_t * const pxCreatedTask,
+                                  TCB_t * pxNewTCB,
+                                  const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after a new task has been created and initialised to place the task
+ * under the control of the scheduler.
+ */
+static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * The part of prvAddNewTaskToReadyList() done from the critical section, also
+ * used by xTaskCreateMultiple() to add several tasks from one critical section.
+ */
+static void prvLinkNewTask( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Create a task with static buffer for both TCB and stack. Returns a handle to
+ * the task if it is created successfully. Otherwise, returns NULL.
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    static TCB_t * prvCreateStaticTask( TaskFunction_t pxTaskCode,
+                                        const char * const pcName,
+                                        const configSTACK_DEPTH_TYPE uxStackDepth,
+                                        void * const pvParameters,
+                                        UBaseType_t uxPriority,
+                                        StackType_t * const puxStackBuffer,
+                                        StaticTask_t * const pxTaskBuffer,
+                                        TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif /* #if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+
+/*
+ * Create a restricted task with static buffer for both TCB and stack. Returns
+ * a handle to the task if it is created successfully. Otherwise, returns NULL.
+ */
+#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    static TCB_t * prvCreateRestrictedStaticTask( const TaskParameters_t * const pxTaskDefinition,
+                                                  TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif /* #if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+
+/*
+ * Create a restricted task with static buffer for task stack and allocated buffer
+ * for TCB. Returns a handle to the task if it is created successfully. Otherwise,
+ * returns NULL.
+ */
+#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    static TCB_t * prvCreateRestrictedTask( const TaskParameters_t * const pxTaskDefinition,
+                                            TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif /* #if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+
+/*
+ * Create a task with allocated buffer for both TCB and stack. Returns a handle to
+ * the task if it is created successfully. Otherwise, returns NULL.
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    static TCB_t * prvCreateTask( TaskFunction_t pxTaskCode,
+                                  const char * const pcName,
+                                  const configSTACK_DEPTH_TYPE uxStackDepth,
+                                  void * const pvParameters,
+                                  UBaseType_t uxPriority,
+                                  TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif /* #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+
+/*
+ * Allocate and zero a TCB, and its cold block if configUSE_TCB_COLD_BLOCK is
+ * 1.  The TCB is taken from the TCB pool while it has free entries.  Returns
+ * NULL if the memory cannot be allocated.  prvFreeTCB() frees a TCB allocated
+ * by prvAllocateTCB().
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    static TCB_t * prvAllocateTCB( void ) PRIVILEGED_FUNCTION;
+    static void prvFreeTCB( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+#endif /* #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+
+/*
+ * freertos_tasks_c_additions_init() should only be called if the user definable
+ * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
+ * called by the function.
+ */
+#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+
+    static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
 
 #endif
 
@@ -920,7 +1795,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
             for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
             {
-                xCurrentCoreTaskPriority = ( BaseType_t ) pxCurrentTCBs[ xCoreID ]->uxPriority;
+                xCurrentCoreTaskPriority = ( BaseType_t ) taskPREEMPTION_PRIORITY( pxCurrentTCBs[ xCoreID ] );
 
                 /* System idle tasks are being assigned a priority of tskIDLE_PRIORITY - 1 here. */
                 if( ( pxCurrentTCBs[ xCoreID ]->uxTaskAttributes & taskATTRIBUTE_IS_IDLE ) != 0U )
@@ -1233,7 +2108,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
                         if( ( uxCoreMap & ( ( UBaseType_t ) 1U << uxCore ) ) != 0U )
                         {
-                            xTaskPriority = ( BaseType_t ) pxCurrentTCBs[ uxCore ]->uxPriority;
+                            xTaskPriority = ( BaseType_t ) taskPREEMPTION_PRIORITY( pxCurrentTCBs[ uxCore ] );
 
                             if( ( pxCurrentTCBs[ uxCore ]->uxTaskAttributes & taskATTRIBUTE_IS_IDLE ) != 0U )
                             {
@@ -1289,11 +2164,21 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
         #if ( configASSERT_DEFINED == 1 )
         {
-            /* Sanity check that the size of the structure used to declare a
-             * variable of type StaticTask_t equals the size of the real task
-             * structure. */
-            volatile size_t xSize = sizeof( StaticTask_t );
-            configASSERT( xSize == sizeof( TCB_t ) );
+            #if ( configUSE_TCB_COLD_BLOCK == 1 )
+                /* Sanity check that the TCB fits in StaticTask_t before its
+                 * cold block, and that the cold block is the size of the real
+                 * structure. */
+                volatile size_t xSize = offsetof( StaticTask_t, xDummyCold );
+                configASSERT( xSize >= sizeof( TCB_t ) );
+                xSize = sizeof( StaticTaskCold_t );
+                configASSERT( xSize == sizeof( TCBCold_t ) );
+            #else
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticTask_t equals the size of the real task
+                 * structure. */
+                volatile size_t xSize = sizeof( StaticTask_t );
+                configASSERT( xSize == sizeof( TCB_t ) );
+            #endif
             ( void ) xSize; /* Prevent unused variable warning when configASSERT() is not used. */
         }
         #endif /* configASSERT_DEFINED */
@@ -1309,6 +2194,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
             pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
 
+            #if ( configUSE_TCB_COLD_BLOCK == 1 )
+            {
+                /* The cold block is kept at the end of the same buffer. */
+                pxNewTCB->pxCold = ( TCBCold_t * ) &( pxTaskBuffer->xDummyCold );
+                ( void ) memset( ( void * ) pxNewTCB->pxCold, 0x00, sizeof( TCBCold_t ) );
+            }
+            #endif /* configUSE_TCB_COLD_BLOCK */
+
             #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
             {
                 /* Tasks can be created statically or dynamically, so note this
@@ -1423,6 +2316,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* Store the stack location in the TCB. */
             pxNewTCB->pxStack = pxTaskDefinition->puxStackBuffer;
 
+            #if ( configUSE_TCB_COLD_BLOCK == 1 )
+            {
+                /* The cold block is kept at the end of the same buffer. */
+                pxNewTCB->pxCold = ( TCBCold_t * ) &( pxTaskDefinition->pxTaskBuffer->xDummyCold );
+                ( void ) memset( ( void * ) pxNewTCB->pxCold, 0x00, sizeof( TCBCold_t ) );
+            }
+            #endif /* configUSE_TCB_COLD_BLOCK */
+
             #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
             {
                 /* Tasks can be created statically or dynamically, so note this
@@ -1529,15 +2430,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
         if( pxTaskDefinition->puxStackBuffer != NULL )
         {
-            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
-            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-            /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            pxNewTCB = prvAllocateTCB();
 
             if( pxNewTCB != NULL )
             {
-                ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
-
                 /* Store the stack location in the TCB. */
                 pxNewTCB->pxStack = pxTaskDefinition->puxStackBuffer;
 
@@ -1639,32 +2535,141 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 /*-----------------------------------------------------------*/
 
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
-    static TCB_t * prvCreateTask( TaskFunction_t pxTaskCode,
-                                  const char * const pcName,
-                                  const configSTACK_DEPTH_TYPE uxStackDepth,
-                                  void * const pvParameters,
-                                  UBaseType_t uxPriority,
-                                  TaskHandle_t * const pxCreatedTask )
+
+    static TCB_t * prvAllocateTCB( void )
     {
-        TCB_t * pxNewTCB;
+        TCB_t * pxNewTCB = NULL;
 
-        /* If the stack grows down then allocate the stack then the TCB so the stack
-         * does not grow into the TCB.  Likewise if the stack grows up then allocate
-         * the TCB then the stack. */
-        #if ( portSTACK_GROWTH > 0 )
+        #if ( configTCB_POOL_LENGTH > 0 )
+        {
+            UBaseType_t x;
+
+            taskENTER_CRITICAL();
+            {
+                for( x = ( UBaseType_t ) 0U; x < ( UBaseType_t ) configTCB_POOL_LENGTH; x++ )
+                {
+                    if( ucTCBPoolUsed[ x ] == ( uint8_t ) pdFALSE )
+                    {
+                        ucTCBPoolUsed[ x ] = ( uint8_t ) pdTRUE;
+                        pxNewTCB = &( xTCBPool[ x ] );
+                        break;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        #endif /* configTCB_POOL_LENGTH */
+
+        if( pxNewTCB == NULL )
         {
-            /* Allocate space for the TCB.  Where the memory comes from depends on
-             * the implementation of the port malloc function and whether or not static
-             * allocation is being used. */
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
             pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
-
-            if( pxNewTCB != NULL )
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxNewTCB != NULL )
+        {
+            ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
+
+            #if ( configUSE_TCB_COLD_BLOCK == 1 )
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxNewTCB->pxCold = ( TCBCold_t * ) pvPortMalloc( sizeof( TCBCold_t ) );
+
+                if( pxNewTCB->pxCold != NULL )
+                {
+                    ( void ) memset( ( void * ) pxNewTCB->pxCold, 0x00, sizeof( TCBCold_t ) );
+                }
+                else
+                {
+                    prvFreeTCB( pxNewTCB );
+                    pxNewTCB = NULL;
+                }
+            }
+            #endif /* configUSE_TCB_COLD_BLOCK */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxNewTCB;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvFreeTCB( TCB_t * pxTCB )
+    {
+        #if ( configUSE_TCB_COLD_BLOCK == 1 )
+        {
+            if( pxTCB->pxCold != NULL )
+            {
+                vPortFree( pxTCB->pxCold );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TCB_COLD_BLOCK */
+
+        #if ( configTCB_POOL_LENGTH > 0 )
+        {
+            if( ( pxTCB >= &( xTCBPool[ 0 ] ) ) && ( pxTCB < &( xTCBPool[ configTCB_POOL_LENGTH ] ) ) )
+            {
+                taskENTER_CRITICAL();
+                {
+                    ucTCBPoolUsed[ pxTCB - &( xTCBPool[ 0 ] ) ] = ( uint8_t ) pdFALSE;
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
             {
-                ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
+                vPortFree( pxTCB );
+            }
+        }
+        #else /* configTCB_POOL_LENGTH */
+        {
+            vPortFree( pxTCB );
+        }
+        #endif /* configTCB_POOL_LENGTH */
+    }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    static TCB_t * prvCreateTask( TaskFunction_t pxTaskCode,
+                                  const char * const pcName,
+                                  const configSTACK_DEPTH_TYPE uxStackDepth,
+                                  void * const pvParameters,
+                                  UBaseType_t uxPriority,
+                                  TaskHandle_t * const pxCreatedTask )
+    {
+        TCB_t * pxNewTCB;
+
+        /* If the stack grows down then allocate the stack then the TCB so the stack
+         * does not grow into the TCB.  Likewise if the stack grows up then allocate
+         * the TCB then the stack. */
+        #if ( portSTACK_GROWTH > 0 )
+        {
+            /* Allocate space for the TCB.  Where the memory comes from depends on
+             * the implementation of the port malloc function and whether or not static
+             * allocation is being used. */
+            pxNewTCB = prvAllocateTCB();
 
+            if( pxNewTCB != NULL )
+            {
                 /* Allocate space for the stack used by the task being created.
                  * The base of the stack memory stored in the TCB so the task can
                  * be deleted later if required. */
@@ -1676,7 +2681,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 if( pxNewTCB->pxStack == NULL )
                 {
                     /* Could not allocate the stack.  Delete the allocated TCB. */
-                    vPortFree( pxNewTCB );
+                    prvFreeTCB( pxNewTCB );
                     pxNewTCB = NULL;
                 }
             }
@@ -1694,15 +2699,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             if( pxStack != NULL )
             {
                 /* Allocate space for the TCB. */
-                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
-                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-                /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+                pxNewTCB = prvAllocateTCB();
 
                 if( pxNewTCB != NULL )
                 {
-                    ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
-
                     /* Store the stack location in the TCB. */
                     pxNewTCB->pxStack = pxStack;
                 }
@@ -1808,6 +2808,120 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             return xReturn;
         }
     #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TASK_CREATE_MULTIPLE == 1 )
+        BaseType_t xTaskCreateMultiple( const TaskCreateParameters_t * const pxTasks,
+                                        UBaseType_t uxTasks )
+        {
+            List_t xNewTasks;
+            TCB_t * pxNewTCB;
+            UBaseType_t x;
+            BaseType_t xReturn = pdPASS;
+
+            #if ( configNUMBER_OF_CORES == 1 )
+                TCB_t * pxHighestTCB = NULL;
+            #endif
+
+            traceENTER_xTaskCreateMultiple( pxTasks, uxTasks );
+
+            configASSERT( ( pxTasks != NULL ) || ( uxTasks == ( UBaseType_t ) 0U ) );
+
+            /* The new tasks are held in a list through their state list item,
+             * which is not otherwise used until they are made ready. */
+            vListInitialise( &xNewTasks );
+
+            for( x = ( UBaseType_t ) 0U; x < uxTasks; x++ )
+            {
+                if( xReturn == pdPASS )
+                {
+                    pxNewTCB = prvCreateTask( pxTasks[ x ].pxTaskCode, pxTasks[ x ].pcName, pxTasks[ x ].uxStackDepth, pxTasks[ x ].pvParameters, pxTasks[ x ].uxPriority, pxTasks[ x ].pxCreatedTask );
+                }
+                else
+                {
+                    pxNewTCB = NULL;
+                }
+
+                if( pxNewTCB != NULL )
+                {
+                    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+                    {
+                        /* Set the task's affinity before scheduling it. */
+                        pxNewTCB->uxCoreAffinityMask = configTASK_DEFAULT_CORE_AFFINITY;
+                    }
+                    #endif
+
+                    #if ( taskUSE_STACK_FILL_ELISION == 1 )
+                    {
+                        prvStackFillNew( pxNewTCB, pxTasks[ x ].eStackFill );
+                    }
+                    #endif
+
+                    vListInsertEnd( &xNewTasks, &( pxNewTCB->xStateListItem ) );
+                }
+                else
+                {
+                    xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+
+                    if( pxTasks[ x ].pxCreatedTask != NULL )
+                    {
+                        *( pxTasks[ x ].pxCreatedTask ) = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+
+            taskENTER_CRITICAL();
+            {
+                while( listLIST_IS_EMPTY( &xNewTasks ) == pdFALSE )
+                {
+                    /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pxNewTCB = listGET_OWNER_OF_HEAD_ENTRY( &xNewTasks );
+                    ( void ) uxListRemove( &( pxNewTCB->xStateListItem ) );
+
+                    prvLinkNewTask( pxNewTCB );
+
+                    #if ( configNUMBER_OF_CORES == 1 )
+                    {
+                        if( ( pxHighestTCB == NULL ) || ( pxNewTCB->uxPriority > pxHighestTCB->uxPriority ) )
+                        {
+                            pxHighestTCB = pxNewTCB;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                if( ( xSchedulerRunning != pdFALSE ) && ( pxHighestTCB != NULL ) )
+                {
+                    /* If the highest priority created task is of a higher
+                     * priority than the current task then it should run now. */
+                    taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxHighestTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            traceRETURN_xTaskCreateMultiple( xReturn );
+
+            return xReturn;
+        }
+    #endif /* configUSE_TASK_CREATE_MULTIPLE */
 
 #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
@@ -1839,8 +2953,10 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         uxPriority &= ~portPRIVILEGE_BIT;
     #endif /* portUSING_MPU_WRAPPERS == 1 */
 
-    /* Avoid dependency on memset() if it is not required. */
-    #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+    /* Avoid dependency on memset() if it is not required.  With stack fill
+     * elision the stack is filled by prvStackFillNew() instead, once the
+     * initial frame is in place. */
+    #if ( ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 ) && ( taskUSE_STACK_FILL_ELISION == 0 ) )
     {
         /* Fill the stack with a known value to assist debugging. */
         ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) uxStackDepth * sizeof( StackType_t ) );
@@ -1886,7 +3002,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     {
         for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
         {
-            pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+            taskCOLD( pxNewTCB )->pcTaskName[ x ] = pcName[ x ];
 
             /* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
              * configMAX_TASK_NAME_LEN characters just in case the memory after the
@@ -1903,7 +3019,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
         /* Ensure the name string is terminated in the case that the string length
          * was greater or equal to configMAX_TASK_NAME_LEN. */
-        pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1U ] = '\0';
+        taskCOLD( pxNewTCB )->pcTaskName[ configMAX_TASK_NAME_LEN - 1U ] = '\0';
     }
     else
     {
@@ -1940,6 +3056,13 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority );
     listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
 
+    #if ( tskUSE_TASK_REGISTRY == 1 )
+    {
+        vListInitialiseItem( &( pxNewTCB->xRegistryListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxNewTCB->xRegistryListItem ), pxNewTCB );
+    }
+    #endif
+
     #if ( portUSING_MPU_WRAPPERS == 1 )
     {
         vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, uxStackDepth );
@@ -1954,7 +3077,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
     {
         /* Allocate and initialize memory for the task's TLS Block. */
-        configINIT_TLS_BLOCK( pxNewTCB->xTLSBlock, pxTopOfStack );
+        configINIT_TLS_BLOCK( taskCOLD( pxNewTCB )->xTLSBlock, pxTopOfStack );
     }
     #endif
 
@@ -2020,11 +3143,24 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     }
     #endif
 
+    #if ( configUSE_SAMPLED_STACK_HIGH_WATER_MARK == 1 )
+    {
+        /* The initial context is the first sample. */
+        pxNewTCB->pxStackHighWaterMark = pxNewTCB->pxTopOfStack;
+    }
+    #endif
+
     /* Initialize task state and task attributes. */
     #if ( configNUMBER_OF_CORES > 1 )
     {
         pxNewTCB->xTaskRunState = taskTASK_NOT_RUNNING;
 
+        #if ( configUSE_SMP_STATS == 1 )
+        {
+            pxNewTCB->xLastRunCore = taskTASK_NOT_RUNNING;
+        }
+        #endif
+
         /* Is this an idle task? */
         if( ( ( TaskFunction_t ) pxTaskCode == ( TaskFunction_t ) ( &prvIdleTask ) ) || ( ( TaskFunction_t ) pxTaskCode == ( TaskFunction_t ) ( &prvPassiveIdleTask ) ) )
         {
@@ -2048,67 +3184,86 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
 #if ( configNUMBER_OF_CORES == 1 )
 
-    static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
+    static void prvLinkNewTask( TCB_t * pxNewTCB )
     {
-        /* Ensure interrupts don't access the task lists while the lists are being
-         * updated. */
-        taskENTER_CRITICAL();
+        uxCurrentNumberOfTasks = ( UBaseType_t ) ( uxCurrentNumberOfTasks + 1U );
+
+        if( pxCurrentTCB == NULL )
         {
-            uxCurrentNumberOfTasks = ( UBaseType_t ) ( uxCurrentNumberOfTasks + 1U );
+            /* There are no other tasks, or all the other tasks are in
+             * the suspended state - make this the current task. */
+            pxCurrentTCB = pxNewTCB;
 
-            if( pxCurrentTCB == NULL )
+            if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
             {
-                /* There are no other tasks, or all the other tasks are in
-                 * the suspended state - make this the current task. */
-                pxCurrentTCB = pxNewTCB;
-
-                if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-                {
-                    /* This is the first task to be created so do the preliminary
-                     * initialisation required.  We will not recover if this call
-                     * fails, but we will report the failure. */
-                    prvInitialiseTaskLists();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                /* This is the first task to be created so do the preliminary
+                 * initialisation required.  We will not recover if this call
+                 * fails, but we will report the failure. */
+                prvInitialiseTaskLists();
             }
             else
             {
-                /* If the scheduler is not already running, make this task the
-                 * current task if it is the highest priority task to be created
-                 * so far. */
-                if( xSchedulerRunning == pdFALSE )
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            /* If the scheduler is not already running, make this task the
+             * current task if it is the highest priority task to be created
+             * so far. */
+            if( xSchedulerRunning == pdFALSE )
+            {
+                if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
                 {
-                    if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
-                    {
-                        pxCurrentTCB = pxNewTCB;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                    pxCurrentTCB = pxNewTCB;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-
-            uxTaskNumber++;
-
-            #if ( configUSE_TRACE_FACILITY == 1 )
+            else
             {
-                /* Add a counter into the TCB for tracing only. */
-                pxNewTCB->uxTCBNumber = uxTaskNumber;
+                mtCOVERAGE_TEST_MARKER();
             }
-            #endif /* configUSE_TRACE_FACILITY */
-            traceTASK_CREATE( pxNewTCB );
+        }
+
+        uxTaskNumber++;
+
+        #if ( configUSE_TRACE_FACILITY == 1 )
+        {
+            /* Add a counter into the TCB for tracing only. */
+            taskCOLD( pxNewTCB )->uxTCBNumber = uxTaskNumber;
+        }
+        #endif /* configUSE_TRACE_FACILITY */
+        traceTASK_CREATE( pxNewTCB );
+
+        #if ( tskUSE_TASK_REGISTRY == 1 )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxNewTCB->xRegistryListItem ), ( TickType_t ) uxTaskNumber );
+            vListInsertEnd( &xTaskRegistry, &( pxNewTCB->xRegistryListItem ) );
+        }
+        #endif
+
+        prvAddTaskToReadyList( pxNewTCB );
+
+        portSETUP_TCB( pxNewTCB );
+    }
+/*-----------------------------------------------------------*/
 
-            prvAddTaskToReadyList( pxNewTCB );
+    static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
+    {
+        #if ( taskUSE_STACK_FILL_ELISION == 1 )
+        {
+            prvStackFillNew( pxNewTCB, configTASK_STACK_FILL_DEFAULT );
+        }
+        #endif
 
-            portSETUP_TCB( pxNewTCB );
+        /* Ensure interrupts don't access the task lists while the lists are being
+         * updated. */
+        taskENTER_CRITICAL();
+        {
+            prvLinkNewTask( pxNewTCB );
         }
         taskEXIT_CRITICAL();
 
@@ -2126,61 +3281,80 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
 #else /* #if ( configNUMBER_OF_CORES == 1 ) */
 
-    static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
+    static void prvLinkNewTask( TCB_t * pxNewTCB )
     {
-        /* Ensure interrupts don't access the task lists while the lists are being
-         * updated. */
-        taskENTER_CRITICAL();
-        {
-            uxCurrentNumberOfTasks++;
-
-            if( xSchedulerRunning == pdFALSE )
-            {
-                if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-                {
-                    /* This is the first task to be created so do the preliminary
-                     * initialisation required.  We will not recover if this call
-                     * fails, but we will report the failure. */
-                    prvInitialiseTaskLists();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-
-                /* All the cores start with idle tasks before the SMP scheduler
-                 * is running. Idle tasks are assigned to cores when they are
-                 * created in prvCreateIdleTasks(). */
-            }
-
-            uxTaskNumber++;
-
-            #if ( configUSE_TRACE_FACILITY == 1 )
-            {
-                /* Add a counter into the TCB for tracing only. */
-                pxNewTCB->uxTCBNumber = uxTaskNumber;
-            }
-            #endif /* configUSE_TRACE_FACILITY */
-            traceTASK_CREATE( pxNewTCB );
+        uxCurrentNumberOfTasks++;
 
-            prvAddTaskToReadyList( pxNewTCB );
-
-            portSETUP_TCB( pxNewTCB );
-
-            if( xSchedulerRunning != pdFALSE )
+        if( xSchedulerRunning == pdFALSE )
+        {
+            if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
             {
-                /* If the created task is of a higher priority than another
-                 * currently running task and preemption is on then it should
-                 * run now. */
-                taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxNewTCB );
+                /* This is the first task to be created so do the preliminary
+                 * initialisation required.  We will not recover if this call
+                 * fails, but we will report the failure. */
+                prvInitialiseTaskLists();
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
+
+            /* All the cores start with idle tasks before the SMP scheduler
+             * is running. Idle tasks are assigned to cores when they are
+             * created in prvCreateIdleTasks(). */
         }
-        taskEXIT_CRITICAL();
-    }
+
+        uxTaskNumber++;
+
+        #if ( configUSE_TRACE_FACILITY == 1 )
+        {
+            /* Add a counter into the TCB for tracing only. */
+            taskCOLD( pxNewTCB )->uxTCBNumber = uxTaskNumber;
+        }
+        #endif /* configUSE_TRACE_FACILITY */
+        traceTASK_CREATE( pxNewTCB );
+
+        #if ( tskUSE_TASK_REGISTRY == 1 )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxNewTCB->xRegistryListItem ), ( TickType_t ) uxTaskNumber );
+            vListInsertEnd( &xTaskRegistry, &( pxNewTCB->xRegistryListItem ) );
+        }
+        #endif
+
+        prvAddTaskToReadyList( pxNewTCB );
+
+        portSETUP_TCB( pxNewTCB );
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            /* If the created task is of a higher priority than another
+             * currently running task and preemption is on then it should
+             * run now. */
+            taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxNewTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
+    {
+        #if ( taskUSE_STACK_FILL_ELISION == 1 )
+        {
+            prvStackFillNew( pxNewTCB, configTASK_STACK_FILL_DEFAULT );
+        }
+        #endif
+
+        /* Ensure interrupts don't access the task lists while the lists are being
+         * updated. */
+        taskENTER_CRITICAL();
+        {
+            prvLinkNewTask( pxNewTCB );
+        }
+        taskEXIT_CRITICAL();
+    }
 
 #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 /*-----------------------------------------------------------*/
@@ -2261,6 +3435,92 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
              * not return. */
             uxTaskNumber++;
 
+            #if ( tskUSE_TASK_REGISTRY == 1 )
+            {
+                ( void ) uxListRemove( &( pxTCB->xRegistryListItem ) );
+            }
+            #endif
+
+            #if ( configUSE_APERIODIC_SERVERS == 1 )
+            {
+                if( pxTCB->pxAperiodicServer != NULL )
+                {
+                    prvServerUnlink( pxTCB->pxAperiodicServer );
+                    pxTCB->pxAperiodicServer = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_MIXED_CRITICALITY == 1 )
+            {
+                if( pxTCB->pxCriticality != NULL )
+                {
+                    prvCriticalityUnlink( pxTCB->pxCriticality );
+                    pxTCB->pxCriticality = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_EXECUTION_BUDGETS == 1 )
+            {
+                if( pxTCB->pxExecutionBudget != NULL )
+                {
+                    prvBudgetUnlink( pxTCB->pxExecutionBudget );
+                    pxTCB->pxExecutionBudget = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_TASK_GROUPS == 1 )
+            {
+                if( pxTCB->pxTaskGroup != NULL )
+                {
+                    prvTaskGroupLeave( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+            {
+                prvThresholdRemove( pxTCB );
+            }
+            #endif
+
+            #if ( configUSE_IDLE_GOVERNOR == 1 )
+            {
+                if( pxTCB->ulWakeLatency != ( configRUN_TIME_COUNTER_TYPE ) 0U )
+                {
+                    prvWakeLatencyRemove( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( taskUSE_STACK_FILL_ELISION == 1 )
+            {
+                prvStackFillRemove( pxTCB );
+            }
+            #endif
+
             /* Use temp variable as distinct sequence points for reading volatile
              * variables prior to a logical operator to ensure compliance with
              * MISRA C 2012 Rule 13.5. */
@@ -2384,6 +3644,14 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         configASSERT( pxPreviousWakeTime );
         configASSERT( ( xTimeIncrement > 0U ) );
 
+        #if ( configUSE_JOB_MONITOR == 1 )
+        {
+            /* Each call completes a job of a periodic task.  The next job is
+             * released at the wake time calculated below. */
+            prvJobComplete( xTimeIncrement, *pxPreviousWakeTime + xTimeIncrement );
+        }
+        #endif
+
         vTaskSuspendAll();
         {
             /* Minor optimisation.  The tick count cannot change in this
@@ -2455,6 +3723,21 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             mtCOVERAGE_TEST_MARKER();
         }
 
+        #if ( configUSE_JOB_MONITOR == 1 )
+        {
+            /* The wake time had already passed, so the task did not block and
+             * the next job starts immediately. */
+            if( xShouldDelay == pdFALSE )
+            {
+                vTaskJobBegin();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         traceRETURN_xTaskDelayUntil( xShouldDelay );
 
         return xShouldDelay;
@@ -2581,7 +3864,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
                             for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
                             {
-                                if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                                if( taskCOLD( pxTCB )->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
                                 {
                                     eReturn = eBlocked;
                                     break;
@@ -2860,7 +4143,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                             /* The priority of a task other than the currently
                              * running task is being raised.  Is the priority being
                              * raised above that of the running task? */
-                            if( uxNewPriority > pxCurrentTCB->uxPriority )
+                            if( uxNewPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
                             {
                                 xYieldRequired = pdTRUE;
                             }
@@ -2908,6 +4191,8 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                  * taskRESET_READY_PRIORITY() macro can function correctly. */
                 uxPriorityUsedOnEntry = pxTCB->uxPriority;
 
+                taskSNAPSHOT_WRITE_BEGIN( pxTCB );
+
                 #if ( configUSE_MUTEXES == 1 )
                 {
                     /* Only change the priority being used if the task is not
@@ -2931,6 +4216,8 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                 }
                 #endif /* if ( configUSE_MUTEXES == 1 ) */
 
+                taskSNAPSHOT_WRITE_END( pxTCB );
+
                 /* Only reset the event list item value if the value is not
                  * being used for anything else. */
                 if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0U ) )
@@ -2963,7 +4250,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                         mtCOVERAGE_TEST_MARKER();
                     }
 
-                    prvAddTaskToReadyList( pxTCB );
+                    prvReinsertTaskInReadyList( pxTCB );
                 }
                 else
                 {
@@ -3171,6 +4458,24 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
             traceTASK_SUSPEND( pxTCB );
 
+            #if ( configUSE_EXECUTION_BUDGETS == 1 )
+            {
+                prvBudgetSuspendOverridden( pxTCB );
+            }
+            #endif
+
+            #if ( configUSE_MIXED_CRITICALITY == 1 )
+            {
+                prvCriticalitySuspendOverridden( pxTCB );
+            }
+            #endif
+
+            #if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+            {
+                prvThresholdRemove( pxTCB );
+            }
+            #endif
+
             /* Remove task from the ready/delayed list and place in the
              * suspended list. */
             if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
@@ -3200,11 +4505,11 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
                 for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
                 {
-                    if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                    if( taskCOLD( pxTCB )->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
                     {
                         /* The task was blocked to wait for a notification, but is
                          * now suspended, so no notification was received. */
-                        pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+                        taskCOLD( pxTCB )->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
                     }
                 }
             }
@@ -3353,7 +4658,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
                         for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
                         {
-                            if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                            if( taskCOLD( pxTCB )->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
                             {
                                 xReturn = pdFALSE;
                                 break;
@@ -3419,6 +4724,18 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                 {
                     traceTASK_RESUME( pxTCB );
 
+                    #if ( configUSE_EXECUTION_BUDGETS == 1 )
+                    {
+                        prvBudgetSuspendOverridden( pxTCB );
+                    }
+                    #endif
+
+                    #if ( configUSE_MIXED_CRITICALITY == 1 )
+                    {
+                        prvCriticalitySuspendOverridden( pxTCB );
+                    }
+                    #endif
+
                     /* The ready list can be accessed even if the scheduler is
                      * suspended because this is inside a critical section. */
                     ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
@@ -3487,6 +4804,18 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             {
                 traceTASK_RESUME_FROM_ISR( pxTCB );
 
+                #if ( configUSE_EXECUTION_BUDGETS == 1 )
+                {
+                    prvBudgetSuspendOverridden( pxTCB );
+                }
+                #endif
+
+                #if ( configUSE_MIXED_CRITICALITY == 1 )
+                {
+                    prvCriticalitySuspendOverridden( pxTCB );
+                }
+                #endif
+
                 /* Check the ready lists can be accessed. */
                 if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
                 {
@@ -3494,7 +4823,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                     {
                         /* Ready lists can be accessed so move the task from the
                          * suspended list to the ready list directly. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
                         {
                             xYieldRequired = pdTRUE;
 
@@ -3519,6 +4848,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                      * is held in the pending ready list until the scheduler is
                      * unsuspended. */
                     vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                    taskRECORD_TASK_READY( pxTCB );
                 }
 
                 #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_PREEMPTION == 1 ) )
@@ -3736,6 +5066,19 @@ void vTaskStartScheduler( void )
         }
         #endif
 
+        #if ( configUSE_IDLE_GOVERNOR == 1 )
+        {
+            if( uxIdleStates == ( UBaseType_t ) 0U )
+            {
+                portIDLE_STATES_INIT();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         /* Interrupts are turned off here, to ensure a tick does not occur
          * before or during the call to xPortStartScheduler().  The stacks of
          * the created tasks contain a status word with interrupts switched on
@@ -3747,7 +5090,7 @@ void vTaskStartScheduler( void )
         {
             /* Switch C-Runtime's TLS Block to point to the TLS
              * block specific to the task that will run first. */
-            configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
+            configSET_TLS_BLOCK( taskCOLD( pxCurrentTCB )->xTLSBlock );
         }
         #endif
 
@@ -3763,6 +5106,21 @@ void vTaskStartScheduler( void )
          * FreeRTOSConfig.h file. */
         portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
 
+        #if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+        {
+            BaseType_t xCoreID;
+
+            /* Start every core's accounting from now rather than from
+             * whenever the run time counter started counting. */
+            ulCoreRunTimeOrigin = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE();
+
+            for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+            {
+                ulTaskSwitchedInTime[ xCoreID ] = ulCoreRunTimeOrigin;
+            }
+        }
+        #endif /* configUSE_CORE_RUN_TIME_STATS */
+
         traceTASK_SWITCHED_IN();
 
         traceSTARTING_SCHEDULER( xIdleTaskHandles );
@@ -3887,6 +5245,15 @@ void vTaskSuspendAll( void )
         /* Enforces ordering for ports and optimised compilers that may otherwise place
          * the above increment elsewhere. */
         portMEMORY_BARRIER();
+
+        #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+        {
+            if( uxSchedulerSuspended == 1U )
+            {
+                vLatencyHistogramSectionEnter( eLatencySchedulerSuspended, ( uint32_t ) portLATENCY_CALLER_ADDRESS() );
+            }
+        }
+        #endif
     }
     #else /* #if ( configNUMBER_OF_CORES == 1 ) */
     {
@@ -3938,6 +5305,16 @@ void vTaskSuspendAll( void )
             /* The scheduler is suspended if uxSchedulerSuspended is non-zero. An increment
              * is used to allow calls to vTaskSuspendAll() to nest. */
             ++uxSchedulerSuspended;
+
+            #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+            {
+                if( uxSchedulerSuspended == 1U )
+                {
+                    vLatencyHistogramSectionEnter( eLatencySchedulerSuspended, ( uint32_t ) portLATENCY_CALLER_ADDRESS() );
+                }
+            }
+            #endif
+
             portRELEASE_ISR_LOCK( xCoreID );
 
             portCLEAR_INTERRUPT_MASK( ulState );
@@ -4047,6 +5424,12 @@ BaseType_t xTaskResumeAll( void )
 
             if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
             {
+                #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+                {
+                    vLatencyHistogramSectionExit( eLatencySchedulerSuspended );
+                }
+                #endif
+
                 if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
                 {
                     /* Move any readied tasks from the pending list into the
@@ -4066,7 +5449,7 @@ BaseType_t xTaskResumeAll( void )
                         {
                             /* If the moved task has a priority higher than the current
                              * task then a yield must be performed. */
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
                             {
                                 xYieldPendings[ xCoreID ] = pdTRUE;
                             }
@@ -4244,9 +5627,9 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
     pxTCB = prvGetTCBFromHandle( xTaskToQuery );
     configASSERT( pxTCB != NULL );
 
-    traceRETURN_pcTaskGetName( &( pxTCB->pcTaskName[ 0 ] ) );
+    traceRETURN_pcTaskGetName( &( taskCOLD( pxTCB )->pcTaskName[ 0 ] ) );
 
-    return &( pxTCB->pcTaskName[ 0 ] );
+    return &( taskCOLD( pxTCB )->pcTaskName[ 0 ] );
 }
 /*-----------------------------------------------------------*/
 
@@ -4279,7 +5662,7 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
 
                 for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
                 {
-                    cNextChar = pxTCB->pcTaskName[ x ];
+                    cNextChar = taskCOLD( pxTCB )->pcTaskName[ x ];
 
                     if( cNextChar != pcNameToQuery[ x ] )
                     {
@@ -4349,6 +5732,18 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 }
             } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY );
 
+            #if ( configUSE_TASK_GROUPS == 1 )
+            {
+                const TaskGroup_t * pxGroup;
+
+                /* Search the tasks held by their group. */
+                for( pxGroup = pxTaskGroups; ( pxGroup != NULL ) && ( pxTCB == NULL ); pxGroup = pxGroup->pxNext )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxGroup->xHeldTasks ), pcNameToQuery );
+                }
+            }
+            #endif
+
             /* Search the delayed lists. */
             if( pxTCB == NULL )
             {
@@ -4468,6 +5863,19 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                     uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady ) );
                 } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY );
 
+                #if ( configUSE_TASK_GROUPS == 1 )
+                {
+                    const TaskGroup_t * pxGroup;
+
+                    /* Tasks held until their group's budget is replenished
+                     * are ready, but are not in a ready list. */
+                    for( pxGroup = pxTaskGroups; pxGroup != NULL; pxGroup = pxGroup->pxNext )
+                    {
+                        uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) &( pxGroup->xHeldTasks ), eReady ) );
+                    }
+                }
+                #endif
+
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Blocked state. */
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked ) );
@@ -4694,7 +6102,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                         /* Preemption is on, but a context switch should only be
                          * performed if the unblocked task has a priority that is
                          * higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
                         {
                             /* Pend the yield to be performed when the scheduler
                              * is unsuspended. */
@@ -4845,7 +6253,7 @@ BaseType_t xTaskIncrementTick( void )
                              * processing time (which happens when both
                              * preemption and time slicing are on) is
                              * handled below.*/
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
                             {
                                 xSwitchRequired = pdTRUE;
                             }
@@ -4865,14 +6273,11 @@ BaseType_t xTaskIncrementTick( void )
             }
         }
 
-        /* Tasks of equal priority to the currently running task will share
-         * processing time (time slice) if preemption is on, and the application
-         * writer has not explicitly turned time slicing off. */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        #if ( configUSE_TIME_TRIGGERED == 1 )
         {
-            #if ( configNUMBER_OF_CORES == 1 )
+            if( pxTimeTriggeredTable != NULL )
             {
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > 1U )
+                if( prvTimeTriggeredTick() != pdFALSE )
                 {
                     xSwitchRequired = pdTRUE;
                 }
@@ -4881,47 +6286,58 @@ BaseType_t xTaskIncrementTick( void )
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-            #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            else
             {
-                BaseType_t xCoreID;
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TIME_TRIGGERED */
 
-                for( xCoreID = 0; xCoreID < ( ( BaseType_t ) configNUMBER_OF_CORES ); xCoreID++ )
+        #if ( configUSE_APERIODIC_SERVERS == 1 )
+        {
+            if( pxAperiodicServers != NULL )
+            {
+                if( prvServersTick() != pdFALSE )
                 {
-                    if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCBs[ xCoreID ]->uxPriority ] ) ) > 1U )
-                    {
-                        xYieldPendings[ xCoreID ] = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
                 }
             }
-            #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        #endif /* #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+        #endif /* configUSE_APERIODIC_SERVERS */
 
-        #if ( configUSE_TICK_HOOK == 1 )
+        #if ( configUSE_MIXED_CRITICALITY == 1 )
         {
-            /* Guard against the tick hook being called when the pended tick
-             * count is being unwound (when the scheduler is being unlocked). */
-            if( xPendedTicks == ( TickType_t ) 0 )
+            if( pxCriticalityTasks != NULL )
             {
-                vApplicationTickHook();
+                if( prvCriticalityTick() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        #endif /* configUSE_TICK_HOOK */
+        #endif /* configUSE_MIXED_CRITICALITY */
 
-        #if ( configUSE_PREEMPTION == 1 )
+        #if ( configUSE_EXECUTION_BUDGETS == 1 )
         {
-            #if ( configNUMBER_OF_CORES == 1 )
+            if( pxExecutionBudgets != NULL )
             {
-                /* For single core the core ID is always 0. */
-                if( xYieldPendings[ 0 ] != pdFALSE )
+                if( prvBudgetsTick() != pdFALSE )
                 {
                     xSwitchRequired = pdTRUE;
                 }
@@ -4930,21 +6346,125 @@ BaseType_t xTaskIncrementTick( void )
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-            #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            else
             {
-                BaseType_t xCoreID, xCurrentCoreID;
-                xCurrentCoreID = ( BaseType_t ) portGET_CORE_ID();
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_EXECUTION_BUDGETS */
 
-                for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+        #if ( configUSE_TASK_GROUPS == 1 )
+        {
+            if( pxTaskGroups != NULL )
+            {
+                if( prvTaskGroupsTick() != pdFALSE )
                 {
-                    #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
-                        if( pxCurrentTCBs[ xCoreID ]->xPreemptionDisable == pdFALSE )
-                    #endif
-                    {
-                        if( xYieldPendings[ xCoreID ] != pdFALSE )
-                        {
-                            if( xCoreID == xCurrentCoreID )
-                            {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TASK_GROUPS */
+
+        /* Tasks of equal priority to the currently running task will share
+         * processing time (time slice) if preemption is on, and the application
+         * writer has not explicitly turned time slicing off. */
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        {
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                /* Tasks of the same priority do not preempt a task running
+                 * above its priority. */
+                #if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+                    if( pxCurrentTCB->uxPreemptionThreshold <= pxCurrentTCB->uxPriority )
+                #endif
+                {
+                    if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > 1U )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            {
+                BaseType_t xCoreID;
+
+                for( xCoreID = 0; xCoreID < ( ( BaseType_t ) configNUMBER_OF_CORES ); xCoreID++ )
+                {
+                    #if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+                        if( pxCurrentTCBs[ xCoreID ]->uxPreemptionThreshold <= pxCurrentTCBs[ xCoreID ]->uxPriority )
+                    #endif
+                    {
+                        if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCBs[ xCoreID ]->uxPriority ] ) ) > 1U )
+                        {
+                            xYieldPendings[ xCoreID ] = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+            }
+            #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+        }
+        #endif /* #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+        #if ( configUSE_TICK_HOOK == 1 )
+        {
+            /* Guard against the tick hook being called when the pended tick
+             * count is being unwound (when the scheduler is being unlocked). */
+            if( xPendedTicks == ( TickType_t ) 0 )
+            {
+                vApplicationTickHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TICK_HOOK */
+
+        #if ( configUSE_PREEMPTION == 1 )
+        {
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                /* For single core the core ID is always 0. */
+                if( xYieldPendings[ 0 ] != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            {
+                BaseType_t xCoreID, xCurrentCoreID;
+                xCurrentCoreID = ( BaseType_t ) portGET_CORE_ID();
+
+                for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                {
+                    #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
+                        if( pxCurrentTCBs[ xCoreID ]->xPreemptionDisable == pdFALSE )
+                    #endif
+                    {
+                        if( xYieldPendings[ xCoreID ] != pdFALSE )
+                        {
+                            if( xCoreID == xCurrentCoreID )
+                            {
                                 xSwitchRequired = pdTRUE;
                             }
                             else
@@ -5146,26 +6666,45 @@ BaseType_t xTaskIncrementTick( void )
                  * overflows.  The guard against negative values is to protect
                  * against suspect run time stat counter implementations - which
                  * are provided by the application, not the kernel. */
-                if( ulTotalRunTime[ 0 ] > ulTaskSwitchedInTime[ 0 ] )
+                taskSNAPSHOT_WRITE_BEGIN( pxCurrentTCB );
+
+                #if ( configUSE_CORE_RUN_TIME_STATS == 1 )
                 {
-                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+                    prvAccountCoreRunTime( ( BaseType_t ) 0, pxCurrentTCB, ulTotalRunTime[ 0 ] );
                 }
-                else
+                #else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    if( ulTotalRunTime[ 0 ] > ulTaskSwitchedInTime[ 0 ] )
+                    {
+                        pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    ulTaskSwitchedInTime[ 0 ] = ulTotalRunTime[ 0 ];
                 }
+                #endif /* configUSE_CORE_RUN_TIME_STATS */
 
-                ulTaskSwitchedInTime[ 0 ] = ulTotalRunTime[ 0 ];
+                taskSNAPSHOT_WRITE_END( pxCurrentTCB );
+
+                taskSERVER_TASK_SWITCHED_OUT( pxCurrentTCB, ulTotalRunTime[ 0 ] );
+                taskCRITICALITY_TASK_SWITCHED_OUT( pxCurrentTCB, ulTotalRunTime[ 0 ] );
+                taskBUDGET_TASK_SWITCHED_OUT( pxCurrentTCB, ulTotalRunTime[ 0 ] );
+                taskGROUP_TASK_SWITCHED_OUT( pxCurrentTCB, ulTotalRunTime[ 0 ] );
             }
             #endif /* configGENERATE_RUN_TIME_STATS */
 
             /* Check for stack overflow, if configured. */
             taskCHECK_FOR_STACK_OVERFLOW();
+            taskSAMPLE_STACK_HIGH_WATER_MARK( pxCurrentTCB );
+            taskTHRESHOLD_TASK_SWITCHED_OUT( pxCurrentTCB );
 
             /* Before the currently running task is switched out, save its errno. */
             #if ( configUSE_POSIX_ERRNO == 1 )
             {
-                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+                taskCOLD( pxCurrentTCB )->iTaskErrno = FreeRTOS_errno;
             }
             #endif
 
@@ -5175,8 +6714,21 @@ BaseType_t xTaskIncrementTick( void )
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
             taskSELECT_HIGHEST_PRIORITY_TASK();
+            taskTHRESHOLD_SELECT_PREEMPTED();
             traceTASK_SWITCHED_IN();
 
+            #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+            {
+                vLatencyHistogramTaskSwitchedIn( &( pxCurrentTCB->ulLatencyWakeStamp ), ( uint32_t ) ( portPOINTER_SIZE_TYPE ) pxCurrentTCB );
+            }
+            #endif
+
+            taskJOB_TASK_SWITCHED_IN( pxCurrentTCB, ( BaseType_t ) 0 );
+            taskSERVER_TASK_SWITCHED_IN( pxCurrentTCB, ulTotalRunTime[ 0 ] );
+            taskCRITICALITY_TASK_SWITCHED_IN( pxCurrentTCB, ulTotalRunTime[ 0 ] );
+            taskBUDGET_TASK_SWITCHED_IN( pxCurrentTCB, ulTotalRunTime[ 0 ] );
+            taskGROUP_TASK_SWITCHED_IN( pxCurrentTCB, ulTotalRunTime[ 0 ] );
+
             /* Macro to inject port specific behaviour immediately after
              * switching tasks, such as setting an end of stack watchpoint
              * or reconfiguring the MPU. */
@@ -5185,7 +6737,7 @@ BaseType_t xTaskIncrementTick( void )
             /* After the new task is switched in, update the global errno. */
             #if ( configUSE_POSIX_ERRNO == 1 )
             {
-                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+                FreeRTOS_errno = taskCOLD( pxCurrentTCB )->iTaskErrno;
             }
             #endif
 
@@ -5193,7 +6745,7 @@ BaseType_t xTaskIncrementTick( void )
             {
                 /* Switch C-Runtime's TLS Block to point to the TLS
                  * Block specific to this task. */
-                configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
+                configSET_TLS_BLOCK( taskCOLD( pxCurrentTCB )->xTLSBlock );
             }
             #endif
         }
@@ -5203,6 +6755,11 @@ BaseType_t xTaskIncrementTick( void )
 #else /* if ( configNUMBER_OF_CORES == 1 ) */
     void vTaskSwitchContext( BaseType_t xCoreID )
     {
+        #if ( configUSE_SMP_STATS == 1 )
+            TCB_t * pxPreviousTCB;
+            BaseType_t xYieldRequested;
+        #endif
+
         traceENTER_vTaskSwitchContext();
 
         /* Acquire both locks:
@@ -5247,26 +6804,53 @@ BaseType_t xTaskIncrementTick( void )
                      * overflows.  The guard against negative values is to protect
                      * against suspect run time stat counter implementations - which
                      * are provided by the application, not the kernel. */
-                    if( ulTotalRunTime[ xCoreID ] > ulTaskSwitchedInTime[ xCoreID ] )
+                    taskSNAPSHOT_WRITE_BEGIN( pxCurrentTCBs[ xCoreID ] );
+
+                    #if ( configUSE_CORE_RUN_TIME_STATS == 1 )
                     {
-                        pxCurrentTCBs[ xCoreID ]->ulRunTimeCounter += ( ulTotalRunTime[ xCoreID ] - ulTaskSwitchedInTime[ xCoreID ] );
+                        prvAccountCoreRunTime( xCoreID, pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
                     }
-                    else
+                    #else
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        if( ulTotalRunTime[ xCoreID ] > ulTaskSwitchedInTime[ xCoreID ] )
+                        {
+                            pxCurrentTCBs[ xCoreID ]->ulRunTimeCounter += ( ulTotalRunTime[ xCoreID ] - ulTaskSwitchedInTime[ xCoreID ] );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        ulTaskSwitchedInTime[ xCoreID ] = ulTotalRunTime[ xCoreID ];
                     }
+                    #endif /* configUSE_CORE_RUN_TIME_STATS */
+
+                    taskSNAPSHOT_WRITE_END( pxCurrentTCBs[ xCoreID ] );
 
-                    ulTaskSwitchedInTime[ xCoreID ] = ulTotalRunTime[ xCoreID ];
+                    taskSERVER_TASK_SWITCHED_OUT( pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
+                    taskCRITICALITY_TASK_SWITCHED_OUT( pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
+                    taskBUDGET_TASK_SWITCHED_OUT( pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
+                    taskGROUP_TASK_SWITCHED_OUT( pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
                 }
                 #endif /* configGENERATE_RUN_TIME_STATS */
 
                 /* Check for stack overflow, if configured. */
                 taskCHECK_FOR_STACK_OVERFLOW();
+                taskSAMPLE_STACK_HIGH_WATER_MARK( pxCurrentTCBs[ xCoreID ] );
 
                 /* Before the currently running task is switched out, save its errno. */
                 #if ( configUSE_POSIX_ERRNO == 1 )
                 {
-                    pxCurrentTCBs[ xCoreID ]->iTaskErrno = FreeRTOS_errno;
+                    taskCOLD( pxCurrentTCBs[ xCoreID ] )->iTaskErrno = FreeRTOS_errno;
+                }
+                #endif
+
+                #if ( configUSE_SMP_STATS == 1 )
+                {
+                    /* Another core only marks the running task as scheduled
+                     * to yield when it has interrupted this core. */
+                    pxPreviousTCB = pxCurrentTCBs[ xCoreID ];
+                    xYieldRequested = ( pxPreviousTCB->xTaskRunState == taskTASK_SCHEDULED_TO_YIELD ) ? pdTRUE : pdFALSE;
                 }
                 #endif
 
@@ -5274,6 +6858,24 @@ BaseType_t xTaskIncrementTick( void )
                 taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID );
                 traceTASK_SWITCHED_IN();
 
+                #if ( configUSE_SMP_STATS == 1 )
+                {
+                    prvSMPStatsTaskSwitched( xCoreID, pxPreviousTCB, xYieldRequested );
+                }
+                #endif
+
+                #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+                {
+                    vLatencyHistogramTaskSwitchedIn( &( pxCurrentTCBs[ xCoreID ]->ulLatencyWakeStamp ), ( uint32_t ) ( portPOINTER_SIZE_TYPE ) pxCurrentTCBs[ xCoreID ] );
+                }
+                #endif
+
+                taskJOB_TASK_SWITCHED_IN( pxCurrentTCBs[ xCoreID ], xCoreID );
+                taskSERVER_TASK_SWITCHED_IN( pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
+                taskCRITICALITY_TASK_SWITCHED_IN( pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
+                taskBUDGET_TASK_SWITCHED_IN( pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
+                taskGROUP_TASK_SWITCHED_IN( pxCurrentTCBs[ xCoreID ], ulTotalRunTime[ xCoreID ] );
+
                 /* Macro to inject port specific behaviour immediately after
                  * switching tasks, such as setting an end of stack watchpoint
                  * or reconfiguring the MPU. */
@@ -5282,7 +6884,7 @@ BaseType_t xTaskIncrementTick( void )
                 /* After the new task is switched in, update the global errno. */
                 #if ( configUSE_POSIX_ERRNO == 1 )
                 {
-                    FreeRTOS_errno = pxCurrentTCBs[ xCoreID ]->iTaskErrno;
+                    FreeRTOS_errno = taskCOLD( pxCurrentTCBs[ xCoreID ] )->iTaskErrno;
                 }
                 #endif
 
@@ -5290,7 +6892,7 @@ BaseType_t xTaskIncrementTick( void )
                 {
                     /* Switch C-Runtime's TLS Block to point to the TLS
                      * Block specific to this task. */
-                    configSET_TLS_BLOCK( pxCurrentTCBs[ xCoreID ]->xTLSBlock );
+                    configSET_TLS_BLOCK( taskCOLD( pxCurrentTCBs[ xCoreID ] )->xTLSBlock );
                 }
                 #endif
             }
@@ -5452,11 +7054,12 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
         /* The delayed and ready lists cannot be accessed, so hold this task
          * pending until the scheduler is resumed. */
         listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+        taskRECORD_TASK_READY( pxUnblockedTCB );
     }
 
     #if ( configNUMBER_OF_CORES == 1 )
     {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        if( pxUnblockedTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
         {
             /* Return true if the task removed from the event list has a higher
              * priority than the calling task.  This allows the calling task to know if
@@ -5539,7 +7142,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 
     #if ( configNUMBER_OF_CORES == 1 )
     {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        if( pxUnblockedTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
         {
             /* The unblocked task has a priority above that of the calling task, so
              * a context switch is required.  This function is called with the
@@ -5686,7 +7289,7 @@ void vTaskMissedYield( void )
         if( xTask != NULL )
         {
             pxTCB = xTask;
-            uxReturn = pxTCB->uxTaskNumber;
+            uxReturn = taskCOLD( pxTCB )->uxTaskNumber;
         }
         else
         {
@@ -5713,7 +7316,7 @@ void vTaskMissedYield( void )
         if( xTask != NULL )
         {
             pxTCB = xTask;
-            pxTCB->uxTaskNumber = uxHandle;
+            taskCOLD( pxTCB )->uxTaskNumber = uxHandle;
         }
 
         traceRETURN_vTaskSetTaskNumber();
@@ -5779,6 +7382,12 @@ void vTaskMissedYield( void )
             }
             #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
 
+            #if ( configUSE_IDLE_GOVERNOR == 1 )
+            {
+                prvIdleGovernorRun();
+            }
+            #endif /* configUSE_IDLE_GOVERNOR */
+
             #if ( configUSE_PASSIVE_IDLE_HOOK == 1 )
             {
                 /* Call the user defined function from within the idle task.  This
@@ -5868,6 +7477,17 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
         }
         #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
 
+        #if ( taskUSE_STACK_FILL_ELISION == 1 )
+        {
+            /* Fill the stacks left to the idle task before sleeping.  Each
+             * chunk is filled from its own critical section, so other tasks
+             * can run in between. */
+            while( prvStackFillIdle() != pdFALSE )
+            {
+            }
+        }
+        #endif /* taskUSE_STACK_FILL_ELISION */
+
         #if ( configUSE_IDLE_HOOK == 1 )
         {
             /* Call the user defined function from within the idle task. */
@@ -5925,6 +7545,15 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
         }
         #endif /* configUSE_TICKLESS_IDLE */
 
+        #if ( configUSE_IDLE_GOVERNOR == 1 )
+        {
+            /* Wait for an interrupt in the idle state chosen by the governor.
+             * With configUSE_TICKLESS_IDLE this covers the idle periods that
+             * were too short to suppress the tick. */
+            prvIdleGovernorRun();
+        }
+        #endif /* configUSE_IDLE_GOVERNOR */
+
         #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_PASSIVE_IDLE_HOOK == 1 ) )
         {
             /* Call the user defined function from within the idle task.  This
@@ -6012,7 +7641,7 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
         {
             pxTCB = prvGetTCBFromHandle( xTaskToSet );
             configASSERT( pxTCB != NULL );
-            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+            taskCOLD( pxTCB )->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
         }
 
         traceRETURN_vTaskSetThreadLocalStoragePointer();
@@ -6037,7 +7666,7 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
             pxTCB = prvGetTCBFromHandle( xTaskToQuery );
             configASSERT( pxTCB != NULL );
 
-            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+            pvReturn = taskCOLD( pxTCB )->pvThreadLocalStoragePointers[ xIndex ];
         }
         else
         {
@@ -6083,8 +7712,19 @@ static void prvInitialiseTaskLists( void )
         vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
     }
 
-    vListInitialise( &xDelayedTaskList1 );
-    vListInitialise( &xDelayedTaskList2 );
+    #if ( configUSE_LIST_TREE_INDEX == 1 )
+    {
+        /* Every blocked task with a timeout is sorted into a delayed list. */
+        vListInitialiseIndexed( &xDelayedTaskList1 );
+        vListInitialiseIndexed( &xDelayedTaskList2 );
+    }
+    #else
+    {
+        vListInitialise( &xDelayedTaskList1 );
+        vListInitialise( &xDelayedTaskList2 );
+    }
+    #endif /* configUSE_LIST_TREE_INDEX */
+
     vListInitialise( &xPendingReadyList );
 
     #if ( INCLUDE_vTaskDelete == 1 )
@@ -6099,6 +7739,12 @@ static void prvInitialiseTaskLists( void )
     }
     #endif /* INCLUDE_vTaskSuspend */
 
+    #if ( tskUSE_TASK_REGISTRY == 1 )
+    {
+        vListInitialise( &xTaskRegistry );
+    }
+    #endif
+
     /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
      * using list2. */
     pxDelayedTaskList = &xDelayedTaskList1;
@@ -6198,14 +7844,14 @@ static void prvCheckTasksWaitingTermination( void )
         configASSERT( pxTCB != NULL );
 
         pxTaskStatus->xHandle = pxTCB;
-        pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
+        pxTaskStatus->pcTaskName = ( const char * ) &( taskCOLD( pxTCB )->pcTaskName[ 0 ] );
         pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
         pxTaskStatus->pxStackBase = pxTCB->pxStack;
         #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
             pxTaskStatus->pxTopOfStack = ( StackType_t * ) pxTCB->pxTopOfStack;
             pxTaskStatus->pxEndOfStack = pxTCB->pxEndOfStack;
         #endif
-        pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+        pxTaskStatus->xTaskNumber = taskCOLD( pxTCB )->uxTCBNumber;
 
         #if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
         {
@@ -6272,7 +7918,7 @@ static void prvCheckTasksWaitingTermination( void )
                                      * suspended. */
                                     for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
                                     {
-                                        if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                                        if( taskCOLD( pxTCB )->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
                                         {
                                             pxTaskStatus->eCurrentState = eBlocked;
                                             break;
@@ -6467,99 +8113,435 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#if ( tskUSE_TASK_REGISTRY == 1 )
 
-    static void prvDeleteTCB( TCB_t * pxTCB )
+    static TCB_t * prvTaskRegistryNext( TaskRegistryCursor_t * pxCursor )
     {
-        /* This call is required specifically for the TriCore port.  It must be
-         * above the vPortFree() calls.  The call is also used by ports/demos that
-         * want to allocate and clean RAM statically. */
-        portCLEAN_UP_TCB( pxTCB );
+        TCB_t * pxTCB = NULL;
 
-        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+        /* uxTaskNumber changes whenever a task is created or deleted.  The
+         * cursor's item may then have been removed from the registry, so start
+         * again from the head and skip the tasks that were already visited,
+         * which are the older ones. */
+        if( ( pxCursor->pxItem == NULL ) || ( pxCursor->uxGeneration != uxTaskNumber ) )
         {
-            /* Free up the memory allocated for the task's TLS Block. */
-            configDEINIT_TLS_BLOCK( pxTCB->xTLSBlock );
+            pxCursor->uxGeneration = uxTaskNumber;
+            pxCursor->pxItem = listGET_HEAD_ENTRY( &xTaskRegistry );
+
+            while( ( pxCursor->xLastVisited != 0U ) &&
+                   ( pxCursor->pxItem != listGET_END_MARKER( &xTaskRegistry ) ) &&
+                   ( listGET_LIST_ITEM_VALUE( pxCursor->pxItem ) <= pxCursor->xLastVisited ) )
+            {
+                pxCursor->pxItem = listGET_NEXT( pxCursor->pxItem );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif
 
-        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+        if( pxCursor->pxItem != listGET_END_MARKER( &xTaskRegistry ) )
         {
-            /* The task can only have been allocated dynamically - free both
-             * the stack and TCB. */
-            vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
+            pxTCB = listGET_LIST_ITEM_OWNER( pxCursor->pxItem );
+            pxCursor->xLastVisited = listGET_LIST_ITEM_VALUE( pxCursor->pxItem );
+            pxCursor->pxItem = listGET_NEXT( pxCursor->pxItem );
         }
-        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+        else
         {
-            /* The task could have been allocated statically or dynamically, so
-             * check what was statically allocated before trying to free the
-             * memory. */
-            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
-            {
-                /* Both the stack and TCB were allocated dynamically, so both
-                 * must be freed. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
-            }
-            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
-            {
-                /* Only the stack was statically allocated, so the TCB is the
-                 * only memory that must be freed. */
-                vPortFree( pxTCB );
-            }
-            else
-            {
-                /* Neither the stack nor the TCB were allocated dynamically, so
-                 * nothing needs to be freed. */
-                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
-                mtCOVERAGE_TEST_MARKER();
-            }
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+        return pxTCB;
     }
 
-#endif /* INCLUDE_vTaskDelete */
+#endif /* tskUSE_TASK_REGISTRY */
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-    {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
-    }
-    else
+#if ( configUSE_SAMPLED_STACK_HIGH_WATER_MARK == 1 )
+
+    static configSTACK_DEPTH_TYPE prvTaskSampledFreeStackSpace( const TCB_t * pxTCB )
     {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+        #if ( portSTACK_GROWTH < 0 )
+        {
+            return ( configSTACK_DEPTH_TYPE ) ( pxTCB->pxStackHighWaterMark - pxTCB->pxStack );
+        }
+        #else
+        {
+            return ( configSTACK_DEPTH_TYPE ) ( pxTCB->pxEndOfStack - pxTCB->pxStackHighWaterMark );
+        }
+        #endif
     }
-}
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_RECURSIVE_MUTEXES == 1 ) ) || ( configNUMBER_OF_CORES > 1 )
+    configSTACK_DEPTH_TYPE uxTaskGetSampledStackHighWaterMark( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
 
-    #if ( configNUMBER_OF_CORES == 1 )
-        TaskHandle_t xTaskGetCurrentTaskHandle( void )
-        {
-            TaskHandle_t xReturn;
+        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( pxTCB != NULL );
 
-            traceENTER_xTaskGetCurrentTaskHandle();
+        return prvTaskSampledFreeStackSpace( pxTCB );
+    }
+/*-----------------------------------------------------------*/
 
-            /* A critical section is not required as this is not called from
-             * an interrupt and the current TCB will always be the same for any
-             * individual execution thread. */
-            xReturn = pxCurrentTCB;
+    UBaseType_t uxTaskGetStackReport( TaskStackStatus_t * const pxStackStatusArray,
+                                      const UBaseType_t uxArraySize )
+    {
+        TaskRegistryCursor_t xCursor = { NULL, 0U, 0U };
+        const TCB_t * pxTCB;
+        UBaseType_t uxTask = 0U;
+        BaseType_t xDone = pdFALSE;
 
-            traceRETURN_xTaskGetCurrentTaskHandle( xReturn );
+        configASSERT( ( pxStackStatusArray != NULL ) || ( uxArraySize == 0U ) );
 
-            return xReturn;
+        /* Visit one task per critical section, so interrupts are only masked
+         * for a few instructions at a time however many tasks there are. */
+        while( ( xDone == pdFALSE ) && ( uxTask < uxArraySize ) )
+        {
+            taskENTER_CRITICAL();
+            {
+                pxTCB = prvTaskRegistryNext( &xCursor );
+
+                if( pxTCB == NULL )
+                {
+                    xDone = pdTRUE;
+                }
+                else
+                {
+                    pxStackStatusArray[ uxTask ].xHandle = ( TaskHandle_t ) pxTCB;
+                    pxStackStatusArray[ uxTask ].pcTaskName = taskCOLD( pxTCB )->pcTaskName;
+                    pxStackStatusArray[ uxTask ].usStackHighWaterMark = prvTaskSampledFreeStackSpace( pxTCB );
+                    uxTask++;
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        return uxTask;
+    }
+
+#endif /* configUSE_SAMPLED_STACK_HIGH_WATER_MARK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+
+    static void prvTaskFillSnapshot( const TCB_t * pxTCB,
+                                     TaskSnapshot_t * pxSnapshot )
+    {
+        UBaseType_t uxSequence;
+        UBaseType_t uxAttempts = 0U;
+        BaseType_t xRunState;
+        BaseType_t xTransient;
+        const List_t * pxStateList;
+        const List_t * pxEventList;
+        configRUN_TIME_COUNTER_TYPE ulNow;
+
+        pxSnapshot->xHandle = ( TaskHandle_t ) pxTCB;
+        pxSnapshot->pcTaskName = taskCOLD( pxTCB )->pcTaskName;
+
+        do
+        {
+            /* An odd sequence means the kernel is part way through changing
+             * the task, on the other core or in an interrupt that preempted
+             * this read. */
+            do
+            {
+                uxSequence = pxTCB->uxSnapshotSequence;
+            } while( ( uxSequence & 1U ) != 0U );
+
+            portMEMORY_BARRIER();
+
+            xTransient = pdFALSE;
+            #if ( configNUMBER_OF_CORES == 1 )
+                xRunState = ( pxTCB == pxCurrentTCB ) ? ( BaseType_t ) 0 : taskTASK_NOT_RUNNING;
+            #else
+                xRunState = pxTCB->xTaskRunState;
+            #endif
+
+            pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+            pxEventList = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+
+            /* The same classification as eTaskGetState(), made from list
+             * pointers that are each read once. */
+            if( ( xRunState >= ( BaseType_t ) 0 ) && ( xRunState < ( BaseType_t ) configNUMBER_OF_CORES ) )
+            {
+                pxSnapshot->eCurrentState = eRunning;
+            }
+            else if( pxEventList == &xPendingReadyList )
+            {
+                pxSnapshot->eCurrentState = eReady;
+            }
+            else if( ( pxStateList == &xDelayedTaskList1 ) || ( pxStateList == &xDelayedTaskList2 ) )
+            {
+                pxSnapshot->eCurrentState = eBlocked;
+            }
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                else if( pxStateList == &xSuspendedTaskList )
+                {
+                    pxSnapshot->eCurrentState = ( pxEventList == NULL ) ? eSuspended : eBlocked;
+
+                    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                    {
+                        BaseType_t x;
+
+                        for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+                        {
+                            if( taskCOLD( pxTCB )->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                            {
+                                pxSnapshot->eCurrentState = eBlocked;
+                                break;
+                            }
+                        }
+                    }
+                    #endif
+                }
+            #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+                else if( pxStateList == &xTasksWaitingTermination )
+                {
+                    pxSnapshot->eCurrentState = eDeleted;
+                }
+            #endif
+            else if( pxStateList == NULL )
+            {
+                /* The task is between two lists, so has just been switched
+                 * out or is being moved by the kernel.  Look again, unless
+                 * this interrupted the move. */
+                xTransient = pdTRUE;
+                pxSnapshot->eCurrentState = eInvalid;
+            }
+            else
+            {
+                pxSnapshot->eCurrentState = eReady;
+            }
+
+            pxSnapshot->uxCurrentPriority = pxTCB->uxPriority;
+
+            #if ( configUSE_MUTEXES == 1 )
+            {
+                pxSnapshot->uxBasePriority = pxTCB->uxBasePriority;
+            }
+            #else
+            {
+                pxSnapshot->uxBasePriority = pxTCB->uxPriority;
+            }
+            #endif
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                pxSnapshot->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+
+                /* Add the part of the current slice that has already run. */
+                if( pxSnapshot->eCurrentState == eRunning )
+                {
+                    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                        portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+                    #else
+                        ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+                    #endif
+
+                    if( ulNow > ulTaskSwitchedInTime[ xRunState ] )
+                    {
+                        pxSnapshot->ulRunTimeCounter += ulNow - ulTaskSwitchedInTime[ xRunState ];
+                    }
+                }
+            }
+            #else
+            {
+                ( void ) ulNow;
+                pxSnapshot->ulRunTimeCounter = 0U;
+            }
+            #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+
+            #if ( configUSE_SAMPLED_STACK_HIGH_WATER_MARK == 1 )
+            {
+                pxSnapshot->usStackHighWaterMark = prvTaskSampledFreeStackSpace( pxTCB );
+            }
+            #else
+            {
+                pxSnapshot->usStackHighWaterMark = 0U;
+            }
+            #endif
+
+            portMEMORY_BARRIER();
+
+            if( uxSequence != pxTCB->uxSnapshotSequence )
+            {
+                xTransient = pdTRUE;
+                pxSnapshot->eCurrentState = eInvalid;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            uxAttempts++;
+        } while( ( xTransient != pdFALSE ) && ( uxAttempts < taskSNAPSHOT_MAX_ATTEMPTS ) );
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetSnapshot( TaskHandle_t xTask,
+                           TaskSnapshot_t * pxSnapshot )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( pxSnapshot != NULL );
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( pxTCB != NULL );
+
+        prvTaskFillSnapshot( pxTCB, pxSnapshot );
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskGetSystemSnapshot( TaskSnapshot_t * const pxSnapshotArray,
+                                         const UBaseType_t uxArraySize )
+    {
+        TaskRegistryCursor_t xCursor = { NULL, 0U, 0U };
+        const TCB_t * pxTCB;
+        UBaseType_t uxTask = 0U;
+        BaseType_t xDone = pdFALSE;
+
+        configASSERT( ( pxSnapshotArray != NULL ) || ( uxArraySize == 0U ) );
+
+        /* The critical section only keeps the task from being freed while it
+         * is read.  One task is visited per critical section and the scheduler
+         * is never suspended. */
+        while( ( xDone == pdFALSE ) && ( uxTask < uxArraySize ) )
+        {
+            taskENTER_CRITICAL();
+            {
+                pxTCB = prvTaskRegistryNext( &xCursor );
+
+                if( pxTCB == NULL )
+                {
+                    xDone = pdTRUE;
+                }
+                else
+                {
+                    prvTaskFillSnapshot( pxTCB, &( pxSnapshotArray[ uxTask ] ) );
+                    uxTask++;
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        return uxTask;
+    }
+
+#endif /* configUSE_TASK_SNAPSHOT */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_pxTaskGetStackStart == 1 )
+
+    uint8_t * pxTaskGetStackStart( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( pxTCB != NULL );
+
+        return ( uint8_t * ) pxTCB->pxStack;
+    }
+
+#endif /* INCLUDE_pxTaskGetStackStart */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+    static void prvDeleteTCB( TCB_t * pxTCB )
+    {
+        /* This call is required specifically for the TriCore port.  It must be
+         * above the vPortFree() calls.  The call is also used by ports/demos that
+         * want to allocate and clean RAM statically. */
+        portCLEAN_UP_TCB( pxTCB );
+
+        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+        {
+            /* Free up the memory allocated for the task's TLS Block. */
+            configDEINIT_TLS_BLOCK( taskCOLD( pxTCB )->xTLSBlock );
+        }
+        #endif
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+        {
+            /* The task can only have been allocated dynamically - free both
+             * the stack and TCB. */
+            vPortFreeStack( pxTCB->pxStack );
+            prvFreeTCB( pxTCB );
+        }
+        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+        {
+            /* The task could have been allocated statically or dynamically, so
+             * check what was statically allocated before trying to free the
+             * memory. */
+            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+            {
+                /* Both the stack and TCB were allocated dynamically, so both
+                 * must be freed. */
+                vPortFreeStack( pxTCB->pxStack );
+                prvFreeTCB( pxTCB );
+            }
+            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+            {
+                /* Only the stack was statically allocated, so the TCB is the
+                 * only memory that must be freed. */
+                prvFreeTCB( pxTCB );
+            }
+            else
+            {
+                /* Neither the stack nor the TCB were allocated dynamically, so
+                 * nothing needs to be freed. */
+                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+    }
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+static void prvResetNextTaskUnblockTime( void )
+{
+    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    {
+        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+         * the maximum possible value so it is  extremely unlikely that the
+         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+         * there is an item in the delayed list. */
+        xNextTaskUnblockTime = portMAX_DELAY;
+    }
+    else
+    {
+        /* The new current delayed list is not empty, get the value of
+         * the item at the head of the delayed list.  This is the time at
+         * which the task at the head of the delayed list should be removed
+         * from the Blocked state. */
+        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_RECURSIVE_MUTEXES == 1 ) ) || ( configNUMBER_OF_CORES > 1 )
+
+    #if ( configNUMBER_OF_CORES == 1 )
+        TaskHandle_t xTaskGetCurrentTaskHandle( void )
+        {
+            TaskHandle_t xReturn;
+
+            traceENTER_xTaskGetCurrentTaskHandle();
+
+            /* A critical section is not required as this is not called from
+             * an interrupt and the current TCB will always be the same for any
+             * individual execution thread. */
+            xReturn = pxCurrentTCB;
+
+            traceRETURN_xTaskGetCurrentTaskHandle( xReturn );
+
+            return xReturn;
         }
     #else /* #if ( configNUMBER_OF_CORES == 1 ) */
         TaskHandle_t xTaskGetCurrentTaskHandle( void )
@@ -6691,8 +8673,10 @@ static void prvResetNextTaskUnblockTime( void )
                     }
 
                     /* Inherit the priority before being moved into the new list. */
+                    taskSNAPSHOT_WRITE_BEGIN( pxMutexHolderTCB );
                     pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
-                    prvAddTaskToReadyList( pxMutexHolderTCB );
+                    taskSNAPSHOT_WRITE_END( pxMutexHolderTCB );
+                    prvReinsertTaskInReadyList( pxMutexHolderTCB );
                     #if ( configNUMBER_OF_CORES > 1 )
                     {
                         /* The priority of the task is raised. Yield for this task
@@ -6707,7 +8691,9 @@ static void prvResetNextTaskUnblockTime( void )
                 else
                 {
                     /* Just inherit the priority. */
+                    taskSNAPSHOT_WRITE_BEGIN( pxMutexHolderTCB );
                     pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
+                    taskSNAPSHOT_WRITE_END( pxMutexHolderTCB );
                 }
 
                 traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
@@ -6790,13 +8776,15 @@ static void prvResetNextTaskUnblockTime( void )
                     /* Disinherit the priority before adding the task into the
                      * new  ready list. */
                     traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+                    taskSNAPSHOT_WRITE_BEGIN( pxTCB );
                     pxTCB->uxPriority = pxTCB->uxBasePriority;
+                    taskSNAPSHOT_WRITE_END( pxTCB );
 
                     /* Reset the event list item value.  It cannot be in use for
                      * any other purpose if this task is running, and it must be
                      * running to give back the mutex. */
                     listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority );
-                    prvAddTaskToReadyList( pxTCB );
+                    prvReinsertTaskInReadyList( pxTCB );
                     #if ( configNUMBER_OF_CORES > 1 )
                     {
                         /* The priority of the task is dropped. Yield the core on
@@ -6890,7 +8878,9 @@ static void prvResetNextTaskUnblockTime( void )
                      * state. */
                     traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
                     uxPriorityUsedOnEntry = pxTCB->uxPriority;
+                    taskSNAPSHOT_WRITE_BEGIN( pxTCB );
                     pxTCB->uxPriority = uxPriorityToUse;
+                    taskSNAPSHOT_WRITE_END( pxTCB );
 
                     /* Only reset the event list item value if the value is not
                      * being used for anything else. */
@@ -6923,7 +8913,7 @@ static void prvResetNextTaskUnblockTime( void )
                             mtCOVERAGE_TEST_MARKER();
                         }
 
-                        prvAddTaskToReadyList( pxTCB );
+                        prvReinsertTaskInReadyList( pxTCB );
                         #if ( configNUMBER_OF_CORES > 1 )
                         {
                             /* The priority of the task is dropped. Yield the core on
@@ -7015,6 +9005,12 @@ static void prvResetNextTaskUnblockTime( void )
             if( pxCurrentTCB->uxCriticalNesting == 1U )
             {
                 portASSERT_IF_IN_ISR();
+
+                #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+                {
+                    vLatencyHistogramSectionEnter( eLatencyInterruptsMasked, ( uint32_t ) portLATENCY_CALLER_ADDRESS() );
+                }
+                #endif
             }
         }
         else
@@ -7066,9 +9062,17 @@ static void prvResetNextTaskUnblockTime( void )
                          * used within vTaskSwitchContext(). */
                         prvCheckForRunStateChange();
                     }
-                }
-            }
-            else
+
+                    #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+                    {
+                        /* Started after prvCheckForRunStateChange(), which can
+                         * briefly unmask interrupts to let this task be moved. */
+                        vLatencyHistogramSectionEnter( eLatencyInterruptsMasked, ( uint32_t ) portLATENCY_CALLER_ADDRESS() );
+                    }
+                    #endif
+                }
+            }
+            else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
@@ -7136,6 +9140,12 @@ static void prvResetNextTaskUnblockTime( void )
 
                 if( pxCurrentTCB->uxCriticalNesting == 0U )
                 {
+                    #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+                    {
+                        vLatencyHistogramSectionExit( eLatencyInterruptsMasked );
+                    }
+                    #endif
+
                     portENABLE_INTERRUPTS();
                 }
                 else
@@ -7188,6 +9198,12 @@ static void prvResetNextTaskUnblockTime( void )
                     /* Get the xYieldPending stats inside the critical section. */
                     xYieldCurrentTask = xYieldPendings[ xCoreID ];
 
+                    #if ( configUSE_LATENCY_HISTOGRAMS == 1 )
+                    {
+                        vLatencyHistogramSectionExit( eLatencyInterruptsMasked );
+                    }
+                    #endif
+
                     portRELEASE_ISR_LOCK( xCoreID );
                     portRELEASE_TASK_LOCK( xCoreID );
                     portENABLE_INTERRUPTS();
@@ -7711,7 +9727,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
         /* If the notification count is zero, and if we are willing to wait for a
          * notification, then block the task and wait. */
-        if( ( pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] == 0U ) && ( xTicksToWait > ( TickType_t ) 0 ) )
+        if( ( taskCOLD( pxCurrentTCB )->ulNotifiedValue[ uxIndexToWaitOn ] == 0U ) && ( xTicksToWait > ( TickType_t ) 0 ) )
         {
             /* We suspend the scheduler here as prvAddCurrentTaskToDelayedList is a
              * non-deterministic operation. */
@@ -7724,10 +9740,10 @@ TickType_t uxTaskResetEventItemValue( void )
                 taskENTER_CRITICAL();
                 {
                     /* Only block if the notification count is not already non-zero. */
-                    if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] == 0U )
+                    if( taskCOLD( pxCurrentTCB )->ulNotifiedValue[ uxIndexToWaitOn ] == 0U )
                     {
                         /* Mark this task as waiting for a notification. */
-                        pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
+                        taskCOLD( pxCurrentTCB )->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
 
                         /* Arrange to wait for a notification. */
                         xShouldBlock = pdTRUE;
@@ -7768,17 +9784,17 @@ TickType_t uxTaskResetEventItemValue( void )
         taskENTER_CRITICAL();
         {
             traceTASK_NOTIFY_TAKE( uxIndexToWaitOn );
-            ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
+            ulReturn = taskCOLD( pxCurrentTCB )->ulNotifiedValue[ uxIndexToWaitOn ];
 
             if( ulReturn != 0U )
             {
                 if( xClearCountOnExit != pdFALSE )
                 {
-                    pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] = ( uint32_t ) 0U;
+                    taskCOLD( pxCurrentTCB )->ulNotifiedValue[ uxIndexToWaitOn ] = ( uint32_t ) 0U;
                 }
                 else
                 {
-                    pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] = ulReturn - ( uint32_t ) 1;
+                    taskCOLD( pxCurrentTCB )->ulNotifiedValue[ uxIndexToWaitOn ] = ulReturn - ( uint32_t ) 1;
                 }
             }
             else
@@ -7786,7 +9802,7 @@ TickType_t uxTaskResetEventItemValue( void )
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
+            taskCOLD( pxCurrentTCB )->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
         }
         taskEXIT_CRITICAL();
 
@@ -7814,7 +9830,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
         /* If the task hasn't received a notification, and if we are willing to wait
          * for it, then block the task and wait. */
-        if( ( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED ) && ( xTicksToWait > ( TickType_t ) 0 ) )
+        if( ( taskCOLD( pxCurrentTCB )->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED ) && ( xTicksToWait > ( TickType_t ) 0 ) )
         {
             /* We suspend the scheduler here as prvAddCurrentTaskToDelayedList is a
              * non-deterministic operation. */
@@ -7826,15 +9842,15 @@ TickType_t uxTaskResetEventItemValue( void )
                 taskENTER_CRITICAL();
                 {
                     /* Only block if a notification is not already pending. */
-                    if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED )
+                    if( taskCOLD( pxCurrentTCB )->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED )
                     {
                         /* Clear bits in the task's notification value as bits may get
                          * set by the notifying task or interrupt. This can be used
                          * to clear the value to zero. */
-                        pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToClearOnEntry;
+                        taskCOLD( pxCurrentTCB )->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToClearOnEntry;
 
                         /* Mark this task as waiting for a notification. */
-                        pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
+                        taskCOLD( pxCurrentTCB )->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
 
                         /* Arrange to wait for a notification. */
                         xShouldBlock = pdTRUE;
@@ -7880,14 +9896,14 @@ TickType_t uxTaskResetEventItemValue( void )
             {
                 /* Output the current notification value, which may or may not
                  * have changed. */
-                *pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
+                *pulNotificationValue = taskCOLD( pxCurrentTCB )->ulNotifiedValue[ uxIndexToWaitOn ];
             }
 
             /* If ucNotifyValue is set then either the task never entered the
              * blocked state (because a notification was already pending) or the
              * task unblocked because of a notification.  Otherwise the task
              * unblocked because of a timeout. */
-            if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED )
+            if( taskCOLD( pxCurrentTCB )->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED )
             {
                 /* A notification was not received. */
                 xReturn = pdFALSE;
@@ -7896,11 +9912,11 @@ TickType_t uxTaskResetEventItemValue( void )
             {
                 /* A notification was already pending or a notification was
                  * received while the task was waiting. */
-                pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToClearOnExit;
+                taskCOLD( pxCurrentTCB )->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToClearOnExit;
                 xReturn = pdTRUE;
             }
 
-            pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
+            taskCOLD( pxCurrentTCB )->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
         }
         taskEXIT_CRITICAL();
 
@@ -7934,32 +9950,32 @@ TickType_t uxTaskResetEventItemValue( void )
         {
             if( pulPreviousNotificationValue != NULL )
             {
-                *pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+                *pulPreviousNotificationValue = taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ];
             }
 
-            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+            ucOriginalNotifyState = taskCOLD( pxTCB )->ucNotifyState[ uxIndexToNotify ];
 
-            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+            taskCOLD( pxTCB )->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
             switch( eAction )
             {
                 case eSetBits:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+                    taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
                     break;
 
                 case eIncrement:
-                    ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+                    ( taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] )++;
                     break;
 
                 case eSetValueWithOverwrite:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                    taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
                     break;
 
                 case eSetValueWithoutOverwrite:
 
                     if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
                     {
-                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                        taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
                     }
                     else
                     {
@@ -8078,31 +10094,31 @@ TickType_t uxTaskResetEventItemValue( void )
         {
             if( pulPreviousNotificationValue != NULL )
             {
-                *pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+                *pulPreviousNotificationValue = taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ];
             }
 
-            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
-            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+            ucOriginalNotifyState = taskCOLD( pxTCB )->ucNotifyState[ uxIndexToNotify ];
+            taskCOLD( pxTCB )->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
             switch( eAction )
             {
                 case eSetBits:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+                    taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
                     break;
 
                 case eIncrement:
-                    ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+                    ( taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] )++;
                     break;
 
                 case eSetValueWithOverwrite:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                    taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
                     break;
 
                 case eSetValueWithoutOverwrite:
 
                     if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
                     {
-                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                        taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
                     }
                     else
                     {
@@ -8162,11 +10178,12 @@ TickType_t uxTaskResetEventItemValue( void )
                     /* The delayed and ready lists cannot be accessed, so hold
                      * this task pending until the scheduler is resumed. */
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                    taskRECORD_TASK_READY( pxTCB );
                 }
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8254,12 +10271,12 @@ TickType_t uxTaskResetEventItemValue( void )
         /* coverity[misra_c_2012_directive_4_7_violation] */
         uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
         {
-            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
-            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+            ucOriginalNotifyState = taskCOLD( pxTCB )->ucNotifyState[ uxIndexToNotify ];
+            taskCOLD( pxTCB )->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
             /* 'Giving' is equivalent to incrementing a count in a counting
              * semaphore. */
-            ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+            ( taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToNotify ] )++;
 
             traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify );
 
@@ -8296,11 +10313,12 @@ TickType_t uxTaskResetEventItemValue( void )
                     /* The delayed and ready lists cannot be accessed, so hold
                      * this task pending until the scheduler is resumed. */
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                    taskRECORD_TASK_READY( pxTCB );
                 }
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8365,9 +10383,9 @@ TickType_t uxTaskResetEventItemValue( void )
 
         taskENTER_CRITICAL();
         {
-            if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
+            if( taskCOLD( pxTCB )->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
             {
-                pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
+                taskCOLD( pxTCB )->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
                 xReturn = pdPASS;
             }
             else
@@ -8407,8 +10425,8 @@ TickType_t uxTaskResetEventItemValue( void )
         {
             /* Return the notification as it was before the bits were cleared,
              * then clear the bit mask. */
-            ulReturn = pxTCB->ulNotifiedValue[ uxIndexToClear ];
-            pxTCB->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
+            ulReturn = taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToClear ];
+            taskCOLD( pxTCB )->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
         }
         taskEXIT_CRITICAL();
 
@@ -8586,244 +10604,3682 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
-                                            const BaseType_t xCanBlockIndefinitely )
-{
-    TickType_t xTimeToWake;
-    const TickType_t xConstTickCount = xTickCount;
-    List_t * const pxDelayedList = pxDelayedTaskList;
-    List_t * const pxOverflowDelayedList = pxOverflowDelayedTaskList;
+#if ( configUSE_CORE_RUN_TIME_STATS == 1 )
 
-    #if ( INCLUDE_xTaskAbortDelay == 1 )
+    static void prvAccountCoreRunTime( BaseType_t xCoreID,
+                                       TCB_t * pxTCB,
+                                       configRUN_TIME_COUNTER_TYPE ulNow )
     {
-        /* About to enter a delayed list, so ensure the ucDelayAborted flag is
-         * reset to pdFALSE so it can be detected as having been set to pdTRUE
-         * when the task leaves the Blocked state. */
-        pxCurrentTCB->ucDelayAborted = ( uint8_t ) pdFALSE;
-    }
-    #endif
+        configRUN_TIME_COUNTER_TYPE ulSlice = 0U;
 
-    /* Remove the task from the ready list before adding it to the blocked list
-     * as the same list item is used for both lists. */
-    if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-    {
-        /* The current task must be in a ready list, so there is no need to
-         * check, and the port reset macro can be called directly. */
-        portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
-    }
+        if( ulNow > ulTaskSwitchedInTime[ xCoreID ] )
+        {
+            ulSlice = ulNow - ulTaskSwitchedInTime[ xCoreID ];
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-    #if ( INCLUDE_vTaskSuspend == 1 )
-    {
-        if( ( xTicksToWait == portMAX_DELAY ) && ( xCanBlockIndefinitely != pdFALSE ) )
+        /* Interrupts that ran during the slice are already in ulCoreISRTime. */
+        if( ulSlice > ulCoreISRTimeSinceSwitchedIn[ xCoreID ] )
         {
-            /* Add the task to the suspended task list instead of a delayed task
-             * list to ensure it is not woken by a timing event.  It will block
-             * indefinitely. */
-            listINSERT_END( &xSuspendedTaskList, &( pxCurrentTCB->xStateListItem ) );
+            ulSlice -= ulCoreISRTimeSinceSwitchedIn[ xCoreID ];
         }
         else
         {
-            /* Calculate the time at which the task should be woken if the event
-             * does not occur.  This may overflow but this doesn't matter, the
-             * kernel will manage it correctly. */
-            xTimeToWake = xConstTickCount + xTicksToWait;
+            ulSlice = 0U;
+        }
 
-            /* The list item will be inserted in wake time order. */
-            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+        uxCoreRunTimeSequence[ xCoreID ]++;
+        portMEMORY_BARRIER();
+        {
+            pxTCB->ulRunTimeCounter += ulSlice;
 
-            if( xTimeToWake < xConstTickCount )
+            if( taskTASK_IS_IDLE( pxTCB ) == pdTRUE )
             {
-                /* Wake time has overflowed.  Place this item in the overflow
-                 * list. */
-                traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST();
-                vListInsert( pxOverflowDelayedList, &( pxCurrentTCB->xStateListItem ) );
+                ulCoreIdleTime[ xCoreID ] += ulSlice;
             }
             else
             {
-                /* The wake time has not overflowed, so the current block list
-                 * is used. */
-                traceMOVED_TASK_TO_DELAYED_LIST();
-                vListInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ) );
-
-                /* If the task entering the blocked state was placed at the
-                 * head of the list of blocked tasks then xNextTaskUnblockTime
-                 * needs to be updated too. */
-                if( xTimeToWake < xNextTaskUnblockTime )
-                {
-                    xNextTaskUnblockTime = xTimeToWake;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                mtCOVERAGE_TEST_MARKER();
             }
+
+            ulCoreISRTimeSinceSwitchedIn[ xCoreID ] = 0U;
+            ulTaskSwitchedInTime[ xCoreID ] = ulNow;
         }
+        portMEMORY_BARRIER();
+        uxCoreRunTimeSequence[ xCoreID ]++;
     }
-    #else /* INCLUDE_vTaskSuspend */
-    {
-        /* Calculate the time at which the task should be woken if the event
-         * does not occur.  This may overflow but this doesn't matter, the kernel
-         * will manage it correctly. */
-        xTimeToWake = xConstTickCount + xTicksToWait;
+/*-----------------------------------------------------------*/
 
-        /* The list item will be inserted in wake time order. */
-        listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+    void vTaskRunTimeStatsISREnter( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xCoreID;
 
-        if( xTimeToWake < xConstTickCount )
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
         {
-            traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST();
-            /* Wake time has overflowed.  Place this item in the overflow list. */
-            vListInsert( pxOverflowDelayedList, &( pxCurrentTCB->xStateListItem ) );
+            xCoreID = ( BaseType_t ) portGET_CORE_ID();
+
+            if( uxCoreISRNesting[ xCoreID ] == 0U )
+            {
+                ulCoreISREnterTime[ xCoreID ] = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            uxCoreISRNesting[ xCoreID ]++;
         }
-        else
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskRunTimeStatsISRExit( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xCoreID;
+        configRUN_TIME_COUNTER_TYPE ulDuration;
+
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
         {
-            traceMOVED_TASK_TO_DELAYED_LIST();
-            /* The wake time has not overflowed, so the current block list is used. */
-            vListInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ) );
+            xCoreID = ( BaseType_t ) portGET_CORE_ID();
+            configASSERT( uxCoreISRNesting[ xCoreID ] > 0U );
 
-            /* If the task entering the blocked state was placed at the head of the
-             * list of blocked tasks then xNextTaskUnblockTime needs to be updated
-             * too. */
-            if( xTimeToWake < xNextTaskUnblockTime )
+            uxCoreISRNesting[ xCoreID ]--;
+
+            if( uxCoreISRNesting[ xCoreID ] == 0U )
             {
-                xNextTaskUnblockTime = xTimeToWake;
+                ulDuration = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE() - ulCoreISREnterTime[ xCoreID ];
+
+                uxCoreRunTimeSequence[ xCoreID ]++;
+                portMEMORY_BARRIER();
+                {
+                    ulCoreISRTime[ xCoreID ] += ulDuration;
+                    ulCoreISRTimeSinceSwitchedIn[ xCoreID ] += ulDuration;
+                }
+                portMEMORY_BARRIER();
+                uxCoreRunTimeSequence[ xCoreID ]++;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-
-        /* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
-        ( void ) xCanBlockIndefinitely;
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
     }
-    #endif /* INCLUDE_vTaskSuspend */
-}
 /*-----------------------------------------------------------*/
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
-
-    xMPU_SETTINGS * xTaskGetMPUSettings( TaskHandle_t xTask )
+    void vTaskGetCoreRunTimeStats( BaseType_t xCoreID,
+                                   CoreRunTimeStats_t * pxStats )
     {
+        UBaseType_t uxSequence;
+        configRUN_TIME_COUNTER_TYPE ulNow, ulSlice;
         TCB_t * pxTCB;
 
-        traceENTER_xTaskGetMPUSettings( xTask );
-
-        pxTCB = prvGetTCBFromHandle( xTask );
-        configASSERT( pxTCB != NULL );
+        configASSERT( taskVALID_CORE_ID( xCoreID ) == pdTRUE );
+        configASSERT( pxStats != NULL );
 
-        traceRETURN_xTaskGetMPUSettings( &( pxTCB->xMPUSettings ) );
+        do
+        {
+            uxSequence = uxCoreRunTimeSequence[ xCoreID ];
+            portMEMORY_BARRIER();
 
-        return &( pxTCB->xMPUSettings );
-    }
+            ulNow = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE();
+            pxStats->ulElapsedTime = ulNow - ulCoreRunTimeOrigin;
+            pxStats->ulIdleTime = ulCoreIdleTime[ xCoreID ];
+            pxStats->ulISRTime = ulCoreISRTime[ xCoreID ];
 
-#endif /* portUSING_MPU_WRAPPERS */
-/*-----------------------------------------------------------*/
+            /* Add the part of the current slice that has already been spent
+             * idle. */
+            #if ( configNUMBER_OF_CORES == 1 )
+                pxTCB = pxCurrentTCB;
+            #else
+                pxTCB = pxCurrentTCBs[ xCoreID ];
+            #endif
 
-/* Code below here allows additional code to be inserted into this source file,
- * especially where access to file scope functions and data is needed (for example
- * when performing module tests). */
+            if( ( pxTCB != NULL ) && ( taskTASK_IS_IDLE( pxTCB ) == pdTRUE ) && ( ulNow > ulTaskSwitchedInTime[ xCoreID ] ) )
+            {
+                ulSlice = ulNow - ulTaskSwitchedInTime[ xCoreID ];
 
-#ifdef FREERTOS_MODULE_TEST
-    #include "tasks_test_access_functions.h"
-#endif
+                if( ulSlice > ulCoreISRTimeSinceSwitchedIn[ xCoreID ] )
+                {
+                    pxStats->ulIdleTime += ulSlice - ulCoreISRTimeSinceSwitchedIn[ xCoreID ];
+                }
+            }
 
+            portMEMORY_BARRIER();
+        } while( ( ( uxSequence & 1U ) != 0U ) || ( uxSequence != uxCoreRunTimeSequence[ xCoreID ] ) );
+    }
+/*-----------------------------------------------------------*/
 
-#if ( configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H == 1 )
+    configRUN_TIME_COUNTER_TYPE ulTaskGetCoreIdleRunTimePercent( BaseType_t xCoreID )
+    {
+        CoreRunTimeStats_t xStats;
+        configRUN_TIME_COUNTER_TYPE ulReturn = 0U;
 
-    #include "freertos_tasks_c_additions.h"
+        vTaskGetCoreRunTimeStats( xCoreID, &xStats );
 
-    #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
-        static void freertos_tasks_c_additions_init( void )
+        /* Avoid divide by zero errors. */
+        if( xStats.ulElapsedTime > ( configRUN_TIME_COUNTER_TYPE ) 0 )
         {
-            FREERTOS_TASKS_C_ADDITIONS_INIT();
+            ulReturn = ( xStats.ulIdleTime * ( configRUN_TIME_COUNTER_TYPE ) 100U ) / xStats.ulElapsedTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-    #endif
 
-#endif /* if ( configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H == 1 ) */
+        return ulReturn;
+    }
 /*-----------------------------------------------------------*/
 
-#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
-
-/*
- * This is the kernel provided implementation of vApplicationGetIdleTaskMemory()
- * to provide the memory that is used by the Idle task. It is used when
- * configKERNEL_PROVIDED_STATIC_MEMORY is set to 1. The application can provide
- * it's own implementation of vApplicationGetIdleTaskMemory by setting
- * configKERNEL_PROVIDED_STATIC_MEMORY to 0 or leaving it undefined.
- */
-    void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
-                                        StackType_t ** ppxIdleTaskStackBuffer,
-                                        configSTACK_DEPTH_TYPE * puxIdleTaskStackSize )
+    configRUN_TIME_COUNTER_TYPE ulTaskGetCoreLoadPercent( BaseType_t xCoreID,
+                                                          CoreRunTimeStats_t * pxPreviousSample )
     {
-        static StaticTask_t xIdleTaskTCB;
-        static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+        CoreRunTimeStats_t xStats;
+        configRUN_TIME_COUNTER_TYPE ulElapsed, ulIdle;
+        configRUN_TIME_COUNTER_TYPE ulReturn = 0U;
 
-        *ppxIdleTaskTCBBuffer = &( xIdleTaskTCB );
-        *ppxIdleTaskStackBuffer = &( uxIdleTaskStack[ 0 ] );
-        *puxIdleTaskStackSize = configMINIMAL_STACK_SIZE;
-    }
+        configASSERT( pxPreviousSample != NULL );
 
-    #if ( configNUMBER_OF_CORES > 1 )
+        vTaskGetCoreRunTimeStats( xCoreID, &xStats );
 
-        void vApplicationGetPassiveIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
-                                                   StackType_t ** ppxIdleTaskStackBuffer,
-                                                   configSTACK_DEPTH_TYPE * puxIdleTaskStackSize,
-                                                   BaseType_t xPassiveIdleTaskIndex )
-        {
-            static StaticTask_t xIdleTaskTCBs[ configNUMBER_OF_CORES - 1 ];
-            static StackType_t uxIdleTaskStacks[ configNUMBER_OF_CORES - 1 ][ configMINIMAL_STACK_SIZE ];
+        ulElapsed = xStats.ulElapsedTime - pxPreviousSample->ulElapsedTime;
+        ulIdle = xStats.ulIdleTime - pxPreviousSample->ulIdleTime;
 
-            *ppxIdleTaskTCBBuffer = &( xIdleTaskTCBs[ xPassiveIdleTaskIndex ] );
-            *ppxIdleTaskStackBuffer = &( uxIdleTaskStacks[ xPassiveIdleTaskIndex ][ 0 ] );
-            *puxIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+        /* Avoid divide by zero errors. */
+        if( ( ulElapsed > ( configRUN_TIME_COUNTER_TYPE ) 0 ) && ( ulIdle <= ulElapsed ) )
+        {
+            ulReturn = ( ( ulElapsed - ulIdle ) * ( configRUN_TIME_COUNTER_TYPE ) 100U ) / ulElapsed;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
 
-    #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+        *pxPreviousSample = xStats;
 
-#endif /* #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 ) && ( portUSING_MPU_WRAPPERS == 0 ) ) */
+        return ulReturn;
+    }
+
+#endif /* configUSE_CORE_RUN_TIME_STATS */
 /*-----------------------------------------------------------*/
 
-#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 ) && ( portUSING_MPU_WRAPPERS == 0 ) && ( configUSE_TIMERS == 1 ) )
+#if ( configUSE_SMP_STATS == 1 )
 
-/*
- * This is the kernel provided implementation of vApplicationGetTimerTaskMemory()
- * to provide the memory that is used by the Timer service task. It is used when
- * configKERNEL_PROVIDED_STATIC_MEMORY is set to 1. The application can provide
- * it's own implementation of vApplicationGetTimerTaskMemory by setting
- * configKERNEL_PROVIDED_STATIC_MEMORY to 0 or leaving it undefined.
- */
-    void vApplicationGetTimerTaskMemory( StaticTask_t ** ppxTimerTaskTCBBuffer,
-                                         StackType_t ** ppxTimerTaskStackBuffer,
-                                         configSTACK_DEPTH_TYPE * puxTimerTaskStackSize )
+    static void prvSMPStatsTaskSwitched( BaseType_t xCoreID,
+                                         TCB_t * pxPreviousTCB,
+                                         BaseType_t xYieldRequested )
     {
-        static StaticTask_t xTimerTaskTCB;
-        static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
-
-        *ppxTimerTaskTCBBuffer = &( xTimerTaskTCB );
-        *ppxTimerTaskStackBuffer = &( uxTimerTaskStack[ 0 ] );
-        *puxTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
-    }
+        TCB_t * const pxTCB = pxCurrentTCBs[ xCoreID ];
+        CoreSMPStats_t * const pxStats = &( xCoreSMPStats[ xCoreID ] );
+        uint32_t ulLatency;
+        BaseType_t xWasted;
 
-#endif /* #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 ) && ( portUSING_MPU_WRAPPERS == 0 ) && ( configUSE_TIMERS == 1 ) ) */
-/*-----------------------------------------------------------*/
+        if( xYieldRequested != pdFALSE )
+        {
+            ulLatency = ( uint32_t ) portSMP_STATS_TIMESTAMP() - ulYieldRequestTime[ xCoreID ];
+            xWasted = ( pxTCB == pxPreviousTCB ) ? pdTRUE : pdFALSE;
 
-/*
- * Reset the state in this file. This state is normally initialized at start up.
- * This function must be called by the application before restarting the
- * scheduler.
- */
-void vTaskResetState( void )
-{
-    BaseType_t xCoreID;
+            pxStats->ulYieldRequestsReceived++;
+            pxStats->ulTotalYieldLatency += ulLatency;
 
-    /* Task control block. */
-    #if ( configNUMBER_OF_CORES == 1 )
-    {
+            if( ulLatency > pxStats->ulMaxYieldLatency )
+            {
+                pxStats->ulMaxYieldLatency = ulLatency;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xWasted != pdFALSE )
+            {
+                pxStats->ulWastedYields++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxPreviousTCB->ulYieldRequests++;
+            traceYIELD_CORE_RECEIVED( xWasted, ulLatency );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxTCB->xLastRunCore != xCoreID )
+        {
+            if( pxTCB->xLastRunCore != taskTASK_NOT_RUNNING )
+            {
+                pxTCB->ulMigrations++;
+                pxStats->ulMigrationsIn++;
+                traceTASK_MIGRATED( pxTCB, pxTCB->xLastRunCore );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->xLastRunCore = xCoreID;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetCoreSMPStats( BaseType_t xCoreID,
+                               CoreSMPStats_t * pxStats )
+    {
+        configASSERT( taskVALID_CORE_ID( xCoreID ) == pdTRUE );
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = xCoreSMPStats[ xCoreID ];
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetSMPStats( TaskHandle_t xTask,
+                           TaskSMPStats_t * pxStats )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            pxStats->xLastRunCore = pxTCB->xLastRunCore;
+            pxStats->ulMigrations = pxTCB->ulMigrations;
+            pxStats->ulYieldRequests = pxTCB->ulYieldRequests;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskResetSMPStats( void )
+    {
+        taskENTER_CRITICAL();
+        {
+            ( void ) memset( xCoreSMPStats, 0x00, sizeof( xCoreSMPStats ) );
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_SMP_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_JOB_MONITOR == 1 )
+
+    static configRUN_TIME_COUNTER_TYPE prvJobTimeNow( void )
+    {
+        configRUN_TIME_COUNTER_TYPE ulNow;
+
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+        {
+            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+            #else
+                ulNow = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE();
+            #endif
+        }
+        #else
+        {
+            ulNow = ( configRUN_TIME_COUNTER_TYPE ) xTickCount;
+        }
+        #endif
+
+        return ulNow;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+/* Run time of the task running on xCoreID, including the current slice. */
+        static configRUN_TIME_COUNTER_TYPE prvJobRunTime( const TCB_t * pxTCB,
+                                                          BaseType_t xCoreID,
+                                                          configRUN_TIME_COUNTER_TYPE ulNow )
+        {
+            configRUN_TIME_COUNTER_TYPE ulRunTime = pxTCB->ulRunTimeCounter;
+
+            if( ulNow > ulTaskSwitchedInTime[ xCoreID ] )
+            {
+                ulRunTime += ulNow - ulTaskSwitchedInTime[ xCoreID ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return ulRunTime;
+        }
+
+    #endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
+    static void prvJobReleased( TCB_t * pxTCB )
+    {
+        JobMonitor_t * const pxMonitor = pxTCB->pxJobMonitor;
+
+        if( pxMonitor->uxState == taskJOB_WAITING )
+        {
+            pxMonitor->ulReleaseTime = prvJobTimeNow();
+
+            /* A periodic job is due at the wake time passed to
+             * xTaskDelayUntil(), even if the task was readied late. */
+            if( pxMonitor->xStats.xPeriod != ( TickType_t ) 0U )
+            {
+                pxMonitor->xReleaseTick = pxMonitor->xNextReleaseTick;
+            }
+            else
+            {
+                pxMonitor->xReleaseTick = xTickCount;
+            }
+
+            pxMonitor->uxState = taskJOB_RELEASED;
+        }
+        else
+        {
+            /* The task was made ready part way through a job, for example
+             * after blocking on a queue. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvJobStarted( TCB_t * pxTCB,
+                               BaseType_t xCoreID )
+    {
+        JobMonitor_t * const pxMonitor = pxTCB->pxJobMonitor;
+        configRUN_TIME_COUNTER_TYPE ulNow, ulJitter;
+
+        if( pxMonitor->uxState == taskJOB_RELEASED )
+        {
+            ulNow = prvJobTimeNow();
+            ulJitter = ulNow - pxMonitor->ulReleaseTime;
+
+            if( ulJitter > pxMonitor->xStats.ulMaxReleaseJitter )
+            {
+                pxMonitor->xStats.ulMaxReleaseJitter = ulJitter;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                pxMonitor->ulRunTimeAtStart = prvJobRunTime( pxTCB, xCoreID, ulNow );
+            }
+            #else
+            {
+                ( void ) xCoreID;
+            }
+            #endif
+
+            pxMonitor->uxState = taskJOB_RUNNING;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvJobComplete( TickType_t xPeriod,
+                                TickType_t xNextReleaseTick )
+    {
+        TCB_t * pxTCB;
+        JobMonitor_t * pxMonitor;
+        JobStats_t * pxStats;
+        BaseType_t xCoreID;
+        configRUN_TIME_COUNTER_TYPE ulNow, ulResponseTime;
+        TickType_t xDeadline, xElapsed;
+        BaseType_t xMissed = pdFALSE;
+        TickType_t xTicksLate = 0U;
+
+        taskENTER_CRITICAL();
+        {
+            #if ( configNUMBER_OF_CORES == 1 )
+                xCoreID = 0;
+                pxTCB = pxCurrentTCB;
+            #else
+                xCoreID = ( BaseType_t ) portGET_CORE_ID();
+                pxTCB = pxCurrentTCBs[ xCoreID ];
+            #endif
+
+            pxMonitor = pxTCB->pxJobMonitor;
+
+            if( pxMonitor != NULL )
+            {
+                pxStats = &( pxMonitor->xStats );
+
+                /* A task that had not started a job when the monitor was
+                 * attached has nothing to complete. */
+                if( pxMonitor->uxState == taskJOB_RUNNING )
+                {
+                    ulNow = prvJobTimeNow();
+                    ulResponseTime = ulNow - pxMonitor->ulReleaseTime;
+
+                    pxStats->ulLastResponseTime = ulResponseTime;
+
+                    if( ( pxStats->ulCompletedJobs == 0U ) || ( ulResponseTime < pxStats->ulMinResponseTime ) )
+                    {
+                        pxStats->ulMinResponseTime = ulResponseTime;
+                    }
+
+                    if( ulResponseTime > pxStats->ulMaxResponseTime )
+                    {
+                        pxStats->ulMaxResponseTime = ulResponseTime;
+                    }
+
+                    #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                    {
+                        pxStats->ulLastExecutionTime = prvJobRunTime( pxTCB, xCoreID, ulNow ) - pxMonitor->ulRunTimeAtStart;
+
+                        if( pxStats->ulLastExecutionTime > pxStats->ulMaxExecutionTime )
+                        {
+                            pxStats->ulMaxExecutionTime = pxStats->ulLastExecutionTime;
+                        }
+                    }
+                    #else
+                    {
+                        ( void ) xCoreID;
+                    }
+                    #endif
+
+                    /* The deadline tick has passed once the tick count reaches
+                     * it, so the check is exact to the tick. */
+                    xDeadline = ( pxMonitor->xRelativeDeadline != ( TickType_t ) 0U ) ? pxMonitor->xRelativeDeadline : pxStats->xPeriod;
+                    xElapsed = xTickCount - pxMonitor->xReleaseTick;
+
+                    if( ( xDeadline != ( TickType_t ) 0U ) && ( xElapsed >= xDeadline ) )
+                    {
+                        xMissed = pdTRUE;
+                        xTicksLate = xElapsed - xDeadline;
+                        pxStats->ulDeadlineMisses++;
+
+                        if( xTicksLate > pxStats->xMaxLateness )
+                        {
+                            pxStats->xMaxLateness = xTicksLate;
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxStats->ulCompletedJobs++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxStats->xPeriod = xPeriod;
+                pxMonitor->xNextReleaseTick = xNextReleaseTick;
+                pxMonitor->uxState = taskJOB_WAITING;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        #if ( configUSE_DEADLINE_MISS_HOOK == 1 )
+        {
+            if( xMissed != pdFALSE )
+            {
+                vApplicationDeadlineMissHook( pxTCB, xTicksLate );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else
+        {
+            ( void ) xMissed;
+            ( void ) xTicksLate;
+        }
+        #endif
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetJobMonitor( TaskHandle_t xTask,
+                             JobMonitor_t * pxMonitor,
+                             TickType_t xRelativeDeadline )
+    {
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            if( pxMonitor != NULL )
+            {
+                ( void ) memset( ( void * ) pxMonitor, 0x00, sizeof( JobMonitor_t ) );
+                pxMonitor->xRelativeDeadline = xRelativeDeadline;
+                pxMonitor->uxState = taskJOB_WAITING;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->pxJobMonitor = pxMonitor;
+        }
+        taskEXIT_CRITICAL();
+
+        /* The calling task is already executing its first job. */
+        if( ( pxMonitor != NULL ) && ( pxTCB == xTaskGetCurrentTaskHandle() ) )
+        {
+            vTaskJobBegin();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskJobBegin( void )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xCoreID;
+
+        taskENTER_CRITICAL();
+        {
+            #if ( configNUMBER_OF_CORES == 1 )
+                xCoreID = 0;
+                pxTCB = pxCurrentTCB;
+            #else
+                xCoreID = ( BaseType_t ) portGET_CORE_ID();
+                pxTCB = pxCurrentTCBs[ xCoreID ];
+            #endif
+
+            /* If the task blocked between jobs it was released when it was
+             * made ready and started when it was switched in, so this only
+             * has an effect if the task did not block. */
+            if( pxTCB->pxJobMonitor != NULL )
+            {
+                prvJobReleased( pxTCB );
+                prvJobStarted( pxTCB, xCoreID );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskJobComplete( void )
+    {
+        prvJobComplete( ( TickType_t ) 0U, ( TickType_t ) 0U );
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetJobStats( TaskHandle_t xTask,
+                           JobStats_t * pxStats )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            if( pxTCB->pxJobMonitor != NULL )
+            {
+                *pxStats = pxTCB->pxJobMonitor->xStats;
+            }
+            else
+            {
+                ( void ) memset( ( void * ) pxStats, 0x00, sizeof( JobStats_t ) );
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_JOB_MONITOR */
+/*-----------------------------------------------------------*/
+
+#if ( ( taskUSE_RUN_TIME_BUDGETS == 1 ) || ( configUSE_IDLE_GOVERNOR == 1 ) )
+
+    static configRUN_TIME_COUNTER_TYPE prvGetRunTimeNow( void )
+    {
+        configRUN_TIME_COUNTER_TYPE ulNow;
+
+        #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+            portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+        #else
+            ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+        #endif
+
+        return ulNow;
+    }
+
+#endif /* if ( ( taskUSE_RUN_TIME_BUDGETS == 1 ) || ( configUSE_IDLE_GOVERNOR == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( taskUSE_RUN_TIME_BUDGETS == 1 )
+
+    #if ( ( configUSE_APERIODIC_SERVERS == 1 ) || ( configUSE_MIXED_CRITICALITY == 1 ) || ( configUSE_EXECUTION_BUDGETS == 1 ) )
+
+        static void prvSetPriorityWithoutYield( TCB_t * pxTCB,
+                                                UBaseType_t uxNewPriority )
+        {
+            const UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+
+            taskSNAPSHOT_WRITE_BEGIN( pxTCB );
+
+            #if ( configUSE_MUTEXES == 1 )
+            {
+                /* As in vTaskPrioritySet(), an inherited priority is only
+                 * replaced by a higher one. */
+                if( ( pxTCB->uxBasePriority == pxTCB->uxPriority ) || ( uxNewPriority > pxTCB->uxPriority ) )
+                {
+                    pxTCB->uxPriority = uxNewPriority;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxTCB->uxBasePriority = uxNewPriority;
+            }
+            #else /* if ( configUSE_MUTEXES == 1 ) */
+            {
+                pxTCB->uxPriority = uxNewPriority;
+            }
+            #endif /* if ( configUSE_MUTEXES == 1 ) */
+
+            taskSNAPSHOT_WRITE_END( pxTCB );
+
+            if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0U ) )
+            {
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( ( pxTCB->uxPriority != uxPriorityUsedOnEntry ) &&
+                ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+            {
+                if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                {
+                    portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvReinsertTaskInReadyList( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* if ( ( configUSE_APERIODIC_SERVERS == 1 ) || ( configUSE_MIXED_CRITICALITY == 1 ) || ( configUSE_EXECUTION_BUDGETS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+    #if ( ( INCLUDE_vTaskSuspend == 1 ) && ( ( configUSE_MIXED_CRITICALITY == 1 ) || ( configUSE_EXECUTION_BUDGETS == 1 ) ) )
+
+        static BaseType_t prvSuspendWithoutYield( TCB_t * pxTCB )
+        {
+            BaseType_t xReturn = pdFALSE;
+
+            if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) == pdFALSE )
+            {
+                traceTASK_SUSPEND( pxTCB );
+
+                #if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+                {
+                    prvThresholdRemove( pxTCB );
+                }
+                #endif
+
+                /* As vTaskSuspend(). */
+                if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                {
+                    taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+
+                #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                {
+                    BaseType_t x;
+
+                    for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+                    {
+                        if( taskCOLD( pxTCB )->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                        {
+                            taskCOLD( pxTCB )->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+                        }
+                    }
+                }
+                #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+
+                prvResetNextTaskUnblockTime();
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvResumeWithoutYield( TCB_t * pxTCB )
+        {
+            if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+            {
+                traceTASK_RESUME( pxTCB );
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                prvAddTaskToReadyList( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* if ( ( INCLUDE_vTaskSuspend == 1 ) && ( ( configUSE_MIXED_CRITICALITY == 1 ) || ( configUSE_EXECUTION_BUDGETS == 1 ) ) ) */
+
+#endif /* taskUSE_RUN_TIME_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APERIODIC_SERVERS == 1 )
+
+    static void prvServerCharge( AperiodicServer_t * pxServer,
+                                 configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        configRUN_TIME_COUNTER_TYPE ulUsed;
+
+        if( pxServer->xCharging != pdFALSE )
+        {
+            ulUsed = ulNow - pxServer->ulLastCharged;
+
+            if( ulUsed > pxServer->xStats.ulBudget )
+            {
+                /* Overrun since the last tick. */
+                ulUsed = pxServer->xStats.ulBudget;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxServer->xStats.ulBudget -= ulUsed;
+            pxServer->xStats.ulConsumed += ulUsed;
+            pxServer->ulActivationUsed += ulUsed;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxServer->ulLastCharged = ulNow;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvServerDeactivate( AperiodicServer_t * pxServer )
+    {
+        AperiodicServerReplenishment_t * pxReplenishment;
+
+        if( ( pxServer->xActive != pdFALSE ) && ( pxServer->ulActivationUsed != 0U ) )
+        {
+            if( pxServer->uxPending < ( UBaseType_t ) configAPERIODIC_SERVER_MAX_REPLENISHMENTS )
+            {
+                pxReplenishment = &( pxServer->xReplenishments[ pxServer->uxPending ] );
+                pxReplenishment->ulAmount = 0U;
+                pxServer->uxPending++;
+            }
+            else
+            {
+                /* Merge into the last replenishment, moving it later so the
+                 * budget is never returned early. */
+                pxReplenishment = &( pxServer->xReplenishments[ pxServer->uxPending - 1U ] );
+            }
+
+            pxReplenishment->ulTime = pxServer->ulActivationTime + pxServer->ulPeriod;
+            pxReplenishment->ulAmount += pxServer->ulActivationUsed;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxServer->xActive = pdFALSE;
+        pxServer->ulActivationUsed = 0U;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvServerExhausted( TCB_t * pxTCB )
+    {
+        AperiodicServer_t * const pxServer = pxTCB->pxAperiodicServer;
+
+        pxServer->xCharging = pdFALSE;
+        pxServer->xHigh = pdFALSE;
+        pxServer->xStats.ulExhaustions++;
+
+        if( pxServer->ePolicy == eSporadicServer )
+        {
+            prvServerDeactivate( pxServer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvSetPriorityWithoutYield( pxTCB, pxServer->uxLowPriority );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvServerSwitchedOut( TCB_t * pxTCB,
+                                      configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        AperiodicServer_t * const pxServer = pxTCB->pxAperiodicServer;
+
+        prvServerCharge( pxServer, ulNow );
+        pxServer->xCharging = pdFALSE;
+
+        if( ( pxServer->xHigh != pdFALSE ) && ( pxServer->xStats.ulBudget == 0U ) )
+        {
+            prvServerExhausted( pxTCB );
+        }
+        else if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) == pdFALSE )
+        {
+            /* The task blocked, which ends the activation of a sporadic
+             * server.  Being preempted does not. */
+            if( pxServer->ePolicy == eSporadicServer )
+            {
+                prvServerDeactivate( pxServer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvServerSwitchedIn( AperiodicServer_t * pxServer,
+                                     configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        pxServer->ulLastCharged = ulNow;
+
+        if( ( pxServer->xHigh != pdFALSE ) && ( pxServer->xStats.ulBudget != 0U ) )
+        {
+            pxServer->xCharging = pdTRUE;
+
+            if( pxServer->xActive == pdFALSE )
+            {
+                pxServer->xActive = pdTRUE;
+                pxServer->ulActivationTime = ulNow;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvServerReplenish( AperiodicServer_t * pxServer,
+                                    configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        UBaseType_t uxIndex;
+
+        if( pxServer->ePolicy == eSporadicServer )
+        {
+            while( ( pxServer->uxPending > 0U ) && ( taskRUN_TIME_REACHED( ulNow, pxServer->xReplenishments[ 0 ].ulTime ) ) )
+            {
+                pxServer->xStats.ulBudget += pxServer->xReplenishments[ 0 ].ulAmount;
+                pxServer->xStats.ulReplenishments++;
+                pxServer->uxPending--;
+
+                for( uxIndex = 0U; uxIndex < pxServer->uxPending; uxIndex++ )
+                {
+                    pxServer->xReplenishments[ uxIndex ] = pxServer->xReplenishments[ uxIndex + 1U ];
+                }
+            }
+
+            if( pxServer->xStats.ulBudget > pxServer->ulCapacity )
+            {
+                pxServer->xStats.ulBudget = pxServer->ulCapacity;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else if( taskRUN_TIME_REACHED( ulNow, pxServer->ulNextPeriod ) )
+        {
+            /* Skip any periods the tick missed, the budget does not carry
+             * over. */
+            pxServer->ulNextPeriod += pxServer->ulPeriod * ( ( ( ulNow - pxServer->ulNextPeriod ) / pxServer->ulPeriod ) + 1U );
+            pxServer->xStats.ulBudget = pxServer->ulCapacity;
+            pxServer->xStats.ulReplenishments++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvServersTick( void )
+    {
+        AperiodicServer_t * pxServer;
+        TCB_t * pxTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+        const configRUN_TIME_COUNTER_TYPE ulNow = prvGetRunTimeNow();
+
+        for( pxServer = pxAperiodicServers; pxServer != NULL; pxServer = pxServer->pxNext )
+        {
+            pxTCB = ( TCB_t * ) pxServer->pvTask;
+
+            /* Charge a task that is running on any core. */
+            prvServerCharge( pxServer, ulNow );
+            prvServerReplenish( pxServer, ulNow );
+
+            if( ( pxServer->xHigh != pdFALSE ) && ( pxServer->xStats.ulBudget == 0U ) )
+            {
+                prvServerExhausted( pxTCB );
+
+                #if ( configNUMBER_OF_CORES == 1 )
+                {
+                    if( pxTCB == pxCurrentTCB )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #else
+                {
+                    if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+                    {
+                        xYieldPendings[ pxTCB->xTaskRunState ] = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+            }
+            else if( ( pxServer->xHigh == pdFALSE ) && ( pxServer->xStats.ulBudget != 0U ) )
+            {
+                pxServer->xHigh = pdTRUE;
+                prvSetPriorityWithoutYield( pxTCB, pxServer->uxHighPriority );
+
+                if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+                {
+                    /* The task was running in the background. */
+                    prvServerSwitchedIn( pxServer, ulNow );
+                }
+                else if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    #if ( configNUMBER_OF_CORES == 1 )
+                    {
+                        if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #else
+                    {
+                        prvYieldForTask( pxTCB );
+                    }
+                    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+
+    static void prvServerUnlink( const AperiodicServer_t * pxServer )
+    {
+        AperiodicServer_t ** ppxLink;
+
+        for( ppxLink = &pxAperiodicServers; *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxNext ) )
+        {
+            if( *ppxLink == pxServer )
+            {
+                *ppxLink = pxServer->pxNext;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetAperiodicServer( TaskHandle_t xTask,
+                                  AperiodicServer_t * pxServer,
+                                  eAperiodicServerPolicy ePolicy,
+                                  UBaseType_t uxHighPriority,
+                                  UBaseType_t uxLowPriority,
+                                  configRUN_TIME_COUNTER_TYPE ulBudget,
+                                  configRUN_TIME_COUNTER_TYPE ulPeriod )
+    {
+        TCB_t * pxTCB;
+        configRUN_TIME_COUNTER_TYPE ulNow;
+        UBaseType_t uxPriority;
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( pxTCB != NULL );
+
+        if( pxServer != NULL )
+        {
+            configASSERT( uxHighPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+            configASSERT( uxLowPriority < uxHighPriority );
+            configASSERT( ( ulBudget != 0U ) && ( ulBudget <= ulPeriod ) );
+            configASSERT( ( ePolicy == eSporadicServer ) || ( ePolicy == eDeferrableServer ) );
+            uxPriority = uxHighPriority;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Detach the old server first, so neither a context switch nor the
+         * tick uses it while the task's priority changes, and it can be
+         * reinitialised below if pxServer is the same structure. */
+        taskENTER_CRITICAL();
+        {
+            if( pxTCB->pxAperiodicServer != NULL )
+            {
+                if( pxServer == NULL )
+                {
+                    uxPriority = pxTCB->pxAperiodicServer->uxHighPriority;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvServerUnlink( pxTCB->pxAperiodicServer );
+                pxTCB->pxAperiodicServer = NULL;
+            }
+            else
+            {
+                configASSERT( pxServer != NULL );
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        /* Let vTaskPrioritySet() take care of any yield before the server
+         * takes over the priority of the task. */
+        vTaskPrioritySet( pxTCB, uxPriority );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB->pxAperiodicServer = pxServer;
+
+            if( pxServer != NULL )
+            {
+                ( void ) memset( ( void * ) pxServer, 0x00, sizeof( AperiodicServer_t ) );
+                pxServer->pvTask = pxTCB;
+                pxServer->ePolicy = ePolicy;
+                pxServer->uxHighPriority = uxHighPriority;
+                pxServer->uxLowPriority = uxLowPriority;
+                pxServer->ulCapacity = ulBudget;
+                pxServer->ulPeriod = ulPeriod;
+                pxServer->xStats.ulBudget = ulBudget;
+                pxServer->xHigh = pdTRUE;
+
+                ulNow = prvGetRunTimeNow();
+                pxServer->ulNextPeriod = ulNow + ulPeriod;
+                pxServer->pxNext = pxAperiodicServers;
+                pxAperiodicServers = pxServer;
+
+                if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+                {
+                    prvServerSwitchedIn( pxServer, ulNow );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetAperiodicServerStats( TaskHandle_t xTask,
+                                       AperiodicServerStats_t * pxStats )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            if( pxTCB->pxAperiodicServer != NULL )
+            {
+                *pxStats = pxTCB->pxAperiodicServer->xStats;
+            }
+            else
+            {
+                ( void ) memset( ( void * ) pxStats, 0x00, sizeof( AperiodicServerStats_t ) );
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_APERIODIC_SERVERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MIXED_CRITICALITY == 1 )
+
+    static BaseType_t prvCriticalityCharge( Criticality_t * pxCriticality,
+                                            configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        BaseType_t xRaise = pdFALSE;
+
+        pxCriticality->ulJobTime += ulNow - pxCriticality->ulSwitchedInTime;
+        pxCriticality->ulSwitchedInTime = ulNow;
+
+        /* Each job is counted at most once against each budget. */
+        if( ( pxCriticality->xLowOverrun == pdFALSE ) && ( pxCriticality->ulJobTime > pxCriticality->ulLowBudget ) )
+        {
+            pxCriticality->xLowOverrun = pdTRUE;
+            xCriticalityStats.ulLowBudgetOverruns++;
+
+            if( ( pxCriticality->eLevel == eCriticalityHigh ) && ( eCriticalityMode == eCriticalityLow ) )
+            {
+                xRaise = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ( pxCriticality->eLevel == eCriticalityHigh ) &&
+            ( pxCriticality->xHighOverrun == pdFALSE ) &&
+            ( pxCriticality->ulJobTime > pxCriticality->ulHighBudget ) )
+        {
+            pxCriticality->xHighOverrun = pdTRUE;
+            xCriticalityStats.ulHighBudgetOverruns++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xRaise;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCriticalityHold( Criticality_t * pxCriticality )
+    {
+        TCB_t * const pxTCB = ( TCB_t * ) pxCriticality->pvTask;
+
+        #if ( INCLUDE_vTaskSuspend == 1 )
+            if( pxCriticality->eAction == eCriticalitySuspend )
+            {
+                /* A task the application suspended is left alone, and is not
+                 * resumed when the mode switches back. */
+                pxCriticality->xHeld = prvSuspendWithoutYield( pxTCB );
+            }
+            else
+        #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+        {
+            #if ( configUSE_MUTEXES == 1 )
+                pxCriticality->uxNormalPriority = pxTCB->uxBasePriority;
+            #else
+                pxCriticality->uxNormalPriority = pxTCB->uxPriority;
+            #endif
+
+            if( pxCriticality->uxDegradedPriority < pxCriticality->uxNormalPriority )
+            {
+                prvSetPriorityWithoutYield( pxTCB, pxCriticality->uxDegradedPriority );
+                pxCriticality->xHeld = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        #if ( configNUMBER_OF_CORES > 1 )
+        {
+            /* The core the caller runs on is about to select a task anyway. */
+            if( ( pxCriticality->xHeld != pdFALSE ) &&
+                ( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE ) &&
+                ( pxTCB->xTaskRunState != ( BaseType_t ) portGET_CORE_ID() ) )
+            {
+                prvYieldCore( pxTCB->xTaskRunState );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCriticalityRelease( Criticality_t * pxCriticality )
+    {
+        TCB_t * const pxTCB = ( TCB_t * ) pxCriticality->pvTask;
+
+        if( pxCriticality->xHeld != pdFALSE )
+        {
+            pxCriticality->xHeld = pdFALSE;
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                if( pxCriticality->eAction == eCriticalitySuspend )
+                {
+                    prvResumeWithoutYield( pxTCB );
+                }
+                else
+            #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+            {
+                prvSetPriorityWithoutYield( pxTCB, pxCriticality->uxNormalPriority );
+            }
+
+            #if ( configNUMBER_OF_CORES > 1 )
+            {
+                if( ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) &&
+                    ( taskTASK_IS_RUNNING( pxTCB ) == pdFALSE ) )
+                {
+                    prvYieldForTask( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCriticalitySetMode( eCriticalityLevel eMode,
+                                       configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        Criticality_t * pxCriticality;
+
+        traceCRITICALITY_MODE_SWITCH( eMode );
+
+        eCriticalityMode = eMode;
+
+        if( eMode == eCriticalityHigh )
+        {
+            xCriticalityStats.ulModeSwitches++;
+            ulCriticalityHighModeStart = ulNow;
+        }
+        else
+        {
+            xCriticalityStats.ulTimeInHighMode += ulNow - ulCriticalityHighModeStart;
+        }
+
+        for( pxCriticality = pxCriticalityTasks; pxCriticality != NULL; pxCriticality = pxCriticality->pxNext )
+        {
+            if( pxCriticality->eLevel == eCriticalityLow )
+            {
+                if( eMode == eCriticalityHigh )
+                {
+                    prvCriticalityHold( pxCriticality );
+                }
+                else
+                {
+                    prvCriticalityRelease( pxCriticality );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCriticalityHighTaskReady( void )
+    {
+        const Criticality_t * pxCriticality;
+        const TCB_t * pxTCB;
+        BaseType_t xReturn = pdFALSE;
+
+        /* Running tasks are also in their ready list. */
+        for( pxCriticality = pxCriticalityTasks; pxCriticality != NULL; pxCriticality = pxCriticality->pxNext )
+        {
+            pxTCB = ( const TCB_t * ) pxCriticality->pvTask;
+
+            if( ( pxCriticality->eLevel == eCriticalityHigh ) &&
+                ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+            {
+                xReturn = pdTRUE;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCriticalitySwitchedOut( TCB_t * pxTCB,
+                                           configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        Criticality_t * const pxCriticality = pxTCB->pxCriticality;
+
+        if( prvCriticalityCharge( pxCriticality, ulNow ) != pdFALSE )
+        {
+            prvCriticalitySetMode( eCriticalityHigh, ulNow );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) == pdFALSE )
+        {
+            /* The task blocked, which ends its job. */
+            pxCriticality->ulJobTime = 0U;
+            pxCriticality->xLowOverrun = pdFALSE;
+            pxCriticality->xHighOverrun = pdFALSE;
+
+            /* The last high criticality job has completed, so this is an idle
+             * instant for the high criticality tasks. */
+            if( ( pxCriticality->eLevel == eCriticalityHigh ) &&
+                ( eCriticalityMode == eCriticalityHigh ) &&
+                ( prvCriticalityHighTaskReady() == pdFALSE ) )
+            {
+                prvCriticalitySetMode( eCriticalityLow, ulNow );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCriticalityTick( void )
+    {
+        Criticality_t * pxCriticality;
+        BaseType_t xRaise = pdFALSE;
+        BaseType_t xSwitchRequired = pdFALSE;
+        const configRUN_TIME_COUNTER_TYPE ulNow = prvGetRunTimeNow();
+
+        for( pxCriticality = pxCriticalityTasks; pxCriticality != NULL; pxCriticality = pxCriticality->pxNext )
+        {
+            if( taskTASK_IS_RUNNING( ( TCB_t * ) pxCriticality->pvTask ) == pdTRUE )
+            {
+                if( prvCriticalityCharge( pxCriticality, ulNow ) != pdFALSE )
+                {
+                    xRaise = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xRaise != pdFALSE )
+        {
+            prvCriticalitySetMode( eCriticalityHigh, ulNow );
+            xSwitchRequired = pdTRUE;
+        }
+        else if( ( eCriticalityMode == eCriticalityHigh ) && ( prvCriticalityHighTaskReady() == pdFALSE ) )
+        {
+            prvCriticalitySetMode( eCriticalityLow, ulNow );
+            xSwitchRequired = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( INCLUDE_vTaskSuspend == 1 )
+
+        static void prvCriticalitySuspendOverridden( TCB_t * pxTCB )
+        {
+            Criticality_t * const pxCriticality = pxTCB->pxCriticality;
+
+            if( ( pxCriticality != NULL ) && ( pxCriticality->eAction == eCriticalitySuspend ) )
+            {
+                pxCriticality->xHeld = pdFALSE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+/*-----------------------------------------------------------*/
+
+    static void prvCriticalityUnlink( const Criticality_t * pxCriticality )
+    {
+        Criticality_t ** ppxLink;
+
+        for( ppxLink = &pxCriticalityTasks; *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxNext ) )
+        {
+            if( *ppxLink == pxCriticality )
+            {
+                *ppxLink = pxCriticality->pxNext;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetCriticality( TaskHandle_t xTask,
+                              Criticality_t * pxCriticality,
+                              eCriticalityLevel eLevel,
+                              configRUN_TIME_COUNTER_TYPE ulLowBudget,
+                              configRUN_TIME_COUNTER_TYPE ulHighBudget,
+                              eCriticalityAction eAction,
+                              UBaseType_t uxDegradedPriority )
+    {
+        TCB_t * pxTCB;
+
+        if( pxCriticality != NULL )
+        {
+            configASSERT( ( eLevel == eCriticalityLow ) || ( eLevel == eCriticalityHigh ) );
+            configASSERT( ( eLevel == eCriticalityLow ) || ( ulLowBudget <= ulHighBudget ) );
+            configASSERT( uxDegradedPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                configASSERT( ( eAction == eCriticalityDegrade ) || ( eAction == eCriticalitySuspend ) );
+            #else
+                configASSERT( eAction == eCriticalityDegrade );
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            if( pxTCB->pxCriticality != NULL )
+            {
+                prvCriticalityRelease( pxTCB->pxCriticality );
+                prvCriticalityUnlink( pxTCB->pxCriticality );
+
+                #if ( configNUMBER_OF_CORES == 1 )
+                {
+                    if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                    {
+                        taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->pxCriticality = pxCriticality;
+
+            if( pxCriticality != NULL )
+            {
+                /* Only initialised once the old configuration, which may be
+                 * the same structure, is no longer linked or held. */
+                ( void ) memset( ( void * ) pxCriticality, 0x00, sizeof( Criticality_t ) );
+                pxCriticality->eLevel = eLevel;
+                pxCriticality->eAction = eAction;
+                pxCriticality->ulLowBudget = ulLowBudget;
+                pxCriticality->ulHighBudget = ulHighBudget;
+                pxCriticality->uxDegradedPriority = uxDegradedPriority;
+                pxCriticality->pvTask = pxTCB;
+                pxCriticality->ulSwitchedInTime = prvGetRunTimeNow();
+                pxCriticality->pxNext = pxCriticalityTasks;
+                pxCriticalityTasks = pxCriticality;
+
+                /* A low criticality task added while the system is in high
+                 * criticality mode is held straight away, as the mode switch
+                 * would have done. */
+                if( ( eLevel == eCriticalityLow ) && ( eCriticalityMode == eCriticalityHigh ) )
+                {
+                    prvCriticalityHold( pxCriticality );
+
+                    #if ( configNUMBER_OF_CORES == 1 )
+                        if( ( pxCriticality->xHeld != pdFALSE ) && ( pxTCB == pxCurrentTCB ) )
+                    #else
+                        if( ( pxCriticality->xHeld != pdFALSE ) && ( pxTCB->xTaskRunState == ( BaseType_t ) portGET_CORE_ID() ) )
+                    #endif
+                    {
+                        /* prvCriticalityHold() leaves the calling core to
+                         * its caller. */
+                        #if ( configNUMBER_OF_CORES == 1 )
+                            portYIELD_WITHIN_API();
+                        #else
+                            prvYieldCore( pxTCB->xTaskRunState );
+                        #endif
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    eCriticalityLevel eTaskGetCriticalityMode( void )
+    {
+        return eCriticalityMode;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetCriticalityStats( CriticalityStats_t * pxStats )
+    {
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = xCriticalityStats;
+
+            if( eCriticalityMode == eCriticalityHigh )
+            {
+                pxStats->ulTimeInHighMode += prvGetRunTimeNow() - ulCriticalityHighModeStart;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_MIXED_CRITICALITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EXECUTION_BUDGETS == 1 )
+
+    static void prvBudgetCharge( ExecutionBudget_t * pxBudget,
+                                 configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        configRUN_TIME_COUNTER_TYPE ulUsed = ulNow - pxBudget->ulLastCharged;
+
+        pxBudget->ulLastCharged = ulNow;
+        pxBudget->xStats.ulConsumed += ulUsed;
+
+        if( ulUsed >= pxBudget->xStats.ulBudgetLeft )
+        {
+            pxBudget->xStats.ulBudgetLeft = 0U;
+        }
+        else
+        {
+            pxBudget->xStats.ulBudgetLeft -= ulUsed;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvBudgetEnforce( TCB_t * pxTCB )
+    {
+        ExecutionBudget_t * const pxBudget = pxTCB->pxExecutionBudget;
+        BaseType_t xEnforced = pdFALSE;
+
+        pxBudget->xOverrun = pdTRUE;
+        pxBudget->xStats.ulOverruns++;
+
+        #if ( configUSE_BUDGET_OVERRUN_HOOK == 1 )
+        {
+            vApplicationBudgetOverrunHook( pxTCB );
+        }
+        #endif
+
+        if( pxBudget->eAction == eBudgetDemote )
+        {
+            #if ( configUSE_MUTEXES == 1 )
+                pxBudget->uxNormalPriority = pxTCB->uxBasePriority;
+            #else
+                pxBudget->uxNormalPriority = pxTCB->uxPriority;
+            #endif
+
+            if( pxBudget->uxDemotedPriority < pxBudget->uxNormalPriority )
+            {
+                prvSetPriorityWithoutYield( pxTCB, pxBudget->uxDemotedPriority );
+                xEnforced = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        #if ( INCLUDE_vTaskSuspend == 1 )
+            else if( pxBudget->eAction == eBudgetSuspend )
+            {
+                xEnforced = prvSuspendWithoutYield( pxTCB );
+            }
+        #endif
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxBudget->xEnforced = xEnforced;
+
+        return xEnforced;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvBudgetRestore( TCB_t * pxTCB )
+    {
+        ExecutionBudget_t * const pxBudget = pxTCB->pxExecutionBudget;
+
+        if( pxBudget->xEnforced != pdFALSE )
+        {
+            pxBudget->xEnforced = pdFALSE;
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                if( pxBudget->eAction == eBudgetSuspend )
+                {
+                    prvResumeWithoutYield( pxTCB );
+                }
+                else
+            #endif
+            {
+                prvSetPriorityWithoutYield( pxTCB, pxBudget->uxNormalPriority );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( INCLUDE_vTaskSuspend == 1 )
+
+        static void prvBudgetSuspendOverridden( TCB_t * pxTCB )
+        {
+            ExecutionBudget_t * const pxBudget = pxTCB->pxExecutionBudget;
+
+            if( ( pxBudget != NULL ) && ( pxBudget->eAction == eBudgetSuspend ) )
+            {
+                /* The budget is still counted as used up, but the task stays
+                 * in whatever state the application left it in. */
+                pxBudget->xEnforced = pdFALSE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+/*-----------------------------------------------------------*/
+
+    static void prvBudgetSwitchedOut( TCB_t * pxTCB,
+                                      configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        ExecutionBudget_t * const pxBudget = pxTCB->pxExecutionBudget;
+
+        portEXECUTION_TIMER_STOP();
+        prvBudgetCharge( pxBudget, ulNow );
+
+        /* The next task is about to be selected, so no yield is needed. */
+        if( ( pxBudget->xOverrun == pdFALSE ) && ( pxBudget->xStats.ulBudgetLeft == 0U ) )
+        {
+            ( void ) prvBudgetEnforce( pxTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvBudgetSwitchedIn( ExecutionBudget_t * pxBudget,
+                                     configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        pxBudget->ulLastCharged = ulNow;
+
+        if( pxBudget->xStats.ulBudgetLeft != 0U )
+        {
+            portEXECUTION_TIMER_START( pxBudget->xStats.ulBudgetLeft );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvBudgetYield( const TCB_t * pxTCB )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            if( pxTCB == pxCurrentTCB )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else
+        {
+            if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+            {
+                if( pxTCB->xTaskRunState == ( BaseType_t ) portGET_CORE_ID() )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    prvYieldCore( pxTCB->xTaskRunState );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvBudgetsTick( void )
+    {
+        ExecutionBudget_t * pxBudget;
+        TCB_t * pxTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+        const configRUN_TIME_COUNTER_TYPE ulNow = prvGetRunTimeNow();
+
+        for( pxBudget = pxExecutionBudgets; pxBudget != NULL; pxBudget = pxBudget->pxNext )
+        {
+            pxTCB = ( TCB_t * ) pxBudget->pvTask;
+
+            /* Catches overruns on ports without an execution timer. */
+            if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+            {
+                prvBudgetCharge( pxBudget, ulNow );
+
+                if( ( pxBudget->xOverrun == pdFALSE ) && ( pxBudget->xStats.ulBudgetLeft == 0U ) )
+                {
+                    if( ( prvBudgetEnforce( pxTCB ) != pdFALSE ) && ( prvBudgetYield( pxTCB ) != pdFALSE ) )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( taskRUN_TIME_REACHED( ulNow, pxBudget->ulNextPeriod ) )
+            {
+                /* Skip any periods the tick missed, the budget does not carry
+                 * over. */
+                pxBudget->ulNextPeriod += pxBudget->ulPeriod * ( ( ( ulNow - pxBudget->ulNextPeriod ) / pxBudget->ulPeriod ) + 1U );
+                pxBudget->xStats.ulBudgetLeft = pxBudget->ulBudget;
+                pxBudget->xStats.ulPeriods++;
+                pxBudget->xOverrun = pdFALSE;
+                prvBudgetRestore( pxTCB );
+
+                if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+                {
+                    /* Rearm the execution timer of the core running the task
+                     * by switching it out and back in. */
+                    if( prvBudgetYield( pxTCB ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    #if ( configNUMBER_OF_CORES == 1 )
+                    {
+                        if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #else
+                    {
+                        prvYieldForTask( pxTCB );
+                    }
+                    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvBudgetUnlink( const ExecutionBudget_t * pxBudget )
+    {
+        ExecutionBudget_t ** ppxLink;
+
+        for( ppxLink = &pxExecutionBudgets; *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxNext ) )
+        {
+            if( *ppxLink == pxBudget )
+            {
+                *ppxLink = pxBudget->pxNext;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskExecutionTimerExpired( void )
+    {
+        TCB_t * pxTCB;
+        ExecutionBudget_t * pxBudget;
+        BaseType_t xSwitchRequired = pdFALSE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            pxTCB = pxCurrentTCB;
+            pxBudget = pxTCB->pxExecutionBudget;
+
+            /* The task that armed the timer may have been switched out just
+             * before it expired. */
+            if( ( pxBudget != NULL ) && ( pxBudget->xOverrun == pdFALSE ) )
+            {
+                prvBudgetCharge( pxBudget, prvGetRunTimeNow() );
+
+                if( pxBudget->xStats.ulBudgetLeft == 0U )
+                {
+                    if( prvBudgetEnforce( pxTCB ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Expired early, through rounding by the port. */
+                    portEXECUTION_TIMER_START( pxBudget->xStats.ulBudgetLeft );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetExecutionBudget( TaskHandle_t xTask,
+                                  ExecutionBudget_t * pxBudget,
+                                  configRUN_TIME_COUNTER_TYPE ulBudget,
+                                  configRUN_TIME_COUNTER_TYPE ulPeriod,
+                                  eBudgetAction eAction,
+                                  UBaseType_t uxDemotedPriority )
+    {
+        TCB_t * pxTCB;
+        configRUN_TIME_COUNTER_TYPE ulNow;
+
+        if( pxBudget != NULL )
+        {
+            configASSERT( ( ulBudget != 0U ) && ( ulBudget <= ulPeriod ) );
+            configASSERT( uxDemotedPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                configASSERT( ( eAction == eBudgetNotify ) || ( eAction == eBudgetDemote ) || ( eAction == eBudgetSuspend ) );
+            #else
+                configASSERT( ( eAction == eBudgetNotify ) || ( eAction == eBudgetDemote ) );
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            ulNow = prvGetRunTimeNow();
+
+            if( pxTCB->pxExecutionBudget != NULL )
+            {
+                prvBudgetRestore( pxTCB );
+                prvBudgetUnlink( pxTCB->pxExecutionBudget );
+
+                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxTCB == pxCurrentTCB )
+            {
+                portEXECUTION_TIMER_STOP();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->pxExecutionBudget = pxBudget;
+
+            if( pxBudget != NULL )
+            {
+                /* Only initialised once the old budget, which may be the same
+                 * structure, is no longer linked or enforced. */
+                ( void ) memset( ( void * ) pxBudget, 0x00, sizeof( ExecutionBudget_t ) );
+                pxBudget->eAction = eAction;
+                pxBudget->uxDemotedPriority = uxDemotedPriority;
+                pxBudget->ulBudget = ulBudget;
+                pxBudget->ulPeriod = ulPeriod;
+                pxBudget->xStats.ulBudgetLeft = ulBudget;
+                pxBudget->pvTask = pxTCB;
+                pxBudget->ulNextPeriod = ulNow + ulPeriod;
+                pxBudget->pxNext = pxExecutionBudgets;
+                pxExecutionBudgets = pxBudget;
+
+                /* A task running on another core is charged from the tick
+                 * until it is next switched in. */
+                if( pxTCB == pxCurrentTCB )
+                {
+                    prvBudgetSwitchedIn( pxBudget, ulNow );
+                }
+                else
+                {
+                    pxBudget->ulLastCharged = ulNow;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetExecutionBudgetStats( TaskHandle_t xTask,
+                                       ExecutionBudgetStats_t * pxStats )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            if( pxTCB->pxExecutionBudget != NULL )
+            {
+                *pxStats = pxTCB->pxExecutionBudget->xStats;
+            }
+            else
+            {
+                ( void ) memset( ( void * ) pxStats, 0x00, sizeof( ExecutionBudgetStats_t ) );
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_EXECUTION_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_GROUPS == 1 )
+
+    static void prvTaskGroupCharge( TCB_t * pxTCB,
+                                    configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        TaskGroup_t * const pxGroup = pxTCB->pxTaskGroup;
+        const configRUN_TIME_COUNTER_TYPE ulUsed = ulNow - pxTCB->ulTaskGroupCharged;
+
+        pxTCB->ulTaskGroupCharged = ulNow;
+        pxGroup->xStats.ulConsumed += ulUsed;
+
+        if( ulUsed >= pxGroup->xStats.ulBudgetLeft )
+        {
+            pxGroup->xStats.ulBudgetLeft = 0U;
+        }
+        else
+        {
+            pxGroup->xStats.ulBudgetLeft -= ulUsed;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTaskGroupHoldTask( TCB_t * pxTCB )
+    {
+        TaskGroup_t * const pxGroup = pxTCB->pxTaskGroup;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* Running tasks are also in their ready list. */
+        if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+        {
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            listINSERT_END( &( pxGroup->xHeldTasks ), &( pxTCB->xStateListItem ) );
+
+            #if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+            {
+                prvThresholdRemove( pxTCB );
+            }
+            #endif
+
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                if( pxTCB == pxCurrentTCB )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else
+            {
+                if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+                {
+                    if( pxTCB->xTaskRunState == ( BaseType_t ) portGET_CORE_ID() )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        prvYieldCore( pxTCB->xTaskRunState );
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTaskGroupDeplete( TaskGroup_t * pxGroup )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        traceTASK_GROUP_DEPLETED( pxGroup );
+
+        pxGroup->xDepleted = pdTRUE;
+        pxGroup->xStats.ulDepletions++;
+
+        for( pxTCB = ( TCB_t * ) pxGroup->pvMembers; pxTCB != NULL; pxTCB = pxTCB->pxNextTaskGroupMember )
+        {
+            if( prvTaskGroupHoldTask( pxTCB ) != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTaskGroupReplenish( TaskGroup_t * pxGroup )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        traceTASK_GROUP_REPLENISHED( pxGroup );
+
+        pxGroup->xDepleted = pdFALSE;
+        pxGroup->xStats.ulBudgetLeft = pxGroup->ulBudget;
+        pxGroup->xStats.ulPeriods++;
+
+        while( listLIST_IS_EMPTY( &( pxGroup->xHeldTasks ) ) == pdFALSE )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( &( pxGroup->xHeldTasks ) );
+            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            prvReinsertTaskInReadyList( pxTCB );
+
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else
+            {
+                /* A task that is still running on its core only needs to be
+                 * put back in its ready list. */
+                if( taskTASK_IS_RUNNING( pxTCB ) == pdFALSE )
+                {
+                    prvYieldForTask( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTaskGroupSwitchedOut( TCB_t * pxTCB,
+                                         configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        TaskGroup_t * const pxGroup = pxTCB->pxTaskGroup;
+
+        prvTaskGroupCharge( pxTCB, ulNow );
+
+        /* The next task is about to be selected, so no yield is needed on
+         * this core. */
+        if( ( pxGroup->xDepleted == pdFALSE ) && ( pxGroup->xStats.ulBudgetLeft == 0U ) )
+        {
+            ( void ) prvTaskGroupDeplete( pxGroup );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTaskGroupsTick( void )
+    {
+        TaskGroup_t * pxGroup;
+        TCB_t * pxTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+        const configRUN_TIME_COUNTER_TYPE ulNow = prvGetRunTimeNow();
+
+        for( pxGroup = pxTaskGroups; pxGroup != NULL; pxGroup = pxGroup->pxNext )
+        {
+            for( pxTCB = ( TCB_t * ) pxGroup->pvMembers; pxTCB != NULL; pxTCB = pxTCB->pxNextTaskGroupMember )
+            {
+                if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+                {
+                    prvTaskGroupCharge( pxTCB, ulNow );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            if( ( pxGroup->xDepleted == pdFALSE ) && ( pxGroup->xStats.ulBudgetLeft == 0U ) )
+            {
+                if( prvTaskGroupDeplete( pxGroup ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( taskRUN_TIME_REACHED( ulNow, pxGroup->ulNextPeriod ) )
+            {
+                /* Skip any periods the tick missed, the budget does not carry
+                 * over. */
+                pxGroup->ulNextPeriod += pxGroup->ulPeriod * ( ( ( ulNow - pxGroup->ulNextPeriod ) / pxGroup->ulPeriod ) + 1U );
+
+                if( prvTaskGroupReplenish( pxGroup ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTaskGroupLeave( TCB_t * pxTCB )
+    {
+        TaskGroup_t * const pxGroup = pxTCB->pxTaskGroup;
+        TCB_t ** ppxLink;
+
+        if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+        {
+            prvTaskGroupCharge( pxTCB, prvGetRunTimeNow() );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        for( ppxLink = ( TCB_t ** ) &( pxGroup->pvMembers ); *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxNextTaskGroupMember ) )
+        {
+            if( *ppxLink == pxTCB )
+            {
+                *ppxLink = pxTCB->pxNextTaskGroupMember;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        pxGroup->xStats.uxMembers--;
+        pxTCB->pxTaskGroup = NULL;
+        pxTCB->pxNextTaskGroupMember = NULL;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGroupInit( TaskGroup_t * pxGroup,
+                         configRUN_TIME_COUNTER_TYPE ulBudget,
+                         configRUN_TIME_COUNTER_TYPE ulPeriod )
+    {
+        configASSERT( pxGroup != NULL );
+        configASSERT( ( ulBudget != 0U ) && ( ulBudget <= ulPeriod ) );
+
+        taskENTER_CRITICAL();
+        {
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                const TaskGroup_t * pxOther;
+
+                /* Groups cannot be removed, so a group that is in use cannot
+                 * be initialised again. */
+                for( pxOther = pxTaskGroups; pxOther != NULL; pxOther = pxOther->pxNext )
+                {
+                    configASSERT( pxOther != pxGroup );
+                }
+            }
+            #endif /* if ( configASSERT_DEFINED == 1 ) */
+
+            ( void ) memset( ( void * ) pxGroup, 0x00, sizeof( TaskGroup_t ) );
+            vListInitialise( &( pxGroup->xHeldTasks ) );
+            pxGroup->ulBudget = ulBudget;
+            pxGroup->ulPeriod = ulPeriod;
+            pxGroup->xStats.ulBudgetLeft = ulBudget;
+            pxGroup->ulNextPeriod = prvGetRunTimeNow() + ulPeriod;
+            pxGroup->pxNext = pxTaskGroups;
+            pxTaskGroups = pxGroup;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetTaskGroup( TaskHandle_t xTask,
+                            TaskGroup_t * pxGroup )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xWasHeld = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            if( pxTCB->pxTaskGroup != NULL )
+            {
+                if( listIS_CONTAINED_WITHIN( &( pxTCB->pxTaskGroup->xHeldTasks ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    xWasHeld = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvTaskGroupLeave( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxGroup != NULL )
+            {
+                pxTCB->pxTaskGroup = pxGroup;
+                pxTCB->pxNextTaskGroupMember = ( TCB_t * ) pxGroup->pvMembers;
+                pxTCB->ulTaskGroupCharged = prvGetRunTimeNow();
+                pxGroup->pvMembers = pxTCB;
+                pxGroup->xStats.uxMembers++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xWasHeld != pdFALSE )
+            {
+                /* Held again if the new group is depleted too. */
+                prvReinsertTaskInReadyList( pxTCB );
+
+                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( ( pxGroup != NULL ) && ( pxGroup->xDepleted != pdFALSE ) )
+            {
+                if( prvTaskGroupHoldTask( pxTCB ) != pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetTaskGroupStats( const TaskGroup_t * pxGroup,
+                                 TaskGroupStats_t * pxStats )
+    {
+        configASSERT( pxGroup != NULL );
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = pxGroup->xStats;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TASK_GROUPS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_TRIGGERED == 1 )
+
+    static BaseType_t prvTimeTriggeredRelease( TCB_t * pxTCB )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        if( ( pxTCB->ucTimeTriggeredWaiting != ( uint8_t ) pdFALSE ) &&
+            ( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+        {
+            traceTIME_TRIGGERED_RELEASE( pxTCB );
+
+            pxTCB->ucTimeTriggeredWaiting = ( uint8_t ) pdFALSE;
+            xTimeTriggeredStats.ulReleases++;
+            listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+            prvAddTaskToReadyList( pxTCB );
+
+            #if ( configUSE_PREEMPTION == 1 )
+            {
+                #if ( configNUMBER_OF_CORES == 1 )
+                {
+                    if( pxTCB->uxPriority > taskPREEMPTION_PRIORITY( pxCurrentTCB ) )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #else
+                {
+                    prvYieldForTask( pxTCB );
+                }
+                #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+            }
+            #endif /* if ( configUSE_PREEMPTION == 1 ) */
+        }
+        else
+        {
+            /* The previous job has not finished, or the task is blocked on
+             * something else. */
+            xTimeTriggeredStats.ulMissedReleases++;
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTimeTriggeredTick( void )
+    {
+        const TimeTriggeredEntry_t * const pxEntries = pxTimeTriggeredTable->pxEntries;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* The table is sorted by offset, so only the entries at this offset
+         * are looked at. */
+        while( ( uxTimeTriggeredNext < pxTimeTriggeredTable->uxEntries ) &&
+               ( pxEntries[ uxTimeTriggeredNext ].xOffset == xTimeTriggeredTime ) )
+        {
+            if( prvTimeTriggeredRelease( pxTimeTriggeredTasks[ pxEntries[ uxTimeTriggeredNext ].uxTask ] ) != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            uxTimeTriggeredNext++;
+        }
+
+        xTimeTriggeredTime++;
+
+        if( xTimeTriggeredTime == pxTimeTriggeredTable->xHyperperiod )
+        {
+            xTimeTriggeredTime = ( TickType_t ) 0;
+            uxTimeTriggeredNext = ( UBaseType_t ) 0;
+            xTimeTriggeredStats.ulHyperperiods++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskStartTimeTriggered( const TimeTriggeredTable_t * pxTable,
+                                        TaskHandle_t const * pxTasks,
+                                        UBaseType_t uxTasks )
+    {
+        UBaseType_t uxEntry;
+        BaseType_t xReturn = pdPASS;
+
+        configASSERT( pxTable != NULL );
+        configASSERT( pxTasks != NULL );
+
+        if( pxTable->xHyperperiod == ( TickType_t ) 0 )
+        {
+            xReturn = pdFAIL;
+        }
+        else
+        {
+            for( uxEntry = 0U; uxEntry < pxTable->uxEntries; uxEntry++ )
+            {
+                if( ( pxTable->pxEntries[ uxEntry ].xOffset >= pxTable->xHyperperiod ) ||
+                    ( pxTable->pxEntries[ uxEntry ].uxTask >= uxTasks ) ||
+                    ( pxTasks[ pxTable->pxEntries[ uxEntry ].uxTask ] == NULL ) ||
+                    ( ( uxEntry > 0U ) && ( pxTable->pxEntries[ uxEntry ].xOffset < pxTable->pxEntries[ uxEntry - 1U ].xOffset ) ) )
+                {
+                    xReturn = pdFAIL;
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+        if( xReturn == pdPASS )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* The first hyperperiod starts with the next tick. */
+                pxTimeTriggeredTable = pxTable;
+                pxTimeTriggeredTasks = pxTasks;
+                uxTimeTriggeredTasks = uxTasks;
+                xTimeTriggeredTime = ( TickType_t ) 0;
+                uxTimeTriggeredNext = ( UBaseType_t ) 0;
+                ( void ) memset( ( void * ) &xTimeTriggeredStats, 0x00, sizeof( TimeTriggeredStats_t ) );
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskStopTimeTriggered( void )
+    {
+        UBaseType_t uxTask;
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            /* No further release is coming, so let the waiting tasks carry
+             * on.  These are not counted as releases. */
+            for( uxTask = 0U; ( pxTimeTriggeredTasks != NULL ) && ( uxTask < uxTimeTriggeredTasks ); uxTask++ )
+            {
+                pxTCB = pxTimeTriggeredTasks[ uxTask ];
+
+                if( ( pxTCB != NULL ) &&
+                    ( pxTCB->ucTimeTriggeredWaiting != ( uint8_t ) pdFALSE ) &&
+                    ( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+                {
+                    pxTCB->ucTimeTriggeredWaiting = ( uint8_t ) pdFALSE;
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+                    taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            pxTimeTriggeredTable = NULL;
+            pxTimeTriggeredTasks = NULL;
+            uxTimeTriggeredTasks = ( UBaseType_t ) 0;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskWaitForTableRelease( void )
+    {
+        BaseType_t xAlreadyYielded;
+        BaseType_t xWaiting = pdFALSE;
+
+        /* As ulTaskNotifyTake(), but the scheduler being suspended is enough
+         * as releases are only made from the tick. */
+        vTaskSuspendAll();
+        {
+            /* Once the table is stopped there is no release to wait for. */
+            if( pxTimeTriggeredTable != NULL )
+            {
+                pxCurrentTCB->ucTimeTriggeredWaiting = ( uint8_t ) pdTRUE;
+                prvAddCurrentTaskToDelayedList( portMAX_DELAY, pdTRUE );
+                xWaiting = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        if( ( xWaiting != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetTimeTriggeredStats( TimeTriggeredStats_t * pxStats )
+    {
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = xTimeTriggeredStats;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TIME_TRIGGERED */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+
+    static void prvThresholdSwitchedOut( TCB_t * pxTCB )
+    {
+        /* A task that blocked, suspended or was deleted is not preempted. */
+        if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+        {
+            pxTCB->pxNextPreempted = pxThresholdPreempted;
+            pxThresholdPreempted = pxTCB;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvThresholdSelectPreempted( void )
+    {
+        TCB_t * pxPreempted = pxThresholdPreempted;
+
+        /* Forget the tasks that left the ready state since they were
+         * preempted. */
+        while( ( pxPreempted != NULL ) &&
+               ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxPreempted->uxPriority ] ), &( pxPreempted->xStateListItem ) ) == pdFALSE ) )
+        {
+            pxPreempted = pxPreempted->pxNextPreempted;
+        }
+
+        pxThresholdPreempted = pxPreempted;
+
+        /* Each task in the list preempted the one after it, so was above its
+         * threshold, and only the most recent one needs to be checked. */
+        if( ( pxPreempted != NULL ) && ( taskPREEMPTION_PRIORITY( pxPreempted ) >= pxCurrentTCB->uxPriority ) )
+        {
+            pxCurrentTCB = pxPreempted;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The task that runs is no longer preempted. */
+        prvThresholdRemove( pxCurrentTCB );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvThresholdRemove( const TCB_t * pxTCB )
+    {
+        TCB_t ** ppxLink = &pxThresholdPreempted;
+
+        while( ( *ppxLink != NULL ) && ( *ppxLink != pxTCB ) )
+        {
+            ppxLink = &( ( *ppxLink )->pxNextPreempted );
+        }
+
+        if( *ppxLink != NULL )
+        {
+            *ppxLink = pxTCB->pxNextPreempted;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+    void vTaskPreemptionThresholdSet( TaskHandle_t xTask,
+                                      UBaseType_t uxThreshold )
+    {
+        TCB_t * pxTCB;
+        UBaseType_t uxPreviousPriority;
+
+        configASSERT( uxThreshold < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            uxPreviousPriority = taskPREEMPTION_PRIORITY( pxTCB );
+            pxTCB->uxPreemptionThreshold = uxThreshold;
+
+            /* Lowering the threshold of a running task lets the ready tasks
+             * it was holding off preempt it. */
+            if( ( xSchedulerRunning != pdFALSE ) &&
+                ( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE ) &&
+                ( taskPREEMPTION_PRIORITY( pxTCB ) < uxPreviousPriority ) )
+            {
+                taskYIELD_TASK_CORE_IF_USING_PREEMPTION( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskPreemptionThresholdGet( ConstTaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn;
+
+        portBASE_TYPE_ENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            uxReturn = taskPREEMPTION_PRIORITY( pxTCB );
+        }
+        portBASE_TYPE_EXIT_CRITICAL();
+
+        return uxReturn;
+    }
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_IDLE_GOVERNOR == 1 )
+
+    static void prvIdleGovernorRun( void )
+    {
+        IdleGovernorFunction_t pxGovernor = pxIdleGovernor;
+        configRUN_TIME_COUNTER_TYPE ulEnterTime;
+        TickType_t xExpectedIdleTime;
+        TickType_t xMissedTicks = ( TickType_t ) 0;
+        UBaseType_t uxState;
+        UBaseType_t uxSavedInterruptStatus;
+        UBaseType_t uxTopPriority;
+        BaseType_t xCoreID;
+
+        #if ( configNUMBER_OF_CORES > 1 )
+            UBaseType_t uxReady = ( UBaseType_t ) 0U;
+            UBaseType_t uxRunning = ( UBaseType_t ) 0U;
+            BaseType_t x;
+        #endif
+
+        if( pxGovernor == NULL )
+        {
+            pxGovernor = prvIdleGovernorDefault;
+        }
+
+        /* Interrupts stay masked from the decision until the state is left.
+         * An interrupt that makes work for this core either arrives before
+         * the checks below, or is left pending and wakes the core at once.
+         * As in the idle task, an occasional stale read of the kernel state
+         * only affects the choice of state. */
+        portDISABLE_INTERRUPTS();
+
+        xCoreID = ( BaseType_t ) portGET_CORE_ID();
+
+        /* A task above the idle priority may have been readied without a
+         * yield being pended for this core yet. */
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+                portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );
+            #else
+                uxTopPriority = uxTopReadyPriority;
+            #endif
+        }
+        #else /* if ( configNUMBER_OF_CORES == 1 ) */
+        {
+            /* Running tasks stay in their ready lists, so only count the
+             * tasks above the idle priority that no core is running. */
+            for( uxTopPriority = uxTopReadyPriority; uxTopPriority > tskIDLE_PRIORITY; uxTopPriority-- )
+            {
+                uxReady += listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) );
+            }
+
+            for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configNUMBER_OF_CORES; x++ )
+            {
+                if( pxCurrentTCBs[ x ]->uxPriority > tskIDLE_PRIORITY )
+                {
+                    uxRunning++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            uxTopPriority = ( uxReady > uxRunning ) ? uxTopReadyPriority : tskIDLE_PRIORITY;
+        }
+        #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+
+        if( ( uxIdleStates != ( UBaseType_t ) 0U ) &&
+            ( xYieldPendings[ xCoreID ] == pdFALSE ) &&
+            ( uxTopPriority == tskIDLE_PRIORITY ) &&
+            ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) <= ( UBaseType_t ) configNUMBER_OF_CORES ) )
+        {
+            if( ( xPendedTicks == ( TickType_t ) 0 ) && ( xNextTaskUnblockTime > xTickCount ) )
+            {
+                xExpectedIdleTime = xNextTaskUnblockTime - xTickCount;
+            }
+            else
+            {
+                xExpectedIdleTime = ( TickType_t ) 0;
+            }
+
+            uxState = pxGovernor( pxIdleStates, uxIdleStates, xExpectedIdleTime, ulWakeLatencyLimit );
+            configASSERT( uxState < uxIdleStates );
+
+            traceIDLE_STATE_ENTER( uxState, xExpectedIdleTime );
+            ulEnterTime = prvGetRunTimeNow();
+
+            xMissedTicks = pxIdleStates[ uxState ].pxEnter( xExpectedIdleTime );
+
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                xIdleStateStats[ xCoreID ][ uxState ].ulResidency += prvGetRunTimeNow() - ulEnterTime;
+                xIdleStateStats[ xCoreID ][ uxState ].ulEntries++;
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+            traceIDLE_STATE_EXIT( uxState );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        portENABLE_INTERRUPTS();
+
+        if( xMissedTicks > ( TickType_t ) 0 )
+        {
+            ( void ) xTaskCatchUpTicks( xMissedTicks );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvIdleGovernorDefault( const IdleState_t * pxStates,
+                                               UBaseType_t uxStates,
+                                               TickType_t xExpectedIdleTime,
+                                               configRUN_TIME_COUNTER_TYPE ulLatencyLimit )
+    {
+        UBaseType_t uxState = ( UBaseType_t ) 0U;
+        UBaseType_t x;
+
+        /* The first state is always allowed. */
+        for( x = ( UBaseType_t ) 1U; x < uxStates; x++ )
+        {
+            if( ( pxStates[ x ].xTargetResidency <= xExpectedIdleTime ) &&
+                ( pxStates[ x ].ulExitLatency <= ulLatencyLimit ) )
+            {
+                uxState = x;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return uxState;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWakeLatencyRemove( TCB_t * pxTCB )
+    {
+        TCB_t ** ppxLink = &pxWakeLatencyTasks;
+        const TCB_t * pxLatencyTCB;
+        configRUN_TIME_COUNTER_TYPE ulLimit = ~( configRUN_TIME_COUNTER_TYPE ) 0U;
+
+        while( ( *ppxLink != NULL ) && ( *ppxLink != pxTCB ) )
+        {
+            ppxLink = &( ( *ppxLink )->pxNextWakeLatency );
+        }
+
+        if( *ppxLink != NULL )
+        {
+            *ppxLink = pxTCB->pxNextWakeLatency;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxTCB->ulWakeLatency = ( configRUN_TIME_COUNTER_TYPE ) 0U;
+
+        for( pxLatencyTCB = pxWakeLatencyTasks; pxLatencyTCB != NULL; pxLatencyTCB = pxLatencyTCB->pxNextWakeLatency )
+        {
+            if( pxLatencyTCB->ulWakeLatency < ulLimit )
+            {
+                ulLimit = pxLatencyTCB->ulWakeLatency;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        ulWakeLatencyLimit = ulLimit;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetIdleStates( const IdleState_t * pxStates,
+                             UBaseType_t uxStates )
+    {
+        UBaseType_t x;
+
+        configASSERT( uxStates <= ( UBaseType_t ) configIDLE_GOVERNOR_MAX_STATES );
+        configASSERT( ( pxStates != NULL ) || ( uxStates == ( UBaseType_t ) 0U ) );
+
+        for( x = ( UBaseType_t ) 0U; x < uxStates; x++ )
+        {
+            configASSERT( pxStates[ x ].pxEnter != NULL );
+        }
+
+        taskENTER_CRITICAL();
+        {
+            pxIdleStates = pxStates;
+            uxIdleStates = uxStates;
+            ( void ) memset( ( void * ) xIdleStateStats, 0x00, sizeof( xIdleStateStats ) );
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetIdleGovernor( IdleGovernorFunction_t pxGovernor )
+    {
+        pxIdleGovernor = pxGovernor;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetWakeLatency( TaskHandle_t xTask,
+                              configRUN_TIME_COUNTER_TYPE ulLatency )
+    {
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            prvWakeLatencyRemove( pxTCB );
+
+            if( ulLatency != ( configRUN_TIME_COUNTER_TYPE ) 0U )
+            {
+                pxTCB->ulWakeLatency = ulLatency;
+                pxTCB->pxNextWakeLatency = pxWakeLatencyTasks;
+                pxWakeLatencyTasks = pxTCB;
+
+                if( ulLatency < ulWakeLatencyLimit )
+                {
+                    ulWakeLatencyLimit = ulLatency;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetIdleStateStats( BaseType_t xCoreID,
+                                 UBaseType_t uxState,
+                                 IdleStateStats_t * pxStats )
+    {
+        configASSERT( taskVALID_CORE_ID( xCoreID ) == pdTRUE );
+        configASSERT( uxState < ( UBaseType_t ) configIDLE_GOVERNOR_MAX_STATES );
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = xIdleStateStats[ xCoreID ][ uxState ];
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_IDLE_GOVERNOR */
+/*-----------------------------------------------------------*/
+
+#if ( taskUSE_STACK_FILL_ELISION == 1 )
+
+    static void prvStackFillNew( TCB_t * pxTCB,
+                                 eTaskStackFill eFill )
+    {
+        uint8_t * pucLow;
+        uint8_t * pucHigh;
+        size_t xLength;
+
+        /* The part of the stack not used by the initial frame written by
+         * pxPortInitialiseStack().  The port keeps portSTACK_LIMIT_PADDING
+         * words beyond the saved stack pointer for its own context, so they
+         * are left alone. */
+        #if ( portSTACK_GROWTH < 0 )
+        {
+            pucLow = ( uint8_t * ) pxTCB->pxStack;
+            pucHigh = ( uint8_t * ) ( pxTCB->pxTopOfStack - portSTACK_LIMIT_PADDING );
+        }
+        #else
+        {
+            pucLow = ( uint8_t * ) ( pxTCB->pxTopOfStack + 1 + portSTACK_LIMIT_PADDING );
+            pucHigh = ( uint8_t * ) ( pxTCB->pxEndOfStack + 1 );
+        }
+        #endif
+
+        xLength = ( size_t ) ( pucHigh - pucLow );
+
+        if( ( eFill != eTaskStackFillFull ) && ( xLength > tskSTACK_FILL_GUARD_BYTES ) )
+        {
+            /* Only fill the bytes next to the stack limit. */
+            xLength = tskSTACK_FILL_GUARD_BYTES;
+
+            #if ( portSTACK_GROWTH > 0 )
+            {
+                pucLow = &( pucHigh[ -( ( ptrdiff_t ) xLength ) ] );
+            }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) memset( pucLow, ( int ) tskSTACK_FILL_BYTE, xLength );
+
+        if( eFill == eTaskStackFillIdle )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* Add the task behind the first one, whose fill may be in
+                 * progress. */
+                if( pxStackFillTasks == NULL )
+                {
+                    pxTCB->pxNextStackFill = NULL;
+                    pxStackFillTasks = pxTCB;
+                }
+                else
+                {
+                    pxTCB->pxNextStackFill = pxStackFillTasks->pxNextStackFill;
+                    pxStackFillTasks->pxNextStackFill = pxTCB;
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvStackFillIdle( void )
+    {
+        TCB_t ** ppxLink;
+        TCB_t * pxTCB;
+        uint8_t * pucLimit;
+        size_t xLength;
+        BaseType_t xFilled = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            if( pucStackFillCursor == NULL )
+            {
+                /* Start on the first task that is not running, moved to the
+                 * front of the list.  The stack pointer of a running task is
+                 * not known, and a task scheduled to yield keeps running
+                 * until its core takes the yield interrupt. */
+                ppxLink = &pxStackFillTasks;
+
+                while( ( *ppxLink != NULL ) && ( taskTASK_IS_RUNNING_OR_SCHEDULED_TO_YIELD( *ppxLink ) != pdFALSE ) )
+                {
+                    ppxLink = &( ( *ppxLink )->pxNextStackFill );
+                }
+
+                pxTCB = *ppxLink;
+
+                if( pxTCB != NULL )
+                {
+                    *ppxLink = pxTCB->pxNextStackFill;
+                    pxTCB->pxNextStackFill = pxStackFillTasks;
+                    pxStackFillTasks = pxTCB;
+
+                    /* The guard was filled when the task was created. */
+                    #if ( portSTACK_GROWTH < 0 )
+                    {
+                        pucStackFillCursor = &( ( ( uint8_t * ) pxTCB->pxStack )[ tskSTACK_FILL_GUARD_BYTES ] );
+                    }
+                    #else
+                    {
+                        pucStackFillCursor = &( ( ( uint8_t * ) ( pxTCB->pxEndOfStack + 1 ) )[ -( ( ptrdiff_t ) tskSTACK_FILL_GUARD_BYTES ) ] );
+                    }
+                    #endif
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( taskTASK_IS_RUNNING_OR_SCHEDULED_TO_YIELD( pxStackFillTasks ) == pdFALSE )
+            {
+                pxTCB = pxStackFillTasks;
+            }
+            else
+            {
+                pxTCB = NULL;
+            }
+
+            if( pxTCB != NULL )
+            {
+                /* Fill up to the saved stack pointer, less the words the port
+                 * saves beyond it when the task is switched out.  Anything
+                 * beyond that the task has used since it was created, so the
+                 * fill ends there even if the task went deeper between two
+                 * chunks. */
+                #if ( portSTACK_GROWTH < 0 )
+                {
+                    pucLimit = ( uint8_t * ) ( pxTCB->pxTopOfStack - portSTACK_LIMIT_PADDING );
+
+                    if( pucStackFillCursor < pucLimit )
+                    {
+                        xLength = ( size_t ) ( pucLimit - pucStackFillCursor );
+
+                        if( xLength > tskSTACK_FILL_CHUNK_BYTES )
+                        {
+                            xLength = tskSTACK_FILL_CHUNK_BYTES;
+                        }
+
+                        ( void ) memset( pucStackFillCursor, ( int ) tskSTACK_FILL_BYTE, xLength );
+                        pucStackFillCursor = &( pucStackFillCursor[ xLength ] );
+                    }
+
+                    xFilled = ( pucStackFillCursor < pucLimit ) ? pdTRUE : pdFALSE;
+                }
+                #else /* if ( portSTACK_GROWTH < 0 ) */
+                {
+                    pucLimit = ( uint8_t * ) ( pxTCB->pxTopOfStack + 1 + portSTACK_LIMIT_PADDING );
+
+                    if( pucStackFillCursor > pucLimit )
+                    {
+                        xLength = ( size_t ) ( pucStackFillCursor - pucLimit );
+
+                        if( xLength > tskSTACK_FILL_CHUNK_BYTES )
+                        {
+                            xLength = tskSTACK_FILL_CHUNK_BYTES;
+                        }
+
+                        pucStackFillCursor = &( pucStackFillCursor[ -( ( ptrdiff_t ) xLength ) ] );
+                        ( void ) memset( pucStackFillCursor, ( int ) tskSTACK_FILL_BYTE, xLength );
+                    }
+
+                    xFilled = ( pucStackFillCursor > pucLimit ) ? pdTRUE : pdFALSE;
+                }
+                #endif /* if ( portSTACK_GROWTH < 0 ) */
+
+                if( xFilled == pdFALSE )
+                {
+                    /* The stack is filled, move on to the next task. */
+                    pxStackFillTasks = pxTCB->pxNextStackFill;
+                    pucStackFillCursor = NULL;
+                    xFilled = ( pxStackFillTasks != NULL ) ? pdTRUE : pdFALSE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xFilled;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvStackFillRemove( TCB_t * pxTCB )
+    {
+        TCB_t ** ppxLink = &pxStackFillTasks;
+
+        while( ( *ppxLink != NULL ) && ( *ppxLink != pxTCB ) )
+        {
+            ppxLink = &( ( *ppxLink )->pxNextStackFill );
+        }
+
+        if( *ppxLink != NULL )
+        {
+            if( ppxLink == &pxStackFillTasks )
+            {
+                /* Any fill in progress was of this task. */
+                pucStackFillCursor = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            *ppxLink = pxTCB->pxNextStackFill;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* taskUSE_STACK_FILL_ELISION */
+/*-----------------------------------------------------------*/
+
+static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
+                                            const BaseType_t xCanBlockIndefinitely )
+{
+    TickType_t xTimeToWake;
+    const TickType_t xConstTickCount = xTickCount;
+    List_t * const pxDelayedList = pxDelayedTaskList;
+    List_t * const pxOverflowDelayedList = pxOverflowDelayedTaskList;
+
+    #if ( INCLUDE_xTaskAbortDelay == 1 )
+    {
+        /* About to enter a delayed list, so ensure the ucDelayAborted flag is
+         * reset to pdFALSE so it can be detected as having been set to pdTRUE
+         * when the task leaves the Blocked state. */
+        pxCurrentTCB->ucDelayAborted = ( uint8_t ) pdFALSE;
+    }
+    #endif
+
+    /* Remove the task from the ready list before adding it to the blocked list
+     * as the same list item is used for both lists. */
+    if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+    {
+        /* The current task must be in a ready list, so there is no need to
+         * check, and the port reset macro can be called directly. */
+        portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    #if ( INCLUDE_vTaskSuspend == 1 )
+    {
+        if( ( xTicksToWait == portMAX_DELAY ) && ( xCanBlockIndefinitely != pdFALSE ) )
+        {
+            /* Add the task to the suspended task list instead of a delayed task
+             * list to ensure it is not woken by a timing event.  It will block
+             * indefinitely. */
+            listINSERT_END( &xSuspendedTaskList, &( pxCurrentTCB->xStateListItem ) );
+        }
+        else
+        {
+            /* Calculate the time at which the task should be woken if the event
+             * does not occur.  This may overflow but this doesn't matter, the
+             * kernel will manage it correctly. */
+            xTimeToWake = xConstTickCount + xTicksToWait;
+
+            /* The list item will be inserted in wake time order. */
+            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+
+            if( xTimeToWake < xConstTickCount )
+            {
+                /* Wake time has overflowed.  Place this item in the overflow
+                 * list. */
+                traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST();
+                vListInsert( pxOverflowDelayedList, &( pxCurrentTCB->xStateListItem ) );
+            }
+            else
+            {
+                /* The wake time has not overflowed, so the current block list
+                 * is used. */
+                traceMOVED_TASK_TO_DELAYED_LIST();
+                vListInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ) );
+
+                /* If the task entering the blocked state was placed at the
+                 * head of the list of blocked tasks then xNextTaskUnblockTime
+                 * needs to be updated too. */
+                if( xTimeToWake < xNextTaskUnblockTime )
+                {
+                    xNextTaskUnblockTime = xTimeToWake;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+    }
+    #else /* INCLUDE_vTaskSuspend */
+    {
+        /* Calculate the time at which the task should be woken if the event
+         * does not occur.  This may overflow but this doesn't matter, the kernel
+         * will manage it correctly. */
+        xTimeToWake = xConstTickCount + xTicksToWait;
+
+        /* The list item will be inserted in wake time order. */
+        listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+
+        if( xTimeToWake < xConstTickCount )
+        {
+            traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST();
+            /* Wake time has overflowed.  Place this item in the overflow list. */
+            vListInsert( pxOverflowDelayedList, &( pxCurrentTCB->xStateListItem ) );
+        }
+        else
+        {
+            traceMOVED_TASK_TO_DELAYED_LIST();
+            /* The wake time has not overflowed, so the current block list is used. */
+            vListInsert( pxDelayedList, &( pxCurrentTCB->xStateListItem ) );
+
+            /* If the task entering the blocked state was placed at the head of the
+             * list of blocked tasks then xNextTaskUnblockTime needs to be updated
+             * too. */
+            if( xTimeToWake < xNextTaskUnblockTime )
+            {
+                xNextTaskUnblockTime = xTimeToWake;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
+        ( void ) xCanBlockIndefinitely;
+    }
+    #endif /* INCLUDE_vTaskSuspend */
+}
+/*-----------------------------------------------------------*/
+
+#if ( portUSING_MPU_WRAPPERS == 1 )
+
+    xMPU_SETTINGS * xTaskGetMPUSettings( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_xTaskGetMPUSettings( xTask );
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( pxTCB != NULL );
+
+        traceRETURN_xTaskGetMPUSettings( &( pxTCB->xMPUSettings ) );
+
+        return &( pxTCB->xMPUSettings );
+    }
+
+#endif /* portUSING_MPU_WRAPPERS */
+/*-----------------------------------------------------------*/
+
+/* Code below here allows additional code to be inserted into this source file,
+ * especially where access to file scope functions and data is needed (for example
+ * when performing module tests). */
+
+#ifdef FREERTOS_MODULE_TEST
+    #include "tasks_test_access_functions.h"
+#endif
+
+
+#if ( configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H == 1 )
+
+    #include "freertos_tasks_c_additions.h"
+
+    #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+        static void freertos_tasks_c_additions_init( void )
+        {
+            FREERTOS_TASKS_C_ADDITIONS_INIT();
+        }
+    #endif
+
+#endif /* if ( configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+
+/*
+ * This is the kernel provided implementation of vApplicationGetIdleTaskMemory()
+ * to provide the memory that is used by the Idle task. It is used when
+ * configKERNEL_PROVIDED_STATIC_MEMORY is set to 1. The application can provide
+ * it's own implementation of vApplicationGetIdleTaskMemory by setting
+ * configKERNEL_PROVIDED_STATIC_MEMORY to 0 or leaving it undefined.
+ */
+    void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                        StackType_t ** ppxIdleTaskStackBuffer,
+                                        configSTACK_DEPTH_TYPE * puxIdleTaskStackSize )
+    {
+        static StaticTask_t xIdleTaskTCB;
+        static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+        *ppxIdleTaskTCBBuffer = &( xIdleTaskTCB );
+        *ppxIdleTaskStackBuffer = &( uxIdleTaskStack[ 0 ] );
+        *puxIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+    }
+
+    #if ( configNUMBER_OF_CORES > 1 )
+
+        void vApplicationGetPassiveIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                                   StackType_t ** ppxIdleTaskStackBuffer,
+                                                   configSTACK_DEPTH_TYPE * puxIdleTaskStackSize,
+                                                   BaseType_t xPassiveIdleTaskIndex )
+        {
+            static StaticTask_t xIdleTaskTCBs[ configNUMBER_OF_CORES - 1 ];
+            static StackType_t uxIdleTaskStacks[ configNUMBER_OF_CORES - 1 ][ configMINIMAL_STACK_SIZE ];
+
+            *ppxIdleTaskTCBBuffer = &( xIdleTaskTCBs[ xPassiveIdleTaskIndex ] );
+            *ppxIdleTaskStackBuffer = &( uxIdleTaskStacks[ xPassiveIdleTaskIndex ][ 0 ] );
+            *puxIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+        }
+
+    #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+
+#endif /* #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 ) && ( portUSING_MPU_WRAPPERS == 0 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 ) && ( portUSING_MPU_WRAPPERS == 0 ) && ( configUSE_TIMERS == 1 ) )
+
+/*
+ * This is the kernel provided implementation of vApplicationGetTimerTaskMemory()
+ * to provide the memory that is used by the Timer service task. It is used when
+ * configKERNEL_PROVIDED_STATIC_MEMORY is set to 1. The application can provide
+ * it's own implementation of vApplicationGetTimerTaskMemory by setting
+ * configKERNEL_PROVIDED_STATIC_MEMORY to 0 or leaving it undefined.
+ */
+    void vApplicationGetTimerTaskMemory( StaticTask_t ** ppxTimerTaskTCBBuffer,
+                                         StackType_t ** ppxTimerTaskStackBuffer,
+                                         configSTACK_DEPTH_TYPE * puxTimerTaskStackSize )
+    {
+        static StaticTask_t xTimerTaskTCB;
+        static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+        *ppxTimerTaskTCBBuffer = &( xTimerTaskTCB );
+        *ppxTimerTaskStackBuffer = &( uxTimerTaskStack[ 0 ] );
+        *puxTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+    }
+
+#endif /* #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 ) && ( portUSING_MPU_WRAPPERS == 0 ) && ( configUSE_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+/*
+ * Reset the state in this file. This state is normally initialized at start up.
+ * This function must be called by the application before restarting the
+ * scheduler.
+ */
+void vTaskResetState( void )
+{
+    BaseType_t xCoreID;
+
+    /* Task control block. */
+    #if ( configNUMBER_OF_CORES == 1 )
+    {
         pxCurrentTCB = NULL;
     }
     #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
@@ -8867,5 +14323,100 @@ void vTaskResetState( void )
         }
     }
     #endif /* #if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+
+    #if ( configUSE_CORE_RUN_TIME_STATS == 1 )
+    {
+        ulCoreRunTimeOrigin = 0U;
+
+        for( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+        {
+            uxCoreRunTimeSequence[ xCoreID ] = 0U;
+            ulCoreIdleTime[ xCoreID ] = 0U;
+            ulCoreISRTime[ xCoreID ] = 0U;
+            ulCoreISRTimeSinceSwitchedIn[ xCoreID ] = 0U;
+            ulCoreISREnterTime[ xCoreID ] = 0U;
+            uxCoreISRNesting[ xCoreID ] = 0U;
+        }
+    }
+    #endif /* #if ( configUSE_CORE_RUN_TIME_STATS == 1 ) */
+
+    #if ( configUSE_TASK_GROUPS == 1 )
+    {
+        pxTaskGroups = NULL;
+    }
+    #endif /* #if ( configUSE_TASK_GROUPS == 1 ) */
+
+    #if ( configUSE_EXECUTION_BUDGETS == 1 )
+    {
+        pxExecutionBudgets = NULL;
+    }
+    #endif /* #if ( configUSE_EXECUTION_BUDGETS == 1 ) */
+
+    #if ( configUSE_APERIODIC_SERVERS == 1 )
+    {
+        pxAperiodicServers = NULL;
+    }
+    #endif /* #if ( configUSE_APERIODIC_SERVERS == 1 ) */
+
+    #if ( configUSE_MIXED_CRITICALITY == 1 )
+    {
+        pxCriticalityTasks = NULL;
+        eCriticalityMode = eCriticalityLow;
+        ( void ) memset( &xCriticalityStats, 0x00, sizeof( xCriticalityStats ) );
+        ulCriticalityHighModeStart = 0U;
+    }
+    #endif /* #if ( configUSE_MIXED_CRITICALITY == 1 ) */
+
+    #if ( configUSE_TIME_TRIGGERED == 1 )
+    {
+        pxTimeTriggeredTable = NULL;
+        pxTimeTriggeredTasks = NULL;
+        uxTimeTriggeredTasks = ( UBaseType_t ) 0;
+        xTimeTriggeredTime = ( TickType_t ) 0;
+        uxTimeTriggeredNext = ( UBaseType_t ) 0;
+        ( void ) memset( &xTimeTriggeredStats, 0x00, sizeof( xTimeTriggeredStats ) );
+    }
+    #endif /* #if ( configUSE_TIME_TRIGGERED == 1 ) */
+
+    #if ( configUSE_IDLE_GOVERNOR == 1 )
+    {
+        pxIdleStates = NULL;
+        uxIdleStates = ( UBaseType_t ) 0U;
+        pxIdleGovernor = NULL;
+        ulWakeLatencyLimit = ~( configRUN_TIME_COUNTER_TYPE ) 0U;
+        pxWakeLatencyTasks = NULL;
+        ( void ) memset( xIdleStateStats, 0x00, sizeof( xIdleStateStats ) );
+    }
+    #endif /* #if ( configUSE_IDLE_GOVERNOR == 1 ) */
+
+    #if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+    {
+        pxThresholdPreempted = NULL;
+    }
+    #endif /* #if ( ( configUSE_PREEMPTION_THRESHOLD == 1 ) && ( configNUMBER_OF_CORES == 1 ) ) */
+
+    #if ( configTCB_POOL_LENGTH > 0 )
+    {
+        ( void ) memset( ucTCBPoolUsed, 0x00, sizeof( ucTCBPoolUsed ) );
+    }
+    #endif /* #if ( configTCB_POOL_LENGTH > 0 ) */
+
+    #if ( configUSE_SMP_STATS == 1 )
+    {
+        ( void ) memset( xCoreSMPStats, 0x00, sizeof( xCoreSMPStats ) );
+
+        for( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+        {
+            ulYieldRequestTime[ xCoreID ] = 0U;
+        }
+    }
+    #endif /* #if ( configUSE_SMP_STATS == 1 ) */
+
+    #if ( taskUSE_STACK_FILL_ELISION == 1 )
+    {
+        pxStackFillTasks = NULL;
+        pucStackFillCursor = NULL;
+    }
+    #endif /* #if ( taskUSE_STACK_FILL_ELISION == 1 ) */
 }
 /*-----------------------------------------------------------*/
@@ -91,6 +91,9 @@
             UBaseType_t uxTimerNumber;                                           /**< An ID assigned by trace tools such as FreeRTOS+Trace */
         #endif
         uint8_t ucStatus;                                                        /**< Holds bits to say if the timer was statically allocated or not, and if it is active or not. */
+        #if ( configUSE_OBJECT_METRICS == 1 )
+            ObjectMetrics_t xMetrics;                                            /**< Commands sent and processed, and the execution time of the callback. */
+        #endif
     } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -232,6 +235,13 @@
                                        void * const pvTimerID,
                                        TimerCallbackFunction_t pxCallbackFunction,
                                        Timer_t * pxNewTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Call the callback function of a timer that has expired.  With object metrics
+ * enabled the execution time of the callback is recorded in the histogram of
+ * the timer, as timers have no blocked time of their own.
+ */
+    static void prvExecuteTimerCallback( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
 /*-----------------------------------------------------------*/
 
     BaseType_t xTimerCreateTimerTask( void )
@@ -441,6 +451,7 @@
             pxNewTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_AUTORELOAD;
         }
 
+        objmetricsREGISTER( &( pxNewTimer->xMetrics ), pxNewTimer, eObjectMetricsTimer, pcTimerName );
         traceTIMER_CREATE( pxNewTimer );
     }
 /*-----------------------------------------------------------*/
@@ -481,6 +492,23 @@
                 }
             }
 
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                if( xReturn != pdPASS )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        objmetricsSEND_FAILED( &( xTimer->xMetrics ) );
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_OBJECT_METRICS */
+
             traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
         }
         else
@@ -523,6 +551,25 @@
                 xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
             }
 
+            #if ( configUSE_OBJECT_METRICS == 1 )
+            {
+                if( xReturn != pdPASS )
+                {
+                    UBaseType_t uxSavedInterruptStatus;
+
+                    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+                    {
+                        objmetricsSEND_FAILED( &( xTimer->xMetrics ) );
+                    }
+                    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_OBJECT_METRICS */
+
             traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
         }
         else
@@ -706,7 +753,7 @@
 
             /* Call the timer callback. */
             traceTIMER_EXPIRED( pxTimer );
-            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+            prvExecuteTimerCallback( pxTimer );
         }
     }
 /*-----------------------------------------------------------*/
@@ -737,7 +784,24 @@
 
         /* Call the timer callback. */
         traceTIMER_EXPIRED( pxTimer );
-        pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+        prvExecuteTimerCallback( pxTimer );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvExecuteTimerCallback( Timer_t * const pxTimer )
+    {
+        #if ( configUSE_OBJECT_METRICS == 1 )
+            uint32_t ulStart;
+
+            objmetricsWAIT_START( ulStart );
+            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+
+            /* Only the timer service task updates the receive count. */
+            objmetricsRECEIVE( &( pxTimer->xMetrics ) );
+            objmetricsWAIT_END( &( pxTimer->xMetrics ), ulStart, eObjectMetricsWaitSatisfied );
+        #else
+            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+        #endif
     }
 /*-----------------------------------------------------------*/
 
@@ -984,6 +1048,10 @@
 
                     traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
 
+                    /* Commands are counted as they are processed, as the timer
+                     * service task is the only writer of the send count. */
+                    objmetricsSEND( &( pxTimer->xMetrics ), uxQueueMessagesWaiting( xTimerQueue ) );
+
                     /* In this case the xTimerListsWereSwitched parameter is not used, but
                      *  it must be present in the function call.  prvSampleTimeNow() must be
                      *  called after the message is received from xTimerQueue so there is no
@@ -1016,7 +1084,7 @@
 
                                 /* Call the timer callback. */
                                 traceTIMER_EXPIRED( pxTimer );
-                                pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                                prvExecuteTimerCallback( pxTimer );
                             }
                             else
                             {
@@ -1047,6 +1115,8 @@
                             break;
 
                         case tmrCOMMAND_DELETE:
+                            objmetricsUNREGISTER( &( pxTimer->xMetrics ) );
+
                             #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                             {
                                 /* The timer has already been removed from the active list,
@@ -1120,8 +1190,18 @@
         {
             if( xTimerQueue == NULL )
             {
-                vListInitialise( &xActiveTimerList1 );
-                vListInitialise( &xActiveTimerList2 );
+                #if ( configUSE_LIST_TREE_INDEX == 1 )
+                {
+                    vListInitialiseIndexed( &xActiveTimerList1 );
+                    vListInitialiseIndexed( &xActiveTimerList2 );
+                }
+                #else
+                {
+                    vListInitialise( &xActiveTimerList1 );
+                    vListInitialise( &xActiveTimerList2 );
+                }
+                #endif /* configUSE_LIST_TREE_INDEX */
+
                 pxCurrentTimerList = &xActiveTimerList1;
                 pxOverflowTimerList = &xActiveTimerList2;
 
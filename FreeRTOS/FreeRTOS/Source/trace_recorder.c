@@ -0,0 +1,252 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the trace recorder. */
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/* The recorder is called from the scheduler itself, so the interrupt mask is
+ * manipulated directly rather than through a critical section.  Use the
+ * cheapest form the port offers. */
+    #ifdef portSET_INTERRUPT_MASK
+        #define trcMASK_INTERRUPTS()              portSET_INTERRUPT_MASK()
+        #define trcUNMASK_INTERRUPTS( uxState )    portCLEAR_INTERRUPT_MASK( uxState )
+    #else
+        #define trcMASK_INTERRUPTS()              portSET_INTERRUPT_MASK_FROM_ISR()
+        #define trcUNMASK_INTERRUPTS( uxState )    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxState )
+    #endif
+
+    #define trcBUFFER_INDEX_MASK    ( ( uint32_t ) configTRACE_RECORDER_BUFFER_LENGTH - 1U )
+
+/* Number of characters carried by each trcEVENT_OBJECT_NAME record. */
+    #define trcNAME_CHARS_PER_EVENT    4U
+
+/*
+ * Ring buffer owned by one core.  ulHead is only written by the owning core
+ * (with interrupts masked) and ulTail is only written by the reader, so the
+ * buffer needs no lock.  Both indexes increase freely and are masked when
+ * used, which keeps the full/empty test a single subtraction.  The layout is
+ * also what trace_decode.py expects when decoding a raw memory dump.
+ */
+    typedef struct xTRACE_RING_BUFFER
+    {
+        volatile uint32_t ulHead;
+        volatile uint32_t ulTail;
+        volatile uint32_t ulDropped;
+        uint32_t ulReserved;
+        TraceEvent_t xEvents[ configTRACE_RECORDER_BUFFER_LENGTH ];
+    } TraceRingBuffer_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+ * which static variables must be declared volatile. */
+    PRIVILEGED_DATA static TraceRingBuffer_t xTraceBuffers[ configNUMBER_OF_CORES ];
+    PRIVILEGED_DATA static volatile BaseType_t xTraceRecorderEnabled = pdFALSE;
+/*lint -restore */
+
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderStart( void )
+    {
+        xTraceRecorderEnabled = pdTRUE;
+
+        vTraceRecorderWrite( trcEVENT_TRACE_START, ( uint16_t ) trcFORMAT_VERSION, 0U, ( uint32_t ) portTRACE_RECORDER_TIMESTAMP_HZ );
+        vTraceRecorderWrite( trcEVENT_TICK_RATE, 0U, 0U, ( uint32_t ) configTICK_RATE_HZ );
+    }
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderStop( void )
+    {
+        xTraceRecorderEnabled = pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderWrite( uint8_t ucEvent,
+                              uint16_t usParam,
+                              uint32_t ulObject,
+                              uint32_t ulValue )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        TraceRingBuffer_t * pxBuffer;
+        TraceEvent_t * pxEvent;
+        uint32_t ulHead;
+        BaseType_t xCoreID;
+
+        if( xTraceRecorderEnabled != pdFALSE )
+        {
+            uxSavedInterruptStatus = ( UBaseType_t ) trcMASK_INTERRUPTS();
+            {
+                xCoreID = ( BaseType_t ) portGET_CORE_ID();
+                pxBuffer = &( xTraceBuffers[ xCoreID ] );
+                ulHead = pxBuffer->ulHead;
+
+                if( ( ulHead - pxBuffer->ulTail ) < ( uint32_t ) configTRACE_RECORDER_BUFFER_LENGTH )
+                {
+                    pxEvent = &( pxBuffer->xEvents[ ulHead & trcBUFFER_INDEX_MASK ] );
+                    pxEvent->ulTimestamp = ( uint32_t ) portTRACE_RECORDER_TIMESTAMP();
+                    pxEvent->ucEvent = ucEvent;
+                    pxEvent->ucCore = ( uint8_t ) xCoreID;
+                    pxEvent->usParam = usParam;
+                    pxEvent->ulObject = ulObject;
+                    pxEvent->ulValue = ulValue;
+
+                    /* The record must be complete before the reader can see
+                     * it. */
+                    portMEMORY_BARRIER();
+                    pxBuffer->ulHead = ulHead + 1U;
+                }
+                else
+                {
+                    pxBuffer->ulDropped++;
+                }
+            }
+            trcUNMASK_INTERRUPTS( uxSavedInterruptStatus );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderWriteName( uint32_t ulObject,
+                                  const char * pcName )
+    {
+        uint32_t ulChars;
+        uint16_t usChunk = 0U;
+        size_t x = 0U;
+        size_t y;
+
+        if( pcName != NULL )
+        {
+            /* Names are sent four characters at a time, packed little endian.
+             * The final record is padded with NULs, or an all NUL record is
+             * sent if the name length is a multiple of four, so the decoder
+             * always sees the terminator. */
+            do
+            {
+                ulChars = 0U;
+
+                for( y = 0U; y < trcNAME_CHARS_PER_EVENT; y++ )
+                {
+                    if( ( x < ( size_t ) configMAX_TASK_NAME_LEN ) && ( pcName[ x ] != ( char ) 0x00 ) )
+                    {
+                        ulChars |= ( ( uint32_t ) ( uint8_t ) pcName[ x ] ) << ( y * 8U );
+                        x++;
+                    }
+                }
+
+                vTraceRecorderWrite( trcEVENT_OBJECT_NAME, usChunk, ulObject, ulChars );
+                usChunk++;
+            } while( ( ulChars >> 24 ) != 0U );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderUserEvent( uint16_t usChannel,
+                                  uint32_t ulValue )
+    {
+        vTraceRecorderWrite( trcEVENT_USER, usChannel, 0U, ulValue );
+    }
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderSetDeadline( struct tskTaskControlBlock * xTask,
+                                    TickType_t xRelativeDeadline )
+    {
+        if( xTask == NULL )
+        {
+            xTask = xTaskGetCurrentTaskHandle();
+        }
+
+        vTraceRecorderWrite( trcEVENT_TASK_DEADLINE, 0U, trcHANDLE( xTask ), ( uint32_t ) xRelativeDeadline );
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xTraceRecorderRead( BaseType_t xCoreID,
+                               TraceEvent_t * pxEvents,
+                               size_t xMaxEvents )
+    {
+        TraceRingBuffer_t * pxBuffer;
+        uint32_t ulHead, ulTail;
+        size_t xCount = 0U;
+
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+        configASSERT( pxEvents != NULL );
+
+        pxBuffer = &( xTraceBuffers[ xCoreID ] );
+        ulHead = pxBuffer->ulHead;
+        ulTail = pxBuffer->ulTail;
+
+        /* Records up to ulHead are complete, the writer only publishes a
+         * record once it has been filled in. */
+        portMEMORY_BARRIER();
+
+        while( ( ulTail != ulHead ) && ( xCount < xMaxEvents ) )
+        {
+            ( void ) memcpy( &( pxEvents[ xCount ] ), &( pxBuffer->xEvents[ ulTail & trcBUFFER_INDEX_MASK ] ), sizeof( TraceEvent_t ) );
+            ulTail++;
+            xCount++;
+        }
+
+        /* Only release the slots after the records have been copied out. */
+        portMEMORY_BARRIER();
+        pxBuffer->ulTail = ulTail;
+
+        return xCount;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulTraceRecorderGetDropped( BaseType_t xCoreID )
+    {
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+
+        return xTraceBuffers[ xCoreID ].ulDropped;
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TRACE_RECORDER == 1 */
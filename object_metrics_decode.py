@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""
+FreeRTOS Object Metrics Decoder
+Decodes the compact binary snapshot written by xObjectMetricsExport()
+(configUSE_OBJECT_METRICS) into a per-object table of sends, receives,
+timeouts, peak fill level, mutex contention and hold times, and percentiles of
+the blocked time histogram.
+
+Accepted inputs:
+  * a raw binary export (e.g. captured from a UART or read over SWD)
+  * a serial log in which the export was printed as "OBM:<hex>" lines; the
+    last complete export in the log is decoded
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+# ── Format (must match Source/object_metrics.c) ────────────────
+HEADER = struct.Struct("<IBBHI")    # magic, version, buckets, records, timestamp Hz
+MAGIC = 0x54454D4F                  # "OMET"
+FORMAT_VERSION = 1
+
+TYPES = {
+    0: "queue",
+    1: "semaphore",
+    2: "mutex",
+    3: "event_group",
+    4: "stream_buffer",
+    5: "message_buffer",
+    6: "timer",
+}
+
+COUNTERS = ("sends", "receives", "send_timeouts", "receive_timeouts", "peak",
+            "contentions", "max_hold", "total_hold")
+
+HEX_LINE = re.compile(r"OBM:([0-9A-Fa-f]+)")
+
+
+class Record:
+    """One object. Times are in time stamp ticks, see Snapshot.hz."""
+
+    __slots__ = ("number", "handle", "type", "name", "histogram") + COUNTERS
+
+    @property
+    def type_name(self):
+        return TYPES.get(self.type, f"type{self.type}")
+
+    @property
+    def label(self):
+        return self.name or f"{self.type_name}#{self.number}"
+
+    @property
+    def waits(self):
+        return sum(self.histogram)
+
+    def percentile(self, p):
+        """Upper bound of the bucket holding the p-th percentile wait, in ticks."""
+
+        total = self.waits
+        if not total:
+            return None
+        target = total * p / 100.0
+        seen = 0
+        for bucket, count in enumerate(self.histogram):
+            seen += count
+            if seen >= target:
+                return bucket_upper(bucket)
+        return bucket_upper(len(self.histogram) - 1)
+
+    @property
+    def max_wait(self):
+        for bucket in range(len(self.histogram) - 1, -1, -1):
+            if self.histogram[bucket]:
+                return bucket_upper(bucket)
+        return None
+
+
+class Snapshot:
+    def __init__(self, hz, buckets, records):
+        self.hz = hz
+        self.buckets = buckets
+        self.records = records
+
+
+def bucket_upper(bucket):
+    """Bucket 0 counts waits under one tick, bucket n waits up to 2^n - 1 ticks."""
+
+    return 0 if bucket == 0 else (1 << bucket) - 1
+
+
+# ── Input ──────────────────────────────────────────────────────
+def read_varint(data, off):
+    value = 0
+    shift = 0
+    while True:
+        if off >= len(data):
+            raise ValueError("truncated varint")
+        byte = data[off]
+        off += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value, off
+        shift += 7
+
+
+def parse_export(data):
+    """Decode one export produced by xObjectMetricsExport()."""
+
+    if len(data) < HEADER.size:
+        raise ValueError("export shorter than its header")
+    magic, version, buckets, count, hz = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError(f"bad magic 0x{magic:08X}")
+    if version != FORMAT_VERSION:
+        print(f"warning: export format version {version}, decoder expects {FORMAT_VERSION}",
+              file=sys.stderr)
+
+    records = []
+    off = HEADER.size
+    for _ in range(count):
+        rec = Record()
+        rec.number, off = read_varint(data, off)
+        rec.handle, off = read_varint(data, off)
+        rec.type = data[off]
+        name_len = data[off + 1]
+        off += 2
+        rec.name = data[off:off + name_len].decode("ascii", "replace")
+        off += name_len
+        for field in COUNTERS:
+            value, off = read_varint(data, off)
+            setattr(rec, field, value)
+        rec.histogram = []
+        for _ in range(buckets):
+            value, off = read_varint(data, off)
+            rec.histogram.append(value)
+        records.append(rec)
+
+    return Snapshot(hz or 1, buckets, records)
+
+
+def parse_hex_log(text):
+    """Join consecutive OBM: lines and decode the last export that starts with the magic."""
+
+    data = b"".join(bytes.fromhex(m.group(1)) for m in HEX_LINE.finditer(text))
+    start = data.rfind(struct.pack("<I", MAGIC))
+    if start < 0:
+        raise ValueError("no export found in log")
+    return parse_export(data[start:])
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    try:
+        text = data.decode("ascii")
+    except UnicodeDecodeError:
+        text = None
+
+    if text is not None and HEX_LINE.search(text):
+        return parse_hex_log(text)
+    return parse_export(data)
+
+
+# ── Output ─────────────────────────────────────────────────────
+def us(ticks, hz):
+    return "-" if ticks is None else f"{ticks * 1e6 / hz:.0f}"
+
+
+def print_table(snap):
+    hz = snap.hz
+    print(f"{'object':<18}{'type':<15}{'sends':>9}{'recvs':>9}{'tx to':>7}{'rx to':>7}{'peak':>7}"
+          f"{'cont':>6}{'hold max':>10}{'hold avg':>10}{'p50 us':>9}{'p99 us':>9}{'max us':>9}")
+    for rec in snap.records:
+        if rec.type == 2:
+            hold_max = us(rec.max_hold, hz)
+            hold_avg = us(rec.total_hold / rec.receives, hz) if rec.receives else "-"
+        else:
+            hold_max = hold_avg = "-"
+        print(f"{rec.label:<18}{rec.type_name:<15}{rec.sends:>9}{rec.receives:>9}"
+              f"{rec.send_timeouts:>7}{rec.receive_timeouts:>7}{rec.peak:>7}{rec.contentions:>6}"
+              f"{hold_max:>10}{hold_avg:>10}{us(rec.percentile(50), hz):>9}"
+              f"{us(rec.percentile(99), hz):>9}{us(rec.max_wait, hz):>9}")
+    print(f"\n{len(snap.records)} objects, {snap.buckets} histogram buckets, {hz} Hz time stamp",
+          file=sys.stderr)
+
+
+def print_csv(snap):
+    hz = snap.hz
+    print("number,handle,type,name," + ",".join(COUNTERS) + ",p50_us,p99_us,max_us," +
+          ",".join(f"bucket{b}" for b in range(snap.buckets)))
+    for rec in snap.records:
+        print(f"{rec.number},0x{rec.handle:08X},{rec.type_name},{rec.name}," +
+              ",".join(str(getattr(rec, f)) for f in COUNTERS) +
+              f",{us(rec.percentile(50), hz)},{us(rec.percentile(99), hz)},{us(rec.max_wait, hz)}," +
+              ",".join(str(c) for c in rec.histogram))
+
+
+# ── Main ───────────────────────────────────────────────────────
+def main():
+    parser = argparse.ArgumentParser(description="Decode a FreeRTOS object metrics export.")
+    parser.add_argument("capture", help="raw binary export or serial log with OBM: lines")
+    parser.add_argument("--csv", action="store_true", help="print CSV instead of a table")
+    args = parser.parse_args()
+
+    try:
+        snap = load(args.capture)
+    except ValueError as e:
+        sys.exit(f"error: {e}")
+
+    if args.csv:
+        print_csv(snap)
+    else:
+        print_table(snap)
+
+
+if __name__ == "__main__":
+    main()
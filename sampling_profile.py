@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""
+FreeRTOS Sampling Profiler Report
+Turns the samples taken by the in-kernel sampling profiler
+(configUSE_SAMPLING_PROFILER) into per-task flat profiles and flame graphs,
+resolving the sampled addresses with the symbol table of the application ELF.
+
+Accepted inputs:
+  * a raw binary stream of 16 byte samples
+  * a serial log in which samples were printed as "PRF:<32 hex digits>" lines;
+    "PRT:<handle> <name>" lines in the same log name the tasks
+
+Outputs:
+  * a flat profile (samples and share per function) for every task
+  * --folded: collapsed stacks, one "task;caller;function count" line each,
+    for flamegraph.pl, speedscope or inferno
+  * --svg: a self-contained flame graph
+"""
+
+import argparse
+import bisect
+import html
+import re
+import struct
+import subprocess
+import sys
+
+# ── Sample format (must match Source/include/sampling_profiler.h) ─
+SAMPLE = struct.Struct("<IIIBBH")   # pc, lr, task, core, flags, reserved
+SAMPLE_SIZE = SAMPLE.size           # 16 bytes
+FLAG_INTERRUPT = 0x01
+
+HEX_LINE = re.compile(r"PRF:([0-9A-Fa-f]{32})")
+NAME_LINE = re.compile(r"PRT:([0-9A-Fa-f]+)\s+(\S+)")
+
+# ── Configuration ──────────────────────────────────────────────
+DEFAULT_NM = "arm-none-eabi-nm"
+FLAME_WIDTH = 1200
+FLAME_ROW = 18
+FLAME_COLORS = ["#e8743b", "#f0a35e", "#f5c26b", "#e85d3b", "#f08c5e"]
+
+
+class Sample:
+    __slots__ = ("pc", "lr", "task", "core", "flags")
+
+    def __init__(self, pc, lr, task, core, flags, _reserved=0):
+        self.pc = pc
+        self.lr = lr
+        self.task = task
+        self.core = core
+        self.flags = flags
+
+
+# ── Input ──────────────────────────────────────────────────────
+def parse_samples(data):
+    """Split a binary blob into Samples, ignoring a trailing partial sample."""
+
+    usable = len(data) - (len(data) % SAMPLE_SIZE)
+    return [Sample(*SAMPLE.unpack_from(data, off)) for off in range(0, usable, SAMPLE_SIZE)]
+
+
+def load(path):
+    """Return (samples, task names) from a raw capture or a serial log."""
+
+    with open(path, "rb") as f:
+        data = f.read()
+
+    try:
+        text = data.decode("ascii")
+    except UnicodeDecodeError:
+        text = None
+
+    if text is not None and HEX_LINE.search(text):
+        samples = parse_samples(b"".join(bytes.fromhex(m.group(1)) for m in HEX_LINE.finditer(text)))
+        names = {int(m.group(1), 16): m.group(2) for m in NAME_LINE.finditer(text)}
+        return samples, names
+    return parse_samples(data), {}
+
+
+# ── Symbols ────────────────────────────────────────────────────
+class Symbols:
+    """Address to function lookup built from `nm -S` output of the ELF."""
+
+    def __init__(self, elf=None, nm=DEFAULT_NM):
+        self.starts = []
+        self.entries = []
+        if elf:
+            self._load(elf, nm)
+
+    def _load(self, elf, nm):
+        try:
+            out = subprocess.run([nm, "-n", "-S", "--defined-only", elf],
+                                 check=True, capture_output=True, text=True).stdout
+        except (OSError, subprocess.CalledProcessError) as e:
+            sys.exit(f"error: could not read symbols with {nm}: {e}")
+
+        for line in out.splitlines():
+            parts = line.split()
+            if len(parts) != 4 or parts[2] not in "tTwW":
+                continue
+            # Thumb function addresses have bit 0 set.
+            start = int(parts[0], 16) & ~1
+            size = int(parts[1], 16)
+            if size:
+                self.starts.append(start)
+                self.entries.append((start, start + size, parts[3]))
+
+    def lookup(self, addr):
+        """Function containing addr, or None."""
+
+        addr &= ~1
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i >= 0:
+            start, end, name = self.entries[i]
+            if start <= addr < end:
+                return name
+        return None
+
+    def name(self, addr):
+        return self.lookup(addr) or (f"0x{addr:08X}" if not self.entries else "[unknown]")
+
+
+# ── Aggregation ────────────────────────────────────────────────
+def stack_of(sample, symbols, task_names, use_caller):
+    """Frames from outermost to innermost: task, optional caller, function."""
+
+    task = task_names.get(sample.task, f"task 0x{sample.task:08X}" if sample.task else "[no task]")
+    frames = [task]
+    if sample.flags & FLAG_INTERRUPT:
+        frames.append("[interrupt]")
+
+    func = symbols.name(sample.pc)
+    if use_caller:
+        # The return address is one past the call; step back into the call
+        # instruction.  A stale link register usually points into the same
+        # function, or nowhere, and is left out.
+        caller = symbols.lookup(sample.lr - 2) if 0x10 < sample.lr < 0xF0000000 else None
+        if caller is not None and caller != func:
+            frames.append(caller)
+    frames.append(func)
+    return tuple(frames)
+
+
+def fold(samples, symbols, task_names, use_caller):
+    stacks = {}
+    for s in samples:
+        key = stack_of(s, symbols, task_names, use_caller)
+        stacks[key] = stacks.get(key, 0) + 1
+    return stacks
+
+
+# ── Output ─────────────────────────────────────────────────────
+def print_flat(stacks, total, top):
+    per_task = {}
+    for frames, count in stacks.items():
+        funcs = per_task.setdefault(frames[0], {})
+        funcs[frames[-1]] = funcs.get(frames[-1], 0) + count
+
+    for task, funcs in sorted(per_task.items(), key=lambda kv: -sum(kv[1].values())):
+        task_total = sum(funcs.values())
+        print(f"{task}: {task_total} samples, {100.0 * task_total / total:.1f}% of all")
+        print(f"  {'samples':>8}{'task %':>8}{'all %':>8}  function")
+        for func, count in sorted(funcs.items(), key=lambda kv: -kv[1])[:top]:
+            print(f"  {count:>8}{100.0 * count / task_total:>8.1f}{100.0 * count / total:>8.1f}  {func}")
+        print()
+
+
+def write_folded(stacks, path):
+    with open(path, "w") as f:
+        for frames, count in sorted(stacks.items()):
+            f.write(";".join(frames) + f" {count}\n")
+    print(f"Folded stacks saved to: {path}", file=sys.stderr)
+
+
+def build_tree(stacks):
+    root = {"name": "all", "count": 0, "children": {}}
+    for frames, count in stacks.items():
+        root["count"] += count
+        node = root
+        for frame in frames:
+            node = node["children"].setdefault(frame, {"name": frame, "count": 0, "children": {}})
+            node["count"] += count
+    return root
+
+
+def write_svg(stacks, path):
+    """Minimal flame graph: one row per stack depth, widths in proportion to samples."""
+
+    root = build_tree(stacks)
+    total = root["count"] or 1
+    depth = 1 + max((len(frames) for frames in stacks), default=0)
+    height = (depth + 1) * FLAME_ROW
+    rects = []
+
+    def draw(node, x, level):
+        width = FLAME_WIDTH * node["count"] / total
+        y = height - (level + 1) * FLAME_ROW
+        color = FLAME_COLORS[sum(node["name"].encode()) % len(FLAME_COLORS)]
+        label = html.escape(node["name"])
+        text = label if width > 7 * len(node["name"]) else ""
+        rects.append(f'<g><title>{label} ({node["count"]} samples, {100.0 * node["count"] / total:.1f}%)</title>'
+                     f'<rect x="{x:.1f}" y="{y}" width="{max(width - 0.5, 0.1):.1f}" height="{FLAME_ROW - 1}" '
+                     f'fill="{color}"/><text x="{x + 3:.1f}" y="{y + FLAME_ROW - 5}">{text}</text></g>')
+        child_x = x
+        for child in sorted(node["children"].values(), key=lambda c: c["name"]):
+            draw(child, child_x, level + 1)
+            child_x += FLAME_WIDTH * child["count"] / total
+
+    draw(root, 0.0, 0)
+    with open(path, "w") as f:
+        f.write(f'<svg xmlns="http://www.w3.org/2000/svg" width="{FLAME_WIDTH}" height="{height}" '
+                f'font-family="monospace" font-size="11">\n')
+        f.write("\n".join(rects))
+        f.write("\n</svg>\n")
+    print(f"Flame graph saved to: {path}", file=sys.stderr)
+
+
+# ── Main ───────────────────────────────────────────────────────
+def main():
+    parser = argparse.ArgumentParser(description="Profiles and flame graphs from FreeRTOS sampling profiler data.")
+    parser.add_argument("capture", help="raw binary samples or serial log with PRF: lines")
+    parser.add_argument("--elf", help="application ELF used to resolve addresses to functions")
+    parser.add_argument("--nm", default=DEFAULT_NM, help=f"nm to read the ELF with (default {DEFAULT_NM})")
+    parser.add_argument("--core", type=int, help="only use samples taken on this core")
+    parser.add_argument("--no-caller", action="store_true",
+                        help="leave out the caller guessed from the link register")
+    parser.add_argument("--top", type=int, default=15, help="functions listed per task")
+    parser.add_argument("--folded", metavar="PATH", help="write collapsed stacks")
+    parser.add_argument("--svg", metavar="PATH", help="write a flame graph")
+    args = parser.parse_args()
+
+    samples, names = load(args.capture)
+    if args.core is not None:
+        samples = [s for s in samples if s.core == args.core]
+    if not samples:
+        sys.exit("no samples found")
+
+    symbols = Symbols(args.elf, args.nm)
+    stacks = fold(samples, symbols, names, not args.no_caller)
+
+    print_flat(stacks, len(samples), args.top)
+    if args.folded:
+        write_folded(stacks, args.folded)
+    if args.svg:
+        write_svg(stacks, args.svg)
+
+    cores = sorted({s.core for s in samples})
+    print(f"{len(samples)} samples from core(s) {', '.join(map(str, cores))}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
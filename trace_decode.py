@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""
+FreeRTOS Trace Recorder Decoder
+Decodes the binary records written by the in-kernel trace recorder
+(configUSE_TRACE_RECORDER) into a merged, time-ordered timeline.
+
+Accepted inputs:
+  * a raw binary stream of 16 byte records (e.g. captured from a UART)
+  * a serial log in which records were printed as "TRC:<32 hex digits>" lines
+  * a raw SWD memory dump of the recorder ring buffers (--dump)
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+# ── Record format (must match Source/include/trace_recorder.h) ─
+RECORD = struct.Struct("<IBBHII")   # timestamp, event, core, param, object, value
+RECORD_SIZE = RECORD.size           # 16 bytes
+RING_HEADER = struct.Struct("<IIII")  # head, tail, dropped, reserved
+FORMAT_VERSION = 1
+DEFAULT_TIMESTAMP_HZ = 1000000
+
+EVENTS = {
+    0x01: "TRACE_START",
+    0x02: "OBJECT_NAME",
+    0x03: "USER",
+    0x04: "TICK_RATE",
+    0x10: "TASK_SWITCHED_IN",
+    0x11: "TASK_READY",
+    0x12: "TASK_CREATE",
+    0x13: "TASK_DELETE",
+    0x14: "TASK_DELAY",
+    0x15: "TASK_DELAY_UNTIL",
+    0x16: "TASK_PRIORITY_SET",
+    0x17: "TASK_SUSPEND",
+    0x18: "TASK_RESUME",
+    0x19: "TASK_RESUME_FROM_ISR",
+    0x1A: "TASK_PRIORITY_INHERIT",
+    0x1B: "TASK_PRIORITY_DISINHERIT",
+    0x1C: "TASK_INCREMENT_TICK",
+    0x1D: "TASK_SWITCHED_OUT",
+    0x1E: "TASK_DEADLINE",
+    0x1F: "TASK_MIGRATE",
+    0x20: "QUEUE_CREATE",
+    0x21: "MUTEX_CREATE",
+    0x22: "QUEUE_DELETE",
+    0x23: "QUEUE_SEND",
+    0x24: "QUEUE_SEND_FAILED",
+    0x25: "QUEUE_SEND_FROM_ISR",
+    0x26: "QUEUE_RECEIVE",
+    0x27: "QUEUE_RECEIVE_FAILED",
+    0x28: "QUEUE_RECEIVE_FROM_ISR",
+    0x29: "QUEUE_BLOCK_ON_SEND",
+    0x2A: "QUEUE_BLOCK_ON_RECEIVE",
+    0x2B: "QUEUE_BLOCK_ON_PEEK",
+    0x30: "TASK_NOTIFY",
+    0x31: "TASK_NOTIFY_FROM_ISR",
+    0x32: "TASK_NOTIFY_TAKE_BLOCK",
+    0x33: "TASK_NOTIFY_TAKE",
+    0x34: "TASK_NOTIFY_WAIT_BLOCK",
+    0x35: "TASK_NOTIFY_WAIT",
+    0x40: "ISR_ENTER",
+    0x41: "ISR_EXIT",
+    0x42: "ISR_EXIT_TO_SCHEDULER",
+    0x50: "YIELD_CORE",
+    0x51: "YIELD_CORE_RECEIVED",
+}
+
+HEX_LINE = re.compile(r"TRC:([0-9A-Fa-f]{32})")
+
+
+class Event:
+    """One decoded record. `time` is in seconds, unwrapped per core."""
+
+    __slots__ = ("raw_ts", "time", "event", "name", "core", "param", "obj", "value")
+
+    def __init__(self, raw_ts, event, core, param, obj, value):
+        self.raw_ts = raw_ts
+        self.time = 0.0
+        self.event = event
+        self.name = EVENTS.get(event, f"EVENT_0x{event:02X}")
+        self.core = core
+        self.param = param
+        self.obj = obj
+        self.value = value
+
+
+# ── Input ──────────────────────────────────────────────────────
+def parse_records(data):
+    """Split a binary blob into Events, ignoring a trailing partial record."""
+
+    usable = len(data) - (len(data) % RECORD_SIZE)
+    return [Event(*RECORD.unpack_from(data, off)) for off in range(0, usable, RECORD_SIZE)]
+
+
+def parse_hex_log(text):
+    """Extract records from TRC:<hex> lines in a serial log."""
+
+    return parse_records(b"".join(bytes.fromhex(m.group(1)) for m in HEX_LINE.finditer(text)))
+
+
+def parse_dump(data, cores):
+    """Extract the unread records from a memory dump of the ring buffers."""
+
+    per_core = (len(data)) // cores
+    length = (per_core - RING_HEADER.size) // RECORD_SIZE
+    if length <= 0 or length & (length - 1):
+        raise ValueError(f"dump size {len(data)} does not match {cores} ring buffer(s)")
+
+    events = []
+    for core in range(cores):
+        base = core * per_core
+        head, tail, dropped, _ = RING_HEADER.unpack_from(data, base)
+        if dropped:
+            print(f"warning: core {core} dropped {dropped} records", file=sys.stderr)
+        for i in range(tail, head):
+            off = base + RING_HEADER.size + (i & (length - 1)) * RECORD_SIZE
+            events.append(Event(*RECORD.unpack_from(data, off)))
+    return events
+
+
+def load(path, dump_cores=0):
+    """Load events from a file in any of the supported formats."""
+
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if dump_cores:
+        return parse_dump(data, dump_cores)
+
+    try:
+        text = data.decode("ascii")
+    except UnicodeDecodeError:
+        text = None
+
+    if text is not None and HEX_LINE.search(text):
+        return parse_hex_log(text)
+    return parse_records(data)
+
+
+# ── Decoding ───────────────────────────────────────────────────
+def timestamp_hz(events):
+    """Time stamp frequency from the first TRACE_START record."""
+
+    for ev in events:
+        if ev.event == 0x01:
+            if ev.param != FORMAT_VERSION:
+                print(f"warning: trace format version {ev.param}, decoder expects {FORMAT_VERSION}",
+                      file=sys.stderr)
+            return ev.value or DEFAULT_TIMESTAMP_HZ
+    return DEFAULT_TIMESTAMP_HZ
+
+
+def unwrap_and_merge(events, hz):
+    """
+    Unwrap the 32-bit time stamps of each core separately (records of one core
+    are always in order) and merge the cores into one time-ordered list.
+    """
+
+    last = {}
+    offset = {}
+    ticks = []
+    for ev in events:
+        prev = last.get(ev.core)
+        if prev is not None and ev.raw_ts < prev:
+            offset[ev.core] = offset.get(ev.core, 0) + (1 << 32)
+        last[ev.core] = ev.raw_ts
+        ticks.append(ev.raw_ts + offset.get(ev.core, 0))
+
+    origin = min(ticks, default=0)
+    for ev, t in zip(events, ticks):
+        ev.time = (t - origin) / hz
+
+    # Python's sort is stable, so records with equal time stamps keep their order.
+    events.sort(key=lambda e: e.time)
+    return events
+
+
+def collect_names(events):
+    """Rebuild object names from OBJECT_NAME records."""
+
+    chunks = {}
+    for ev in events:
+        if ev.event == 0x02:
+            chunks.setdefault(ev.obj, {})[ev.param] = struct.pack("<I", ev.value)
+
+    names = {}
+    for obj, parts in chunks.items():
+        raw = b"".join(parts[i] for i in sorted(parts))
+        names[obj] = raw.split(b"\0", 1)[0].decode("ascii", "replace")
+    return names
+
+
+def decode(path, dump_cores=0):
+    """Load, unwrap and merge a trace. Returns (events, names)."""
+
+    events = load(path, dump_cores)
+    events = unwrap_and_merge(events, timestamp_hz(events))
+    return events, collect_names(events)
+
+
+def describe(ev, names):
+    """Human readable description of one event."""
+
+    obj = names.get(ev.obj, f"0x{ev.obj:08X}") if ev.obj else ""
+    if ev.event in (0x10, 0x11, 0x12):
+        return f"{obj} prio={ev.param}"
+    if ev.event in (0x14, 0x15, 0x1E):
+        return f"{obj} ticks={ev.value}"
+    if ev.event == 0x1D:
+        return f"{obj} {'blocked' if ev.param else 'preempted'}"
+    if ev.event in (0x16, 0x1A, 0x1B):
+        return f"{obj} prio={ev.param}"
+    if 0x20 <= ev.event <= 0x2B:
+        return f"{obj} items={ev.value}"
+    if 0x30 <= ev.event <= 0x35:
+        return f"{obj} index={ev.param}"
+    if ev.event == 0x1F:
+        return f"{obj} from core{ev.param}"
+    if ev.event == 0x40:
+        return f"exception={ev.param}"
+    if ev.event == 0x50:
+        return f"core{ev.param}"
+    if ev.event == 0x51:
+        return f"{'wasted ' if ev.param else ''}latency={ev.value}"
+    if ev.event == 0x03:
+        return f"channel={ev.param} value={ev.value}"
+    if ev.event == 0x01:
+        return f"version={ev.param} hz={ev.value}"
+    if ev.event == 0x04:
+        return f"tick_hz={ev.value}"
+    return obj
+
+
+# ── Main ───────────────────────────────────────────────────────
+def main():
+    parser = argparse.ArgumentParser(description="Decode a FreeRTOS trace recorder capture.")
+    parser.add_argument("capture", help="binary stream, serial log with TRC: lines, or memory dump")
+    parser.add_argument("--dump", type=int, metavar="CORES", default=0,
+                        help="input is a raw dump of the ring buffers of CORES cores")
+    parser.add_argument("--csv", action="store_true", help="print CSV instead of a text timeline")
+    args = parser.parse_args()
+
+    events, names = decode(args.capture, args.dump)
+
+    if args.csv:
+        print("time_us,core,event,object,param,value")
+        for ev in events:
+            if ev.event != 0x02:
+                print(f"{ev.time * 1e6:.0f},{ev.core},{ev.name},"
+                      f"{names.get(ev.obj, hex(ev.obj))},{ev.param},{ev.value}")
+        return
+
+    for ev in events:
+        if ev.event != 0x02:
+            print(f"{ev.time * 1e6:12.0f} us  core{ev.core}  {ev.name:<24} {describe(ev, names)}")
+
+    print(f"\n{len(events)} records, {len(names)} named objects", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+"""
+FreeRTOS Schedule Gantt Chart & Job Tables from the Trace Recorder
+Reconstructs the schedule of every task on every core from a trace recorder
+capture (see trace_decode.py) and generates:
+  * a Gantt chart with one row per task, coloured by the core it ran on,
+    with job releases, deadlines and deadline misses marked
+  * a per-job table of release, start, finish, response time and deadline
+  * a per-task summary of response times and deadline misses
+
+Unlike capture_gantt.py this needs no external hardware, works for any number
+of tasks and both cores, and has the 1 us resolution of the recorder time base.
+
+Jobs: a job is released when a blocked task becomes ready and finishes when the
+task next blocks. Its deadline comes from vTraceRecorderSetDeadline() or, for
+tasks that use xTaskDelayUntil(), defaults to the task's period.
+"""
+
+import argparse
+import csv
+import sys
+
+from trace_decode import decode
+
+# ── Configuration ──────────────────────────────────────────────
+CORE_COLORS = ["#3498db", "#e67e22"]
+RELEASE_COLOR = "#2c3e50"
+MISS_COLOR = "#e74c3c"
+DEFAULT_TICK_HZ = 1000
+
+EV_TICK_RATE = 0x04
+EV_SWITCHED_IN = 0x10
+EV_READY = 0x11
+EV_DELAY_UNTIL = 0x15
+EV_SWITCHED_OUT = 0x1D
+EV_DEADLINE = 0x1E
+
+
+class Job:
+    __slots__ = ("task", "index", "release", "start", "finish", "deadline")
+
+    def __init__(self, task, index, release, deadline):
+        self.task = task
+        self.index = index
+        self.release = release
+        self.start = None
+        self.finish = None
+        self.deadline = deadline
+
+    @property
+    def response(self):
+        return None if self.finish is None else self.finish - self.release
+
+    @property
+    def missed(self):
+        return self.deadline is not None and self.finish is not None and self.finish > self.deadline
+
+
+# ── Schedule reconstruction ────────────────────────────────────
+def is_idle(name):
+    return name.startswith("IDLE")
+
+
+def build_schedule(events, names):
+    """
+    Walk the merged event list and return
+      intervals: {task: [(start, end, core), ...]}
+      jobs:      [Job, ...] in release order
+    Times are in seconds from the start of the capture.
+    """
+
+    tick = 1.0 / DEFAULT_TICK_HZ
+    running = {}            # core -> (task, start)
+    intervals = {}
+    jobs = []
+    open_job = {}           # task -> Job
+    job_count = {}
+    explicit_deadline = {}  # task -> seconds
+    period = {}             # task -> seconds, from xTaskDelayUntil() wake times
+    last_wake = {}
+    end_time = events[-1].time if events else 0.0
+
+    def name_of(obj):
+        return names.get(obj, f"0x{obj:08X}")
+
+    def relative_deadline(task):
+        return explicit_deadline.get(task, period.get(task))
+
+    def release(task, t):
+        if task in open_job or is_idle(name_of(task)):
+            return
+        d = relative_deadline(task)
+        job = Job(task, job_count.get(task, 0), t, None if d is None else t + d)
+        job_count[task] = job.index + 1
+        open_job[task] = job
+        jobs.append(job)
+
+    def stop_running(core, t):
+        if core in running:
+            task, start = running.pop(core)
+            if t > start:
+                intervals.setdefault(task, []).append((start, t, core))
+
+    for ev in events:
+        t = ev.time
+        if ev.event == EV_TICK_RATE and ev.value:
+            tick = 1.0 / ev.value
+        elif ev.event == EV_DEADLINE:
+            explicit_deadline[ev.obj] = ev.value * tick
+        elif ev.event == EV_DELAY_UNTIL:
+            if ev.obj in last_wake:
+                period[ev.obj] = ((ev.value - last_wake[ev.obj]) & 0xFFFFFFFF) * tick
+            last_wake[ev.obj] = ev.value
+        elif ev.event == EV_READY:
+            release(ev.obj, t)
+        elif ev.event == EV_SWITCHED_IN:
+            current = running.get(ev.core)
+            if current is None or current[0] != ev.obj:
+                stop_running(ev.core, t)
+                running[ev.core] = (ev.obj, t)
+            # A task that was already ready when tracing started has no READY record.
+            release(ev.obj, t)
+            job = open_job.get(ev.obj)
+            if job is not None and job.start is None:
+                job.start = t
+        elif ev.event == EV_SWITCHED_OUT:
+            if ev.param:
+                job = open_job.pop(ev.obj, None)
+                if job is not None:
+                    job.finish = t
+
+    for core in list(running):
+        stop_running(core, end_time)
+
+    return intervals, jobs
+
+
+# ── Tables ─────────────────────────────────────────────────────
+def us(t):
+    return "-" if t is None else f"{t * 1e6:.0f}"
+
+
+def print_job_table(jobs, names):
+    print(f"{'task':<16}{'job':>5}{'release':>12}{'start':>12}{'finish':>12}"
+          f"{'response':>10}{'deadline':>12}  miss")
+    for job in jobs:
+        print(f"{names.get(job.task, hex(job.task)):<16}{job.index:>5}{us(job.release):>12}"
+              f"{us(job.start):>12}{us(job.finish):>12}{us(job.response):>10}"
+              f"{us(job.deadline):>12}  {'MISS' if job.missed else ''}")
+
+
+def print_summary(jobs, names):
+    per_task = {}
+    for job in jobs:
+        per_task.setdefault(job.task, []).append(job)
+
+    print(f"\n{'task':<16}{'jobs':>6}{'min us':>10}{'avg us':>10}{'max us':>10}{'misses':>8}")
+    for task, task_jobs in per_task.items():
+        done = [j.response for j in task_jobs if j.response is not None]
+        misses = sum(1 for j in task_jobs if j.missed)
+        if done:
+            print(f"{names.get(task, hex(task)):<16}{len(task_jobs):>6}{min(done) * 1e6:>10.0f}"
+                  f"{sum(done) / len(done) * 1e6:>10.0f}{max(done) * 1e6:>10.0f}{misses:>8}")
+        else:
+            print(f"{names.get(task, hex(task)):<16}{len(task_jobs):>6}{'-':>10}{'-':>10}{'-':>10}{misses:>8}")
+
+
+def write_job_csv(jobs, names, path):
+    with open(path, "w", newline="") as f:
+        w = csv.writer(f)
+        w.writerow(["task", "job", "release_us", "start_us", "finish_us", "response_us", "deadline_us", "missed"])
+        for job in jobs:
+            w.writerow([names.get(job.task, hex(job.task)), job.index, us(job.release), us(job.start),
+                        us(job.finish), us(job.response), us(job.deadline), int(job.missed)])
+    print(f"\nJob table saved to: {path}")
+
+
+# ── Gantt Chart ────────────────────────────────────────────────
+def plot_gantt(intervals, jobs, names, save_path, show_idle, window):
+    """Generate a Gantt chart with one row per task."""
+
+    import matplotlib.pyplot as plt
+    import matplotlib.patches as mpatches
+
+    tasks = [t for t in intervals if show_idle or not is_idle(names.get(t, ""))]
+    tasks.sort(key=lambda t: names.get(t, hex(t)))
+    rows = {task: len(tasks) - i - 1 for i, task in enumerate(tasks)}
+    t0, t1 = window
+
+    fig, ax = plt.subplots(figsize=(14, 1.0 + 0.5 * max(len(tasks), 1)))
+
+    for task, y in rows.items():
+        for (start, end, core) in intervals[task]:
+            if end < t0 or start > t1:
+                continue
+            ax.barh(y, (end - start) * 1e3, left=start * 1e3, height=0.6,
+                    color=CORE_COLORS[core % len(CORE_COLORS)], edgecolor="black", linewidth=0.3)
+
+    for job in jobs:
+        y = rows.get(job.task)
+        if y is None or job.release > t1 or job.release < t0:
+            continue
+        ax.annotate("", xy=(job.release * 1e3, y + 0.4), xytext=(job.release * 1e3, y + 0.05),
+                    arrowprops=dict(arrowstyle="->", color=RELEASE_COLOR, lw=0.8))
+        if job.deadline is not None and t0 <= job.deadline <= t1:
+            ax.plot([job.deadline * 1e3], [y - 0.35], marker="v",
+                    color=MISS_COLOR if job.missed else RELEASE_COLOR, markersize=4)
+        if job.missed:
+            ax.plot([job.finish * 1e3], [y], marker="x", color=MISS_COLOR, markersize=8)
+
+    ax.set_yticks(list(rows.values()))
+    ax.set_yticklabels([names.get(t, hex(t)) for t in rows], fontsize=9)
+    ax.set_xlabel("Time (ms)", fontsize=12)
+    ax.set_title("FreeRTOS Task Execution — Trace Recorder", fontsize=13, fontweight="bold")
+    ax.set_xlim(t0 * 1e3, t1 * 1e3)
+    ax.grid(axis="x", alpha=0.3)
+    ax.set_axisbelow(True)
+
+    cores = sorted({core for task in tasks for (_, _, core) in intervals[task]})
+    patches = [mpatches.Patch(color=CORE_COLORS[c % len(CORE_COLORS)], label=f"core {c}") for c in cores]
+    patches.append(mpatches.Patch(color=MISS_COLOR, label="deadline miss"))
+    ax.legend(handles=patches, loc="upper right", fontsize=9)
+
+    plt.tight_layout()
+    plt.savefig(save_path, dpi=150)
+    print(f"\nGantt chart saved to: {save_path}")
+
+
+# ── Main ───────────────────────────────────────────────────────
+def main():
+    parser = argparse.ArgumentParser(description="Gantt chart and job tables from a trace recorder capture.")
+    parser.add_argument("capture", help="capture file accepted by trace_decode.py")
+    parser.add_argument("--dump", type=int, metavar="CORES", default=0,
+                        help="input is a raw dump of the ring buffers of CORES cores")
+    parser.add_argument("-o", "--output", default="schedule_gantt.png", help="Gantt chart image")
+    parser.add_argument("--csv", metavar="PATH", help="also write the job table as CSV")
+    parser.add_argument("--start", type=float, default=0.0, help="window start in ms")
+    parser.add_argument("--end", type=float, default=None, help="window end in ms")
+    parser.add_argument("--show-idle", action="store_true", help="include the idle task(s) in the chart")
+    parser.add_argument("--no-plot", action="store_true", help="only print the tables")
+    args = parser.parse_args()
+
+    events, names = decode(args.capture, args.dump)
+    if not events:
+        sys.exit("no trace records found")
+
+    intervals, jobs = build_schedule(events, names)
+
+    print_job_table(jobs, names)
+    print_summary(jobs, names)
+    if args.csv:
+        write_job_csv(jobs, names, args.csv)
+
+    if not args.no_plot:
+        end = events[-1].time if args.end is None else args.end / 1e3
+        plot_gantt(intervals, jobs, names, args.output, args.show_idle, (args.start / 1e3, end))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+FreeRTOS Time-Triggered Table Generator
+Builds the static cyclic schedule dispatched by xTaskStartTimeTriggered()
+(configUSE_TIME_TRIGGERED) from the parameters of the time triggered tasks,
+checks it by simulating one hyperperiod, and writes it as a C header.
+
+Tasks are given as NAME:PERIOD:WCET[:OFFSET], in ticks; WCET may be
+fractional. They are listed in priority order, highest first, which must match
+the priorities they are created with. Without an offset, --spread picks one
+that keeps releases apart.
+
+Outputs:
+  * a report of the releases, utilization and worst case response times
+  * --out: a header defining ttTASK_<NAME> indices, the entries and the table
+"""
+
+import argparse
+import math
+import re
+import sys
+
+NAME = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+DEFAULT_TABLE = "xTimeTriggeredTable"
+MAX_HYPERPERIOD = 1 << 20
+
+
+class Task:
+    __slots__ = ("name", "period", "wcet", "offset")
+
+    def __init__(self, name, period, wcet, offset):
+        self.name = name
+        self.period = period
+        self.wcet = wcet
+        self.offset = offset
+
+
+# ── Input ──────────────────────────────────────────────────────
+def parse_task(spec):
+    """Parse NAME:PERIOD:WCET[:OFFSET]."""
+
+    parts = spec.split(":")
+    if len(parts) not in (3, 4):
+        raise ValueError(f"'{spec}' is not NAME:PERIOD:WCET[:OFFSET]")
+    name = parts[0]
+    if not NAME.match(name):
+        raise ValueError(f"'{name}' is not a C identifier")
+    period = int(parts[1])
+    wcet = float(parts[2])
+    offset = int(parts[3]) if len(parts) == 4 else None
+    if period <= 0:
+        raise ValueError(f"{name}: period must be positive")
+    if not 0 < wcet <= period:
+        raise ValueError(f"{name}: WCET must be positive and at most the period")
+    if offset is not None and not 0 <= offset < period:
+        raise ValueError(f"{name}: offset must be less than the period")
+    return Task(name, period, wcet, offset)
+
+
+# ── Table ──────────────────────────────────────────────────────
+def spread_offsets(tasks, hyperperiod):
+    """Give each task without an offset the one that adds the least load to
+    the busiest tick it is released on, longest WCET first."""
+
+    load = [0.0] * hyperperiod
+    for t in tasks:
+        if t.offset is not None:
+            for r in range(t.offset, hyperperiod, t.period):
+                load[r] += t.wcet
+
+    for t in sorted((t for t in tasks if t.offset is None), key=lambda t: -t.wcet):
+        best = min(range(t.period),
+                   key=lambda o: (max(load[r] for r in range(o, hyperperiod, t.period)), o))
+        t.offset = best
+        for r in range(best, hyperperiod, t.period):
+            load[r] += t.wcet
+
+
+def build_entries(tasks, hyperperiod):
+    """Releases as (offset, task index), sorted by offset then priority."""
+
+    entries = []
+    for index, t in enumerate(tasks):
+        entries.extend((r, index) for r in range(t.offset, hyperperiod, t.period))
+    return sorted(entries)
+
+
+def simulate(tasks, hyperperiod):
+    """Fixed priority preemptive simulation over two hyperperiods, so jobs
+    carried over from the first are seen. Returns the worst response time of
+    each task, and the releases that found the previous job unfinished."""
+
+    remaining = [0.0] * len(tasks)
+    released = [0.0] * len(tasks)
+    worst = [0.0] * len(tasks)
+    missed = []
+
+    for tick in range(2 * hyperperiod):
+        for i, t in enumerate(tasks):
+            if tick >= t.offset and (tick - t.offset) % t.period == 0:
+                if remaining[i] > 0:
+                    missed.append((tick % hyperperiod, t.name))
+                else:
+                    remaining[i] = t.wcet
+                    released[i] = tick
+
+        budget = 1.0
+        for i in range(len(tasks)):
+            if budget <= 0:
+                break
+            run = min(budget, remaining[i])
+            if run > 0:
+                remaining[i] -= run
+                budget -= run
+                if remaining[i] <= 1e-9:
+                    remaining[i] = 0.0
+                    worst[i] = max(worst[i], tick + 1 - budget - released[i])
+
+    return worst, missed
+
+
+# ── Output ─────────────────────────────────────────────────────
+def print_report(tasks, entries, hyperperiod, worst, missed):
+    utilization = sum(t.wcet / t.period for t in tasks)
+    print(f"hyperperiod {hyperperiod} ticks, {len(entries)} releases, "
+          f"utilization {utilization:.1%}")
+    print(f"{'task':<16}{'period':>8}{'wcet':>8}{'offset':>8}{'worst rt':>10}")
+    for t, rt in zip(tasks, worst):
+        print(f"{t.name:<16}{t.period:>8}{t.wcet:>8g}{t.offset:>8}{rt:>10.2f}")
+    for offset, name in missed[:10]:
+        print(f"warning: {name} is released at offset {offset} before its previous job completes")
+
+
+def write_header(path, tasks, entries, hyperperiod, table):
+    guard = re.sub(r"[^A-Za-z0-9]", "_", path.split("/")[-1]).upper()
+    lines = [
+        "/* Generated by tt_table_gen.py, do not edit. */",
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "#include \"FreeRTOS.h\"",
+        "#include \"task.h\"",
+        "",
+        "/* Indices of the tasks in the array passed to xTaskStartTimeTriggered(). */",
+    ]
+    width = max(len(t.name) for t in tasks) + 7
+    for index, t in enumerate(tasks):
+        lines.append(f"#define {('ttTASK_' + t.name.upper()):<{width}}    ( {index}U )")
+    lines.append(f"#define {'ttTASKS':<{width}}    ( {len(tasks)}U )")
+    lines += [
+        "",
+        f"static const TimeTriggeredEntry_t {table}Entries[] =",
+        "{",
+    ]
+    for offset, index in entries:
+        lines.append(f"    {{ {offset}U, ttTASK_{tasks[index].name.upper()} }},")
+    lines += [
+        "};",
+        "",
+        f"static const TimeTriggeredTable_t {table} =",
+        "{",
+        f"    {table}Entries,",
+        f"    sizeof( {table}Entries ) / sizeof( {table}Entries[ 0 ] ),",
+        f"    {hyperperiod}U",
+        "};",
+        "",
+        f"#endif /* {guard} */",
+        "",
+    ]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate a FreeRTOS time-triggered schedule table.")
+    parser.add_argument("tasks", nargs="+", metavar="NAME:PERIOD:WCET[:OFFSET]",
+                        help="time triggered tasks in ticks, highest priority first")
+    parser.add_argument("--spread", action="store_true",
+                        help="choose offsets for tasks without one to keep releases apart")
+    parser.add_argument("--out", metavar="PATH", help="write the table as a C header")
+    parser.add_argument("--name", default=DEFAULT_TABLE, help=f"name of the table (default {DEFAULT_TABLE})")
+    args = parser.parse_args()
+
+    try:
+        tasks = [parse_task(spec) for spec in args.tasks]
+    except ValueError as e:
+        sys.exit(f"error: {e}")
+
+    if len({t.name.upper() for t in tasks}) != len(tasks):
+        sys.exit("error: task names must be unique")
+
+    hyperperiod = math.lcm(*(t.period for t in tasks))
+    if hyperperiod > MAX_HYPERPERIOD:
+        sys.exit(f"error: hyperperiod of {hyperperiod} ticks is too long, make the periods harmonic")
+
+    if args.spread:
+        spread_offsets(tasks, hyperperiod)
+    for t in tasks:
+        if t.offset is None:
+            t.offset = 0
+
+    entries = build_entries(tasks, hyperperiod)
+    worst, missed = simulate(tasks, hyperperiod)
+    print_report(tasks, entries, hyperperiod, worst, missed)
+
+    if args.out:
+        write_header(args.out, tasks, entries, hyperperiod, args.name)
+
+    if missed:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()